@@ -0,0 +1,78 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "api/service/impl/rpc_batch_thread_pool.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::api::JRpcServerImpl;
+
+/// Batch of `size` storage reads, as indexers send
+static std::string makeBatch(size_t size) {
+  std::string batch = "[";
+  for (size_t i = 0; i < size; ++i) {
+    if (i != 0) {
+      batch += ',';
+    }
+    batch += R"({"jsonrpc":"2.0","method":"state_getStorage","id":)";
+    batch += std::to_string(i);
+    batch += R"(,"params":["0x00"]})";
+  }
+  batch += ']';
+  return batch;
+}
+
+/// Storage read latency of node with cold cache
+static void registerStorage(JRpcServerImpl &server) {
+  server.registerHandler("state_getStorage", [](const auto &) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return jsonrpc::Value{"0x00"};
+  });
+}
+
+static void respond(benchmark::State &state, JRpcServerImpl &server) {
+  auto batch = makeBatch(state.range(0));
+  for (auto _ : state) {
+    server.processData(batch, false, [](std::string_view response) {
+      benchmark::DoNotOptimize(response.data());
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Entries handled one by one on rpc thread
+static void sequential(benchmark::State &state) {
+  JRpcServerImpl server;
+  registerStorage(server);
+  respond(state, server);
+}
+
+/// Entries handled by calling thread together with rpc batch pool
+static void concurrent(benchmark::State &state) {
+  auto watchdog = std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  {
+    kagome::api::RpcBatchThreadPool rpc_batch_thread_pool(
+        watchdog, kagome::api::RpcBatchThreadPool::threadCount());
+    JRpcServerImpl server{rpc_batch_thread_pool};
+    registerStorage(server);
+    respond(state, server);
+    watchdog->stop();
+  }
+}
+
+BENCHMARK(sequential)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->UseRealTime();
+BENCHMARK(concurrent)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
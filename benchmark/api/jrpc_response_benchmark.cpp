@@ -0,0 +1,129 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+#include "api/jrpc/json_stream_writer.hpp"
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace {
+  // Heap usage is tracked to report peak memory per response
+  std::atomic_size_t heap_current = 0;
+  std::atomic_size_t heap_peak = 0;
+
+  constexpr size_t kHeader = alignof(std::max_align_t);
+
+  void *allocate(size_t size) {
+    auto *ptr = static_cast<char *>(std::malloc(size + kHeader));
+    if (ptr == nullptr) {
+      throw std::bad_alloc{};
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    *reinterpret_cast<size_t *>(ptr) = size;
+    auto current = heap_current.fetch_add(size) + size;
+    auto peak = heap_peak.load();
+    while (current > peak
+           and not heap_peak.compare_exchange_weak(peak, current)) {
+    }
+    return ptr + kHeader;
+  }
+
+  void deallocate(void *ptr) {
+    if (ptr == nullptr) {
+      return;
+    }
+    auto *base = static_cast<char *>(ptr) - kHeader;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    heap_current.fetch_sub(*reinterpret_cast<size_t *>(base));
+    std::free(base);
+  }
+}  // namespace
+
+void *operator new(size_t size) {
+  return allocate(size);
+}
+
+void *operator new[](size_t size) {
+  return allocate(size);
+}
+
+void operator delete(void *ptr) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+  deallocate(ptr);
+}
+
+using kagome::api::JRpcServerImpl;
+using kagome::api::JsonStreamWriter;
+using kagome::common::Buffer;
+
+constexpr auto kRequest =
+    R"({"jsonrpc":"2.0","method":"state_getMetadata","id":1,"params":[]})";
+
+/// Metadata sized payload, hex encoded by handler as state api does
+const Buffer &metadata() {
+  static const Buffer metadata{std::vector<uint8_t>(5 << 20, 0x5a)};
+  return metadata;
+}
+
+static void respond(benchmark::State &state, JRpcServerImpl &server) {
+  size_t peak = 0;
+  for (auto _ : state) {
+    auto before = heap_current.load();
+    heap_peak = before;
+    server.processData(kRequest, false, [](std::string_view response) {
+      benchmark::DoNotOptimize(response.data());
+    });
+    peak = std::max(peak, heap_peak.load() - before);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["peak_heap_mb"] = static_cast<double>(peak) / (1 << 20);
+}
+
+/// Result converted to `jsonrpc::Value` and serialized by jsonrpc-lean
+static void valueTree(benchmark::State &state) {
+  JRpcServerImpl server;
+  server.registerHandler("state_getMetadata", [](const auto &) {
+    return jsonrpc::Value{kagome::common::hex_lower_0x(metadata())};
+  });
+  respond(state, server);
+}
+
+/// Result written into response by streaming handler
+static void stream(benchmark::State &state) {
+  JRpcServerImpl server;
+  server.registerStreamHandler(
+      "state_getMetadata", [](const auto &, JsonStreamWriter &writer) {
+        writer.hex(metadata());
+      });
+  respond(state, server);
+}
+
+BENCHMARK(valueTree);
+BENCHMARK(stream);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
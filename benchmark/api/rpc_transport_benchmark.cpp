@@ -0,0 +1,118 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "api/service/impl/api_service_impl.hpp"
+#include "api/service/impl/rpc_thread_pool.hpp"
+#include "api/transport/impl/ws/ws_listener_impl.hpp"
+#include "application/impl/app_state_manager_impl.hpp"
+#include "core/api/client/http_client.hpp"
+#include "core/api/client/ws_client.hpp"
+#include "mock/core/api/transport/api_stub.hpp"
+#include "mock/core/api/transport/jrpc_processor_stub.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/runtime/core_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace kagome::api;
+namespace events = kagome::primitives::events;
+using testing::Return;
+using testing::ReturnRef;
+
+constexpr auto kRequest =
+    R"({"jsonrpc":"2.0","method":"echo","id":0,"params":[11259375]})";
+
+/// RPC service with echo method, served by rpc thread as node does
+struct RpcService {
+  RpcService() {
+    std::random_device random;
+    endpoint.address(boost::asio::ip::make_address("127.0.0.1"));
+    endpoint.port(1024 + random() % (65536 - 1024));
+    ON_CALL(app_config, rpcEndpoint()).WillByDefault(ReturnRef(endpoint));
+    ON_CALL(app_config, maxWsConnections()).WillByDefault(Return(100));
+
+    listener = std::make_shared<WsListenerImpl>(
+        *app_state_manager, rpc_context, app_config, session_config);
+    service = std::make_shared<ApiServiceImpl>(
+        *app_state_manager,
+        std::vector<std::shared_ptr<Listener>>{listener},
+        server,
+        std::vector<std::shared_ptr<JRpcProcessor>>{
+            std::make_shared<JrpcProcessorStub>(server,
+                                                std::make_shared<ApiStub>())},
+        std::make_shared<events::StorageSubscriptionEngine>(),
+        std::make_shared<events::ChainSubscriptionEngine>(),
+        std::make_shared<events::ExtrinsicSubscriptionEngine>(),
+        std::make_shared<kagome::subscription::ExtrinsicEventKeyRepository>(),
+        std::make_shared<kagome::blockchain::BlockTreeMock>(),
+        std::make_shared<kagome::storage::trie::TrieStorageMock>(),
+        std::make_shared<kagome::runtime::CoreMock>(),
+        rpc_thread_pool);
+    listener->prepare();
+    service->prepare();
+    listener->start();
+  }
+
+  ~RpcService() {
+    listener->stop();
+    watchdog->stop();
+  }
+
+  boost::asio::ip::tcp::endpoint endpoint;
+  WsSession::Configuration session_config;
+  testing::NiceMock<kagome::application::AppConfigurationMock> app_config;
+  std::shared_ptr<kagome::application::AppStateManager> app_state_manager =
+      std::make_shared<kagome::application::AppStateManagerImpl>();
+  std::shared_ptr<kagome::Watchdog> watchdog =
+      std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  std::shared_ptr<RpcContext> rpc_context = std::make_shared<RpcContext>(1);
+  std::shared_ptr<RpcThreadPool> rpc_thread_pool =
+      std::make_shared<RpcThreadPool>(watchdog, rpc_context);
+  std::shared_ptr<JRpcServer> server = std::make_shared<JRpcServerImpl>();
+  std::shared_ptr<Listener> listener;
+  std::shared_ptr<ApiService> service;
+};
+
+/// Sequential requests over one client connection
+template <typename Client>
+static void requests(benchmark::State &state) {
+  RpcService service;
+  boost::asio::io_context context;
+  Client client{context};
+  client.connect(service.endpoint).value();
+  for (auto _ : state) {
+    client.query(kRequest, [](outcome::result<std::string> response) {
+      benchmark::DoNotOptimize(response.value());
+    });
+  }
+  client.disconnect();
+  state.SetItemsProcessed(state.iterations());
+}
+
+/// WebSocket frames, subscription state kept for connection
+static void ws(benchmark::State &state) {
+  requests<test::WsClient>(state);
+}
+
+/// HTTP/1.1 requests over keep-alive connection
+static void http(benchmark::State &state) {
+  requests<test::HttpClient>(state);
+}
+
+BENCHMARK(ws)->UseRealTime();
+BENCHMARK(http)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
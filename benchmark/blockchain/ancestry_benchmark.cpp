@@ -0,0 +1,83 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "blockchain/impl/block_storage_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::blockchain::BlockStorageImpl;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockNumber;
+
+/// Chain of 100k blocks, shared by all benchmarks
+struct Chain {
+  static constexpr BlockNumber kLength = 100'000;
+
+  static Chain &get() {
+    static Chain chain;
+    return chain;
+  }
+
+  Chain() {
+    auto db = std::make_shared<kagome::storage::InMemorySpacedStorage>();
+    auto hasher = std::make_shared<kagome::crypto::HasherImpl>();
+    block_storage = BlockStorageImpl::create({}, db, hasher).value();
+    hashes.emplace_back(block_storage->getBlockHash(0).value().value());
+    for (BlockNumber number = 1; number <= kLength; ++number) {
+      BlockHeader header;
+      header.number = number;
+      header.parent_hash = hashes.back();
+      hashes.emplace_back(block_storage->putBlockHeader(header).value());
+    }
+  }
+
+  std::shared_ptr<BlockStorageImpl> block_storage;
+  std::vector<BlockHash> hashes;
+};
+
+/// Ancestry check walking parent hashes, as block tree did before skip list
+static void parentWalk(benchmark::State &state) {
+  auto &chain = Chain::get();
+  auto distance = static_cast<BlockNumber>(state.range(0));
+  auto ancestor = Chain::kLength - distance;
+  for (auto _ : state) {
+    auto hash = chain.hashes.back();
+    for (auto number = Chain::kLength; number > ancestor; --number) {
+      hash = chain.block_storage->getBlockHeader(hash).value().parent_hash;
+    }
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/// Ancestry check using skip pointers
+static void skipList(benchmark::State &state) {
+  auto &chain = Chain::get();
+  auto distance = static_cast<BlockNumber>(state.range(0));
+  auto ancestor = Chain::kLength - distance;
+  for (auto _ : state) {
+    auto hash = chain.block_storage
+                    ->getAncestorHash({Chain::kLength, chain.hashes.back()},
+                                      ancestor)
+                    .value();
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(parentWalk)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+BENCHMARK(skipList)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
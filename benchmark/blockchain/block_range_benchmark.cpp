@@ -0,0 +1,129 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "blockchain/impl/block_storage_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "storage/rocksdb/rocksdb.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::blockchain::BlockStorageImpl;
+using kagome::common::Buffer;
+using kagome::primitives::Block;
+using kagome::primitives::BlockBody;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockNumber;
+using kagome::primitives::Justification;
+
+/// Database with chain of finalized blocks, as archive node serves them
+struct Database {
+  static constexpr BlockNumber kLength = 20'000;
+  static constexpr size_t kExtrinsics = 8;
+  static constexpr size_t kExtrinsicSize = 200;
+
+  static Database &get() {
+    static Database database;
+    return database;
+  }
+
+  Database() {
+    std::filesystem::remove_all(path);
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    db = kagome::storage::RocksDb::create(path, options).value();
+    block_storage = BlockStorageImpl::create(
+                        {}, db, std::make_shared<kagome::crypto::HasherImpl>())
+                        .value();
+    hashes.emplace_back(block_storage->getBlockHash(0).value().value());
+    Justification justification{Buffer(std::vector<uint8_t>(kExtrinsicSize))};
+    for (BlockNumber number = 1; number <= kLength; ++number) {
+      Block block;
+      block.header.number = number;
+      block.header.parent_hash = hashes.back();
+      for (size_t i = 0; i < kExtrinsics; ++i) {
+        block.body.push_back({Buffer(std::vector<uint8_t>(kExtrinsicSize, i))});
+      }
+      auto hash = block_storage->putBlock(block).value();
+      block_storage->putJustification(justification, hash).value();
+      hashes.emplace_back(hash);
+    }
+  }
+
+  ~Database() {
+    block_storage.reset();
+    db.reset();
+    std::filesystem::remove_all(path);
+  }
+
+  std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "kagome_block_range_benchmark";
+  std::shared_ptr<kagome::storage::RocksDb> db;
+  std::shared_ptr<BlockStorageImpl> block_storage;
+  std::vector<BlockHash> hashes;
+};
+
+/// Random range of `count` blocks to serve
+static std::span<const BlockHash> randomRange(Database &database,
+                                              size_t count) {
+  static std::mt19937 random{42};
+  auto begin = 1 + random() % (Database::kLength - count);
+  return std::span(database.hashes).subspan(begin, count);
+}
+
+/// Response filled by reading each part of each block, as before range reads
+static void pointReads(benchmark::State &state) {
+  auto &database = Database::get();
+  auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    for (auto &hash : randomRange(database, count)) {
+      auto header = database.block_storage->getBlockHeader(hash).value();
+      auto body = database.block_storage->getBlockBody(hash).value();
+      auto justification =
+          database.block_storage->getJustification(hash).value();
+      benchmark::DoNotOptimize(header);
+      benchmark::DoNotOptimize(body);
+      benchmark::DoNotOptimize(justification);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// Response filled by batched range read, decoded as sync observer does
+static void rangeRead(benchmark::State &state) {
+  auto &database = Database::get();
+  auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    auto blocks = database.block_storage
+                      ->getEncodedBlocks(
+                          randomRange(database, count), true, true, true)
+                      .value();
+    for (auto &block : blocks) {
+      auto header = scale::decode<BlockHeader>(*block.header).value();
+      auto body = scale::decode<BlockBody>(*block.body).value();
+      auto justification =
+          scale::decode<Justification>(*block.justification).value();
+      benchmark::DoNotOptimize(header);
+      benchmark::DoNotOptimize(body);
+      benchmark::DoNotOptimize(justification);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(pointReads)->Arg(16)->Arg(64)->Arg(128);
+BENCHMARK(rangeRead)->Arg(16)->Arg(64)->Arg(128);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
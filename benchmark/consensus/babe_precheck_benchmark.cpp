@@ -0,0 +1,158 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <thread>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/post.hpp>
+
+#include "common/worker_thread_pool.hpp"
+#include "consensus/babe/impl/babe_block_validator_impl.hpp"
+#include "consensus/babe/impl/prepare_transcript.hpp"
+#include "consensus/babe/types/seal.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "crypto/random_generator/boost_generator.hpp"
+#include "crypto/sr25519/sr25519_provider_impl.hpp"
+#include "crypto/vrf/vrf_provider_impl.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/consensus/babe/babe_config_repository_mock.hpp"
+#include "mock/core/consensus/timeline/slots_util_mock.hpp"
+#include "mock/core/runtime/babe_api_mock.hpp"
+#include "testutil/lazy.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace babe = kagome::consensus::babe;
+namespace crypto = kagome::crypto;
+using kagome::primitives::BlockHeader;
+using testing::_;
+using testing::Return;
+
+/// Chain segment of `count` blocks of single epoch, sealed by one authority
+struct Segment {
+  explicit Segment(size_t count) {
+    crypto::SecureBuffer<> seed_buf(crypto::Sr25519Seed::size());
+    crypto::BoostRandomGenerator{}.fillRandomly(seed_buf);
+    auto seed = crypto::Sr25519Seed::from(std::move(seed_buf)).value();
+    auto keypair = sr25519_provider->generateKeypair(seed, {}).value();
+
+    auto config = std::make_shared<babe::BabeConfiguration>();
+    config->leadership_rate = {1, 4};
+    config->authorities.emplace_back(
+        babe::Authority{babe::AuthorityId{keypair.public_key}, 1});
+    config->allowed_slots = babe::AllowedSlots::PrimaryAndSecondaryVRF;
+    ON_CALL(*config_repo, config(_, _)).WillByDefault(Return(config));
+    ON_CALL(*slots_util, slotToEpoch(_, _)).WillByDefault(Return(1));
+
+    kagome::primitives::BlockHash parent_hash{};
+    for (size_t number = 1; number <= count + 1; ++number) {
+      kagome::primitives::Transcript transcript;
+      babe::prepareTranscript(transcript, config->randomness, number, 1);
+      babe::BabeBlockHeader babe_header{
+          .slot_assignment_type = babe::SlotType::SecondaryVRF,
+          .authority_index = 0,
+          .slot_number = number,
+          .vrf_output =
+              vrf_provider->signTranscript(transcript, keypair).value(),
+      };
+      BlockHeader header{
+          .number = number,
+          .parent_hash = parent_hash,
+          .digest = {kagome::primitives::PreRuntime{
+              {kagome::primitives::kBabeEngineId,
+               kagome::common::Buffer{scale::encode(babe_header).value()}}}},
+      };
+      kagome::primitives::calculateBlockHash(header, *hasher);
+      babe::Seal seal{
+          sr25519_provider->sign(keypair, header.hash()).value()};
+      header.digest.emplace_back(kagome::primitives::Seal{
+          {kagome::primitives::kBabeEngineId,
+           kagome::common::Buffer{scale::encode(seal).value()}}});
+      kagome::primitives::calculateBlockHash(header, *hasher);
+      parent_hash = header.hash();
+      headers.emplace_back(std::move(header));
+    }
+  }
+
+  std::shared_ptr<crypto::HasherImpl> hasher =
+      std::make_shared<crypto::HasherImpl>();
+  std::shared_ptr<crypto::Sr25519ProviderImpl> sr25519_provider =
+      std::make_shared<crypto::Sr25519ProviderImpl>();
+  std::shared_ptr<crypto::VRFProviderImpl> vrf_provider =
+      std::make_shared<crypto::VRFProviderImpl>(
+          std::make_shared<crypto::BoostRandomGenerator>());
+  std::shared_ptr<kagome::consensus::SlotsUtilMock> slots_util =
+      std::make_shared<testing::NiceMock<kagome::consensus::SlotsUtilMock>>();
+  std::shared_ptr<babe::BabeConfigRepositoryMock> config_repo =
+      std::make_shared<testing::NiceMock<babe::BabeConfigRepositoryMock>>();
+  std::shared_ptr<babe::BabeBlockValidatorImpl> validator =
+      std::make_shared<babe::BabeBlockValidatorImpl>(
+          std::make_shared<
+              testing::NiceMock<kagome::application::AppStateManagerMock>>(),
+          testutil::sptr_to_lazy<kagome::consensus::SlotsUtil>(slots_util),
+          config_repo,
+          hasher,
+          sr25519_provider,
+          vrf_provider,
+          std::make_shared<kagome::runtime::BabeApiMock>(),
+          std::make_shared<
+              kagome::primitives::events::SyncStateSubscriptionEngine>());
+  /// First header is imported ancestor of others
+  std::vector<BlockHeader> headers;
+};
+
+/// Block execution, overlapped by prechecks of next blocks
+static void execute(benchmark::State &state) {
+  std::this_thread::sleep_for(std::chrono::microseconds{state.range(1)});
+}
+
+/// Headers validated in order of import, as without look-ahead
+static void sequential(benchmark::State &state) {
+  Segment segment(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 1; i < segment.headers.size(); ++i) {
+      segment.validator->validateHeader(segment.headers[i]).value();
+      execute(state);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Seal and VRF of next blocks are checked on worker pool ahead of import
+static void lookAhead(benchmark::State &state) {
+  Segment segment(state.range(0));
+  auto watchdog = std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  {
+    kagome::common::WorkerThreadPool worker_thread_pool(
+        watchdog, std::max<size_t>(2, std::thread::hardware_concurrency()));
+    constexpr size_t kAhead = 32;
+    for (auto _ : state) {
+      size_t prechecked = 1;
+      for (size_t i = 1; i < segment.headers.size(); ++i) {
+        for (; prechecked < segment.headers.size() and prechecked < i + kAhead;
+             ++prechecked) {
+          auto precheck = segment.validator->precheckHeader(
+              segment.headers[prechecked], segment.headers[0]);
+          boost::asio::post(*worker_thread_pool.io_context(),
+                            std::move(precheck.value()));
+        }
+        segment.validator->validateHeader(segment.headers[i]).value();
+        execute(state);
+      }
+    }
+    watchdog->stop();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sequential)->Args({256, 0})->Args({256, 500})->UseRealTime();
+BENCHMARK(lookAhead)->Args({256, 0})->Args({256, 500})->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "consensus/grandpa/impl/justification_verifier.hpp"
+#include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
+#include "consensus/grandpa/voter_set.hpp"
+#include "crypto/ed25519/ed25519_provider_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace crypto = kagome::crypto;
+namespace grandpa = kagome::consensus::grandpa;
+
+/// Justification of `voters` precommits with same shape as warp sync ones
+struct JustificationBenchmark {
+  explicit JustificationBenchmark(size_t voters) {
+    authorities.id = 1;
+    justification.round_number = 1000;
+    justification.block_info = {100, kagome::common::Hash256{}};
+    justification.block_info.hash[0] = 1;
+    for (size_t i = 0; i < voters; ++i) {
+      kagome::common::Hash256 seed_bytes;
+      seed_bytes[0] = i;
+      seed_bytes[1] = i >> 8;
+      auto keypair = ed_provider
+                         ->generateKeypair(crypto::Ed25519Seed::from(
+                                               crypto::SecureCleanGuard{
+                                                   seed_bytes}),
+                                           {})
+                         .value();
+      authorities.authorities.emplace_back(
+          grandpa::Authority{.id = keypair.public_key, .weight = 1});
+      grandpa::Precommit precommit{justification.block_info.number,
+                                   justification.block_info.hash};
+      auto payload = scale::encode(grandpa::Vote{precommit},
+                                   justification.round_number,
+                                   authorities.id)
+                         .value();
+      grandpa::SignedPrecommit commit;
+      commit.message = precommit;
+      commit.signature = ed_provider->sign(keypair, payload).value();
+      commit.id = keypair.public_key;
+      justification.items.emplace_back(std::move(commit));
+    }
+  }
+
+  std::shared_ptr<crypto::HasherImpl> hasher =
+      std::make_shared<crypto::HasherImpl>();
+  std::shared_ptr<crypto::Ed25519ProviderImpl> ed_provider =
+      std::make_shared<crypto::Ed25519ProviderImpl>(hasher);
+  std::shared_ptr<kagome::blockchain::BlockTreeMock> block_tree =
+      std::make_shared<kagome::blockchain::BlockTreeMock>();
+  grandpa::AuthoritySet authorities;
+  grandpa::GrandpaJustification justification;
+};
+
+/// Precommits verified one by one, as voting round does
+static void sequential(benchmark::State &state) {
+  JustificationBenchmark benchmark(state.range(0));
+  auto voters = grandpa::VoterSet::make(benchmark.authorities).value();
+  grandpa::VoteCryptoProviderImpl vote_crypto_provider(
+      nullptr,
+      benchmark.ed_provider,
+      benchmark.justification.round_number,
+      voters);
+  for (auto _ : state) {
+    for (auto &precommit : benchmark.justification.items) {
+      auto valid = vote_crypto_provider.verifyPrecommit(precommit);
+      benchmark::DoNotOptimize(valid);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/// Precommits verified by JustificationVerifier using worker pool
+static void verifier(benchmark::State &state) {
+  JustificationBenchmark benchmark(state.range(0));
+  auto watchdog = std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  {
+    kagome::common::WorkerThreadPool worker_thread_pool(
+        watchdog, std::max<size_t>(2, std::thread::hardware_concurrency()));
+    grandpa::JustificationVerifier verifier(benchmark.hasher,
+                                            benchmark.ed_provider,
+                                            benchmark.block_tree,
+                                            worker_thread_pool);
+    for (auto _ : state) {
+      verifier.verify(benchmark.justification, benchmark.authorities).value();
+    }
+    watchdog->stop();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(sequential)->Arg(300)->Arg(1000);
+BENCHMARK(verifier)->Arg(300)->Arg(1000)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
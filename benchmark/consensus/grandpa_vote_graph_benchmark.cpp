@@ -0,0 +1,160 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <random>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include "consensus/grandpa/chain.hpp"
+#include "consensus/grandpa/impl/vote_tracker_impl.hpp"
+#include "consensus/grandpa/vote_graph/vote_graph_impl.hpp"
+#include "consensus/grandpa/voter_set.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace grandpa = kagome::consensus::grandpa;
+using kagome::primitives::BlockHash;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::BlockNumber;
+
+/// In-memory block tree: `forks` branches of `depth` blocks from base
+struct ForkedChain : grandpa::Chain {
+  ForkedChain(size_t forks, size_t depth) {
+    base.hash[0] = 0xff;
+    parents.emplace(base.hash, BlockInfo{});
+    for (size_t fork = 0; fork < forks; ++fork) {
+      auto parent = base;
+      for (size_t i = 1; i <= depth; ++i) {
+        BlockInfo block{base.number + i, {}};
+        block.hash[0] = fork;
+        block.hash[1] = fork >> 8;
+        block.hash[2] = i;
+        block.hash[3] = i >> 8;
+        parents.emplace(block.hash, parent);
+        parent = block;
+      }
+      tips.emplace_back(parent);
+    }
+  }
+
+  bool hasBlock(const BlockHash &block) const override {
+    return parents.contains(block);
+  }
+
+  outcome::result<std::vector<BlockHash>> getAncestry(
+      const BlockHash &base_hash, const BlockHash &block) const override {
+    std::vector<BlockHash> ancestry{block};
+    for (auto hash = block; hash != base_hash;) {
+      hash = parents.at(hash).hash;
+      ancestry.emplace_back(hash);
+    }
+    return ancestry;
+  }
+
+  bool hasAncestry(const BlockHash &base_hash,
+                   const BlockHash &block) const override {
+    for (auto hash = block; hash != BlockHash{};
+         hash = parents.at(hash).hash) {
+      if (hash == base_hash) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  outcome::result<BlockInfo> bestChainContaining(
+      const BlockHash &, std::optional<grandpa::VoterSetId>) const override {
+    return tips.front();
+  }
+
+  BlockInfo base{100, {}};
+  std::unordered_map<BlockHash, BlockInfo> parents;
+  std::vector<BlockInfo> tips;
+};
+
+/**
+ * Replays round with 1000 voters: every voter prevotes and precommits for
+ * block on random fork, some of them equivocate. Ghost is recomputed after
+ * each vote, as voting round does.
+ */
+static void replayRound(benchmark::State &state) {
+  constexpr size_t kVoters = 1000;
+  constexpr size_t kDepth = 16;
+  constexpr size_t kEquivocatorEach = 50;
+  auto forks = static_cast<size_t>(state.range(0));
+
+  auto chain = std::make_shared<ForkedChain>(forks, kDepth);
+  grandpa::AuthoritySet authorities;
+  std::vector<grandpa::Id> ids;
+  for (size_t i = 0; i < kVoters; ++i) {
+    grandpa::Id id;
+    id[0] = i;
+    id[1] = i >> 8;
+    ids.emplace_back(id);
+    authorities.authorities.emplace_back(
+        grandpa::Authority{.id = id, .weight = 1});
+  }
+  auto voter_set = grandpa::VoterSet::make(authorities).value();
+  auto threshold = kVoters - (kVoters - 1) / 3;
+
+  // most of voters prefer first fork, so ghost moves along it
+  std::mt19937 random{42};
+  std::vector<BlockInfo> targets;
+  for (size_t i = 0; i < kVoters; ++i) {
+    auto &tip = random() % 4 == 0 ? chain->tips[random() % forks]
+                                  : chain->tips.front();
+    auto number = chain->base.number + 1 + random() % kDepth;
+    auto block = tip;
+    while (block.number > number) {
+      block = chain->parents.at(block.hash);
+    }
+    targets.emplace_back(block);
+  }
+
+  for (auto _ : state) {
+    grandpa::VoteGraphImpl graph(chain->base, voter_set, chain);
+    grandpa::VoteTrackerImpl prevotes;
+    grandpa::VoteTrackerImpl precommits;
+    grandpa::VoterBitset equivocators(kVoters);
+    auto condition = [&](const grandpa::VoteWeight &weight) {
+      return weight.total(grandpa::VoteType::Prevote, equivocators, *voter_set)
+          >= threshold;
+    };
+    for (size_t i = 0; i < kVoters; ++i) {
+      grandpa::SignedMessage vote{
+          .message = grandpa::Prevote{targets[i].number, targets[i].hash},
+          .id = ids[i]};
+      prevotes.push(vote, 1);
+      graph.insert(grandpa::VoteType::Prevote, targets[i], ids[i]).value();
+      if (i % kEquivocatorEach == 0) {
+        auto &other = chain->tips[i % forks];
+        vote.message = grandpa::Prevote{other.number, other.hash};
+        if (prevotes.push(vote, 1)
+            == grandpa::VoteTracker::PushResult::EQUIVOCATED) {
+          equivocators.set(i);
+          graph.remove(grandpa::VoteType::Prevote, ids[i]);
+        }
+      }
+      precommits.push({.message = grandpa::Precommit{targets[i].number,
+                                                     targets[i].hash},
+                       .id = ids[i]},
+                      1);
+      auto ghost = graph.findGhost(
+          grandpa::VoteType::Prevote, std::nullopt, condition);
+      benchmark::DoNotOptimize(ghost);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kVoters);
+}
+
+BENCHMARK(replayRound)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <deque>
+
+#include <benchmark/benchmark.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "crypto/random_generator/boost_generator.hpp"
+#include "crypto/sr25519/sr25519_batch_verifier.hpp"
+#include "crypto/sr25519/sr25519_provider_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+namespace crypto = kagome::crypto;
+
+struct SignedMessages {
+  explicit SignedMessages(size_t count) {
+    crypto::BoostRandomGenerator random;
+    for (size_t i = 0; i < count; ++i) {
+      crypto::SecureBuffer<> seed_buf(crypto::Sr25519Seed::size());
+      random.fillRandomly(seed_buf);
+      auto seed = crypto::Sr25519Seed::from(std::move(seed_buf)).value();
+      auto keypair = provider->generateKeypair(seed, {}).value();
+      auto &message = messages.emplace_back(128, static_cast<uint8_t>(i));
+      items.emplace_back(crypto::Sr25519VerifyItem{
+          .signature = provider->sign(keypair, message).value(),
+          .message = message,
+          .public_key = keypair.public_key,
+      });
+    }
+  }
+
+  std::shared_ptr<crypto::Sr25519ProviderImpl> provider =
+      std::make_shared<crypto::Sr25519ProviderImpl>();
+  std::deque<kagome::common::Buffer> messages;
+  std::vector<crypto::Sr25519VerifyItem> items;
+};
+
+/// Signatures verified by single `verifyBatch` call per batch
+static void verifyBatch(benchmark::State &state) {
+  SignedMessages signed_messages(state.range(0));
+  for (auto _ : state) {
+    auto valid = signed_messages.provider->verifyBatch(signed_messages.items);
+    benchmark::DoNotOptimize(valid);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Same signatures verified one by one
+static void verifyEach(benchmark::State &state) {
+  SignedMessages signed_messages(state.range(0));
+  for (auto _ : state) {
+    for (auto &item : signed_messages.items) {
+      auto valid = signed_messages.provider->verify(
+          item.signature, item.message, item.public_key);
+      benchmark::DoNotOptimize(valid);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Signatures pushed through micro-batching stage verified on worker pool
+static void batchVerifier(benchmark::State &state) {
+  constexpr size_t kSignatures = 1024;
+  SignedMessages signed_messages(kSignatures);
+  auto watchdog = std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  auto owner = std::make_shared<boost::asio::io_context>();
+  {
+    kagome::common::WorkerThreadPool worker_thread_pool(
+        watchdog, std::max<size_t>(2, std::thread::hardware_concurrency()));
+    auto verifier = std::make_shared<crypto::Sr25519BatchVerifier>(
+        signed_messages.provider,
+        owner,
+        worker_thread_pool.handlerStarted(),
+        crypto::Sr25519BatchVerifier::Config{
+            .max_batch = static_cast<size_t>(state.range(0)),
+        });
+    for (auto _ : state) {
+      size_t done = 0;
+      boost::asio::post(*owner, [&] {
+        for (auto &item : signed_messages.items) {
+          verifier->push(item.signature,
+                         kagome::common::Buffer{item.message},
+                         item.public_key,
+                         [&](bool) { ++done; });
+        }
+        verifier->flush();
+      });
+      while (done != kSignatures) {
+        owner->run_one();
+      }
+      owner->restart();
+    }
+    watchdog->stop();
+  }
+  state.SetItemsProcessed(state.iterations() * kSignatures);
+}
+
+BENCHMARK(verifyBatch)->Arg(1)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(verifyEach)->Arg(1)->Arg(16)->Arg(64)->Arg(256);
+BENCHMARK(batchVerifier)->Arg(1)->Arg(16)->Arg(64)->Arg(256)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "offchain/impl/http_request.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/watchdog.hpp"
+
+using kagome::offchain::HttpConnectionPool;
+using kagome::offchain::HttpMethod;
+using kagome::offchain::HttpRequest;
+using kagome::offchain::OcwHttpThreadPool;
+using kagome::offchain::RequestId;
+namespace http = boost::beast::http;
+using boost::asio::ip::tcp;
+
+/// Local keep-alive HTTP server answering after `delay`
+struct LocalServer {
+  explicit LocalServer(std::chrono::microseconds delay) : delay{delay} {
+    acceptor.open(tcp::v4());
+    acceptor.bind({boost::asio::ip::make_address("127.0.0.1"), 0});
+    acceptor.listen();
+    accept_thread = std::thread{[this] {
+      while (true) {
+        tcp::socket socket{io};
+        boost::system::error_code ec;
+        acceptor.accept(socket, ec);
+        if (ec or stopped) {
+          return;
+        }
+        threads.emplace_back(
+            [this, socket{std::move(socket)}]() mutable { serve(socket); });
+      }
+    }};
+  }
+
+  ~LocalServer() {
+    stopped = true;
+    tcp::socket socket{io};
+    boost::system::error_code ec;
+    socket.connect(acceptor.local_endpoint(), ec);
+    accept_thread.join();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  void serve(tcp::socket &socket) {
+    boost::beast::flat_buffer buffer;
+    while (true) {
+      http::request<http::string_body> req;
+      boost::system::error_code ec;
+      http::read(socket, buffer, req, ec);
+      if (ec) {
+        return;
+      }
+      std::this_thread::sleep_for(delay);
+      http::response<http::string_body> res{http::status::ok, req.version()};
+      res.body() = "pong";
+      res.keep_alive(req.keep_alive());
+      res.prepare_payload();
+      http::write(socket, res, ec);
+      if (ec or not req.keep_alive()) {
+        return;
+      }
+    }
+  }
+
+  std::chrono::microseconds delay;
+  boost::asio::io_context io;
+  tcp::acceptor acceptor{io};
+  std::atomic_bool stopped = false;
+  std::thread accept_thread;
+  std::vector<std::thread> threads;
+};
+
+/**
+ * Starts `range(0)` requests to server answering after 1ms and waits for
+ * all of them, as `httpResponseWait` does.
+ * Cpu time is time spent by waiting thread.
+ */
+static void wait(benchmark::State &state) {
+  auto requests = static_cast<RequestId>(state.range(0));
+  auto watchdog = std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  {
+    LocalServer server{std::chrono::milliseconds(1)};
+    auto url = fmt::format("http://127.0.0.1:{}/",
+                           server.acceptor.local_endpoint().port());
+    OcwHttpThreadPool thread_pool{watchdog};
+    auto connections = std::make_shared<HttpConnectionPool>(thread_pool);
+    RequestId id = 0;
+    for (auto _ : state) {
+      std::vector<std::shared_ptr<HttpRequest>> pending;
+      for (RequestId i = 0; i < requests; ++i) {
+        auto request = std::make_shared<HttpRequest>(++id, connections);
+        request->init(HttpMethod::Get, url, {});
+        request->writeRequestBody({}, std::nullopt);
+        pending.emplace_back(std::move(request));
+      }
+      for (auto &request : pending) {
+        auto status = request->wait(std::nullopt);
+        benchmark::DoNotOptimize(status);
+      }
+    }
+    watchdog->stop();
+  }
+  state.SetItemsProcessed(state.iterations() * requests);
+}
+
+BENCHMARK(wait)->Arg(1)->Arg(8)->Arg(32)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "parachain/approval/knowledge.hpp"
+
+namespace approval = kagome::parachain::approval;
+
+/**
+ * Replays knowledge tracking of one relay block in a high-load session:
+ * every validator sends assignment for a few of the cores and approvals for
+ * them, each message is imported from one peer and circulated to the others.
+ */
+static void replayBlock(benchmark::State &state) {
+  constexpr size_t kValidators = 1000;
+  constexpr size_t kCores = 50;
+  constexpr size_t kClaimedCores = 3;
+  auto peers = static_cast<size_t>(state.range(0));
+
+  kagome::common::Hash256 block_hash;
+  std::mt19937 random{42};
+  std::vector<approval::MessageSubject> subjects;
+  std::vector<size_t> sources;
+  for (size_t validator = 0; validator < kValidators; ++validator) {
+    scale::BitVec claimed;
+    claimed.bits.resize(kCores);
+    for (size_t i = 0; i < kClaimedCores; ++i) {
+      claimed.bits[random() % kCores] = true;
+    }
+    subjects.emplace_back(block_hash, std::move(claimed), validator);
+    sources.emplace_back(random() % peers);
+  }
+
+  for (auto _ : state) {
+    approval::Knowledge knowledge;
+    std::vector<approval::PeerKnowledge> known_by(peers);
+    size_t sent = 0;
+    for (auto kind :
+         {approval::MessageKind::Assignment, approval::MessageKind::Approval}) {
+      for (size_t i = 0; i < subjects.size(); ++i) {
+        auto &subject = subjects[i];
+        auto &source = known_by[sources[i]];
+        if (source.contains(subject, kind)) {
+          continue;
+        }
+        source.received.insert(subject, kind);
+        if (not knowledge.insert(subject, kind)) {
+          continue;
+        }
+        for (auto &peer_knowledge : known_by) {
+          if (peer_knowledge.markSent(subject, kind)) {
+            ++sent;
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sent);
+  }
+  state.SetItemsProcessed(state.iterations() * kValidators * 2 * peers);
+}
+
+BENCHMARK(replayBlock)->Arg(25)->Arg(100);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,146 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <filesystem>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "common/bytestr.hpp"
+#include "common/hexutil.hpp"
+#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "runtime/wabt/instrument.hpp"
+#include "runtime/wabt/stack_limiter.hpp"
+#include "runtime/wabt/util.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "utils/read_file.hpp"
+
+using kagome::common::Buffer;
+using kagome::runtime::RuntimeContext;
+namespace runtime = kagome::runtime;
+
+/**
+ * Reads runtime code, which may be zstd compressed and hex encoded (as in
+ * chain spec).
+ */
+Buffer readRuntime(const std::filesystem::path &path) {
+  std::string raw;
+  kagome::readFile(raw, path).value();
+  Buffer code{kagome::str2byte(raw)};
+  if (raw.starts_with("0x")) {
+    code = Buffer{kagome::common::unhexWith0x(raw).value()};
+  }
+  return runtime::uncompressCodeIfNeeded(code).value();
+}
+
+RuntimeContext::ContextParams stackLimit(uint32_t stack) {
+  RuntimeContext::ContextParams config;
+  config.memory_limits.max_stack_values_num = stack;
+  return config;
+}
+
+/// Decode, analyze, instrument and encode, as before caching
+void uncached(benchmark::State &state, const Buffer &code) {
+  auto config = stackLimit(65536);
+  for (auto _ : state) {
+    auto r = runtime::instrumentCodeForCompilation(code, config).value();
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+/// Worker pool for function analysis
+static boost::asio::io_context worker_io;
+
+/// Function analysis only, on calling thread
+void stackCosts(benchmark::State &state, const Buffer &code) {
+  auto module = runtime::wabtDecode(code, {}).value();
+  for (auto _ : state) {
+    auto r = runtime::computeStackCosts(module).value();
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+/// Function analysis only, on worker pool too
+void stackCostsPool(benchmark::State &state, const Buffer &code) {
+  auto module = runtime::wabtDecode(code, {}).value();
+  for (auto _ : state) {
+    auto r = runtime::computeStackCosts(module, &worker_io).value();
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+/// Same code with new stack limit every time (e.g. PVF executor params)
+void otherLimits(benchmark::State &state, const Buffer &code) {
+  runtime::WasmInstrumenter instrumenter;
+  uint32_t stack = 65536;
+  instrumenter.instrument(code, stackLimit(stack)).value();
+  for (auto _ : state) {
+    auto r = instrumenter.instrument(code, stackLimit(++stack)).value();
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+/// Same code and limits
+void cached(benchmark::State &state, const Buffer &code) {
+  runtime::WasmInstrumenter instrumenter;
+  auto config = stackLimit(65536);
+  instrumenter.instrument(code, config).value();
+  for (auto _ : state) {
+    auto r = instrumenter.instrument(code, config).value();
+    benchmark::DoNotOptimize(r);
+  }
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+/**
+ * Usage: instrument_benchmark [benchmark flags] [runtime.wasm...]
+ * Pass Polkadot and parachain runtimes (raw, zstd or hex from chain spec),
+ * by default runtimes from repository are used.
+ */
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  auto work_guard = boost::asio::make_work_guard(worker_io);
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::thread::hardware_concurrency(); ++i) {
+    workers.emplace_back([] { worker_io.run(); });
+  }
+  std::vector<std::filesystem::path> paths{argv + 1, argv + argc};
+  if (paths.empty()) {
+    auto root = std::filesystem::path{__FILE__}.parent_path() / "../..";
+    paths = {
+        root / "test/core/runtime/wasm/sub2dev.wasm",
+        root / "examples/adder-collator/adder.wasm",
+    };
+  }
+  for (auto &path : paths) {
+    auto code = readRuntime(path);
+    for (auto [label, f] : {
+             std::pair{"uncached", uncached},
+             std::pair{"stackCosts", stackCosts},
+             std::pair{"stackCostsPool", stackCostsPool},
+             std::pair{"otherLimits", otherLimits},
+             std::pair{"cached", cached},
+         }) {
+      auto name = fmt::format("{}/{}", label, path.filename().string());
+      // code is copied into benchmark
+      benchmark::RegisterBenchmark(name.c_str(), f, code)
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  work_guard.reset();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  return 0;
+}
@@ -0,0 +1,235 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "common/monadic_utils.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "host_api/impl/storage_extension.hpp"
+#include "mock/core/host_api/host_api_mock.hpp"
+#include "mock/core/runtime/memory_provider_mock.hpp"
+#include "mock/core/runtime/trie_storage_provider_mock.hpp"
+#include "mock/core/storage/trie/polkadot_trie_cursor_mock.h"
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "runtime/binaryen/memory_impl.hpp"
+#include "runtime/binaryen/runtime_external_interface.hpp"
+#include "runtime/common/memory_allocator.hpp"
+#include "runtime/wasm_compiler_definitions.hpp"  // this header-file is generated
+#include "storage/trie/impl/topper_trie_batch_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+#if KAGOME_WASM_COMPILER_WAVM == 1
+#include "runtime/wavm/compartment_wrapper.hpp"
+#include "runtime/wavm/intrinsics/intrinsic_module.hpp"
+#include "runtime/wavm/intrinsics/intrinsic_module_instance.hpp"
+#include "runtime/wavm/memory_impl.hpp"
+#include "runtime/wavm/module_params.hpp"
+#endif
+
+#if KAGOME_WASM_COMPILER_WASM_EDGE == 1
+#include "runtime/wasm_edge/memory_impl.hpp"
+#endif
+
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::host_api::StorageExtension;
+using kagome::runtime::Memory;
+using kagome::runtime::MemoryConfig;
+using kagome::runtime::PtrSize;
+using kagome::runtime::WasmSpan;
+using testing::_;
+using testing::Return;
+namespace runtime = kagome::runtime;
+namespace storage = kagome::storage;
+
+/// Memory of particular engine with everything it depends on
+struct EngineMemory {
+  virtual ~EngineMemory() = default;
+
+  void init(std::shared_ptr<runtime::MemoryHandle> handle) {
+    auto allocator = std::make_unique<runtime::MemoryAllocatorImpl>(
+        handle, MemoryConfig{runtime::kDefaultHeapBase});
+    memory = std::make_unique<Memory>(handle, std::move(allocator));
+  }
+
+  std::unique_ptr<Memory> memory;
+};
+
+struct BinaryenMemory : EngineMemory {
+  BinaryenMemory() {
+    rei = std::make_unique<runtime::binaryen::RuntimeExternalInterface>(
+        std::make_shared<kagome::host_api::HostApiMock>());
+    init(std::make_shared<runtime::binaryen::MemoryImpl>(rei->getMemory()));
+  }
+
+  std::unique_ptr<runtime::binaryen::RuntimeExternalInterface> rei;
+};
+
+#if KAGOME_WASM_COMPILER_WAVM == 1
+struct WavmMemory : EngineMemory {
+  WavmMemory() {
+    using namespace runtime::wavm;
+    auto compartment =
+        std::make_shared<CompartmentWrapper>("Storage host call benchmark");
+    auto module_params = std::make_shared<ModuleParams>();
+    auto module = std::make_shared<IntrinsicModule>(
+        compartment, module_params->intrinsicMemoryType);
+    // intrinsic module can't be instantiated without functions
+    module->addFunction(
+        "stub",
+        static_cast<void (*)(WAVM::Runtime::ContextRuntimeData *)>(
+            [](WAVM::Runtime::ContextRuntimeData *) {}),
+        WAVM::IR::FunctionType{});
+    instance = module->instantiate();
+    init(std::make_shared<MemoryImpl>(instance->getExportedMemory()));
+  }
+
+  ~WavmMemory() override {
+    memory.reset();
+  }
+
+  std::unique_ptr<runtime::wavm::IntrinsicModuleInstance> instance;
+};
+#endif
+
+#if KAGOME_WASM_COMPILER_WASM_EDGE == 1
+struct WasmEdgeMemory : EngineMemory {
+  WasmEdgeMemory() {
+    WasmEdge_Limit limit{};
+    limit.Min = 20;
+    type = WasmEdge_MemoryTypeCreate(limit);
+    instance = WasmEdge_MemoryInstanceCreate(type);
+    init(std::make_shared<runtime::wasm_edge::MemoryImpl>(instance));
+  }
+
+  ~WasmEdgeMemory() override {
+    memory.reset();
+    WasmEdge_MemoryInstanceDelete(instance);
+    WasmEdge_MemoryTypeDelete(type);
+  }
+
+  WasmEdge_MemoryTypeContext *type;
+  WasmEdge_MemoryInstanceContext *instance;
+};
+#endif
+
+/// Storage extension with `value_size` bytes value stored in overlay
+template <typename Engine>
+struct HostCall {
+  explicit HostCall(size_t value_size) : value(value_size, 0xab) {
+    parent =
+        std::make_shared<testing::NiceMock<storage::trie::TrieBatchMock>>();
+    batch = std::make_shared<storage::trie::TopperTrieBatchImpl>(parent);
+    batch->put(key, value).value();
+    ON_CALL(*parent, trieCursor()).WillByDefault([this] {
+      auto cursor = std::make_unique<
+          testing::NiceMock<storage::trie::PolkadotTrieCursorMock>>();
+      ON_CALL(*cursor, seekUpperBound(_))
+          .WillByDefault(Return(outcome::success()));
+      ON_CALL(*cursor, key()).WillByDefault(Return(value));
+      return cursor;
+    });
+    ON_CALL(*storage_provider, getCurrentBatch()).WillByDefault(Return(batch));
+    ON_CALL(*memory_provider, getCurrentMemory())
+        .WillByDefault(Return(std::ref(memory())));
+    key_span = memory().storeBuffer(key);
+    value_out = PtrSize{memory().allocate(value_size), uint32_t(value_size)};
+  }
+
+  Memory &memory() {
+    return *engine.memory;
+  }
+
+  /// Frees result of host call, as runtime does
+  void free(WasmSpan span) {
+    memory().deallocate(PtrSize{span}.ptr);
+  }
+
+  Engine engine;
+  Buffer key = Buffer::fromString("key");
+  Buffer value;
+  std::shared_ptr<storage::trie::TrieBatchMock> parent;
+  std::shared_ptr<storage::trie::TopperTrieBatchImpl> batch;
+  std::shared_ptr<runtime::TrieStorageProviderMock> storage_provider =
+      std::make_shared<testing::NiceMock<runtime::TrieStorageProviderMock>>();
+  std::shared_ptr<runtime::MemoryProviderMock> memory_provider =
+      std::make_shared<testing::NiceMock<runtime::MemoryProviderMock>>();
+  StorageExtension extension{storage_provider,
+                             memory_provider,
+                             std::make_shared<kagome::crypto::HasherImpl>()};
+  WasmSpan key_span;
+  PtrSize value_out;
+};
+
+/// Value is encoded into temporary buffer and copied, as before
+template <typename Engine>
+static void getEncodeCopy(benchmark::State &state) {
+  HostCall<Engine> call(state.range(0));
+  for (auto _ : state) {
+    auto &memory = call.memory();
+    auto key = memory.loadN(PtrSize{call.key_span}.ptr, call.key.size());
+    auto value = call.batch->tryGet(key).value();
+    auto span = memory.storeBuffer(
+        scale::encode(kagome::common::map_optional(value, [](auto &r) {
+          return r.view();
+        })).value());
+    call.free(span);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Engine>
+static void storageGet(benchmark::State &state) {
+  HostCall<Engine> call(state.range(0));
+  for (auto _ : state) {
+    call.free(call.extension.ext_storage_get_version_1(call.key_span));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Engine>
+static void storageRead(benchmark::State &state) {
+  HostCall<Engine> call(state.range(0));
+  for (auto _ : state) {
+    call.free(call.extension.ext_storage_read_version_1(
+        call.key_span, call.value_out.combine(), 0));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Engine>
+static void storageNextKey(benchmark::State &state) {
+  HostCall<Engine> call(state.range(0));
+  for (auto _ : state) {
+    call.free(call.extension.ext_storage_next_key_version_1(call.key_span));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/// Value sizes from small item to runtime code sized blob
+#define STORAGE_HOST_CALL_BENCHMARK(name, Engine) \
+  BENCHMARK_TEMPLATE(name, Engine)->RangeMultiplier(32)->Range(32, 1 << 15)
+
+#define STORAGE_HOST_CALL_BENCHMARKS(Engine)             \
+  STORAGE_HOST_CALL_BENCHMARK(getEncodeCopy, Engine);    \
+  STORAGE_HOST_CALL_BENCHMARK(storageGet, Engine);       \
+  STORAGE_HOST_CALL_BENCHMARK(storageRead, Engine);      \
+  STORAGE_HOST_CALL_BENCHMARK(storageNextKey, Engine)
+
+STORAGE_HOST_CALL_BENCHMARKS(BinaryenMemory);
+#if KAGOME_WASM_COMPILER_WAVM == 1
+STORAGE_HOST_CALL_BENCHMARKS(WavmMemory);
+#endif
+#if KAGOME_WASM_COMPILER_WASM_EDGE == 1
+STORAGE_HOST_CALL_BENCHMARKS(WasmEdgeMemory);
+#endif
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "scale/encode_append.hpp"
+#include "storage/trie/impl/topper_trie_batch_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::storage::trie::TopperTrieBatchImpl;
+using kagome::storage::trie::TrieBatchMock;
+using testing::Return;
+
+/// Number of events appended during block, size of each event
+constexpr size_t kEvents = 10000;
+constexpr size_t kEventSize = 100;
+
+/// Empty parent batch, as block state before first event
+static std::shared_ptr<TrieBatchMock> makeParent() {
+  auto parent = std::make_shared<testing::NiceMock<TrieBatchMock>>();
+  ON_CALL(*parent, tryGetMock(testing::_))
+      .WillByDefault(Return(std::optional<Buffer>{}));
+  ON_CALL(*parent, contains(testing::_)).WillByDefault(Return(false));
+  return parent;
+}
+
+static const Buffer kKey = Buffer::fromString("events");
+static const Buffer kEvent(std::vector<uint8_t>(kEventSize, 0xee));
+
+/// Value is read, copied, extended and put back, as before
+static void getAppendPut(benchmark::State &state) {
+  auto parent = makeParent();
+  for (auto _ : state) {
+    auto batch = std::make_shared<TopperTrieBatchImpl>(parent);
+    for (size_t i = 0; i < kEvents; ++i) {
+      auto value = batch->tryGet(kKey).value();
+      Buffer copy = value ? Buffer{*value} : Buffer{};
+      scale::append_or_new_vec(copy.asVector(), kEvent).value();
+      batch->put(kKey, std::move(copy)).value();
+    }
+    benchmark::DoNotOptimize(batch);
+  }
+  state.SetItemsProcessed(state.iterations() * kEvents);
+}
+
+/// Value is extended in place
+static void topperAppend(benchmark::State &state) {
+  auto parent = makeParent();
+  for (auto _ : state) {
+    auto batch = std::make_shared<TopperTrieBatchImpl>(parent);
+    for (size_t i = 0; i < kEvents; ++i) {
+      batch->append(kKey, kEvent).value();
+    }
+    benchmark::DoNotOptimize(batch);
+  }
+  state.SetItemsProcessed(state.iterations() * kEvents);
+}
+
+/// Each event is appended in own storage transaction, as extrinsics do
+static void nestedAppend(benchmark::State &state) {
+  auto parent = makeParent();
+  for (auto _ : state) {
+    auto batch = std::make_shared<TopperTrieBatchImpl>(parent);
+    for (size_t i = 0; i < kEvents; ++i) {
+      auto transaction = std::make_shared<TopperTrieBatchImpl>(batch);
+      transaction->append(kKey, kEvent).value();
+      transaction->writeBack().value();
+    }
+    benchmark::DoNotOptimize(batch);
+  }
+  state.SetItemsProcessed(state.iterations() * kEvents);
+}
+
+BENCHMARK(getAppendPut);
+BENCHMARK(topperAppend);
+BENCHMARK(nestedAppend);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "storage/trie/impl/shared_trie_batch_impl.hpp"
+#include "storage/trie/impl/topper_trie_batch_impl.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::storage::InMemorySpacedStorage;
+using kagome::storage::trie::PolkadotCodec;
+using kagome::storage::trie::PolkadotTrieFactoryImpl;
+using kagome::storage::trie::RootHash;
+using kagome::storage::trie::SharedTrieBatchImpl;
+using kagome::storage::trie::SharedTrieState;
+using kagome::storage::trie::StateVersion;
+using kagome::storage::trie::TopperTrieBatchImpl;
+using kagome::storage::trie::TrieBatch;
+using kagome::storage::trie::TrieSerializerImpl;
+using kagome::storage::trie::TrieStorage;
+using kagome::storage::trie::TrieStorageBackendImpl;
+using kagome::storage::trie::TrieStorageImpl;
+using kagome::storage::trie_pruner::TriePrunerMock;
+using testing::Return;
+
+/// Number of accounts in state, size of account value
+constexpr size_t kAccounts = 100000;
+constexpr size_t kValueSize = 80;
+/// Number of reads of single runtime call, like
+/// `TransactionPaymentApi_query_info`
+constexpr size_t kReads = 50;
+
+static std::shared_ptr<TrieStorage> trie;
+static RootHash root;
+static std::shared_ptr<SharedTrieState> shared;
+
+static Buffer makeKey(size_t i) {
+  Buffer key;
+  key.putUint64(i * 0x9e3779b97f4a7c15);
+  key.putUint64(i);
+  return key;
+}
+
+/// Block state with `kAccounts` accounts, stored in database
+static void makeState() {
+  auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+  auto codec = std::make_shared<PolkadotCodec>();
+  auto serializer = std::make_shared<TrieSerializerImpl>(
+      factory,
+      codec,
+      std::make_shared<TrieStorageBackendImpl>(
+          std::make_shared<InMemorySpacedStorage>()));
+  auto state_pruner = std::make_shared<testing::NiceMock<TriePrunerMock>>();
+  ON_CALL(*state_pruner,
+          addNewState(
+              testing::A<const kagome::storage::trie::PolkadotTrie &>(),
+              testing::_))
+      .WillByDefault(Return(outcome::success()));
+  trie = TrieStorageImpl::createEmpty(factory, codec, serializer, state_pruner)
+             .value();
+  auto batch =
+      trie->getPersistentBatchAt(serializer->getEmptyRootHash(), std::nullopt)
+          .value();
+  Buffer value(kValueSize, 0xaa);
+  for (size_t i = 0; i < kAccounts; ++i) {
+    batch->put(makeKey(i), BufferView{value}).value();
+  }
+  root = batch->commit(StateVersion::V1).value();
+  shared = SharedTrieState::create(codec, serializer, root).value();
+}
+
+/// Runtime call reading `kReads` accounts through own overlay
+static void call(const std::shared_ptr<TrieBatch> &base, size_t &next) {
+  TopperTrieBatchImpl overlay{base};
+  for (size_t i = 0; i < kReads; ++i) {
+    auto value = overlay.tryGet(makeKey(next % kAccounts)).value();
+    benchmark::DoNotOptimize(value);
+    next += 7919;
+  }
+}
+
+/// Each call loads and decodes trie nodes into own ephemeral batch, as before
+static void ephemeralBatchPerCall(benchmark::State &state) {
+  size_t next = state.thread_index();
+  for (auto _ : state) {
+    std::shared_ptr<TrieBatch> batch = trie->getEphemeralBatchAt(root).value();
+    call(batch, next);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+/// Calls share trie nodes of block state
+static void sharedState(benchmark::State &state) {
+  size_t next = state.thread_index();
+  for (auto _ : state) {
+    call(std::make_shared<SharedTrieBatchImpl>(shared), next);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(ephemeralBatchPerCall)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(sharedState)->ThreadRange(1, 64)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  makeState();
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,43 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "telemetry/impl/message_pool.hpp"
+#include "telemetry/impl/service_impl.hpp"
+
+using kagome::telemetry::MessagePool;
+
+/// Pool shared by all benchmark threads, as by service and connections
+static MessagePool pool{kagome::telemetry::kTelemetryMessageMaxLengthBytes,
+                        kagome::telemetry::kTelemetryMessagePoolSize};
+
+/**
+ * Pushes typical "block.import" message for 2 connections and releases it
+ * twice, as connections do after write.
+ * Busy validator produces far less than 100k messages/sec, so items/sec
+ * should stay well above it.
+ */
+static void pushRelease(benchmark::State &state) {
+  std::string message = R"({"id":1,"payload":{"best":"0x)"
+                      + std::string(64, 'a')
+                      + R"(","origin":"NetworkBroadcast","height":123456,)"
+                        R"("msg":"block.import"},"ts":)"
+                        R"("2024-01-01T00:00:00.000000+00:00"})";
+  for (auto _ : state) {
+    auto handle = pool.push(message, 2);
+    if (handle) {
+      benchmark::DoNotOptimize(pool[*handle]);
+      pool.release(*handle);
+      pool.release(*handle);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(pushRelease)->Threads(1)->Threads(4);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,133 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/blockchain/block_storage_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/network/transactions_transmitter_mock.hpp"
+#include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
+#include "mock/core/transaction_pool/pool_moderator_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "transaction_pool/impl/transaction_pool_impl.hpp"
+
+using kagome::primitives::Transaction;
+using kagome::transaction_pool::TransactionPoolImpl;
+
+/// Block fits this many transactions, as proposer block size limit does
+constexpr size_t kBlockTransactions = 5000;
+constexpr size_t kSenders = 5000;
+constexpr size_t kNonces = 10;
+
+/**
+ * Pool with 50k ready transactions: chains of `kNonces` transactions of
+ * `kSenders` senders with random priorities
+ */
+struct ReadyPool {
+  ReadyPool() {
+    pool = std::make_shared<TransactionPoolImpl>(
+        std::make_shared<kagome::runtime::TaggedTransactionQueueMock>(),
+        std::make_shared<kagome::crypto::HasherMock>(),
+        std::make_shared<kagome::network::TransactionsTransmitterMock>(),
+        std::make_unique<
+            testing::NiceMock<kagome::transaction_pool::PoolModeratorMock>>(),
+        std::make_shared<kagome::blockchain::BlockHeaderRepositoryMock>(),
+        std::make_shared<kagome::blockchain::BlockStorageMock>(),
+        std::make_shared<
+            kagome::primitives::events::ExtrinsicSubscriptionEngine>(),
+        std::make_shared<kagome::subscription::ExtrinsicEventKeyRepository>(),
+        worker_thread_pool,
+        std::make_shared<kagome::primitives::events::ChainSubscriptionEngine>(),
+        TransactionPoolImpl::Limits{
+            .max_ready_num = kSenders * kNonces,
+            .capacity = kSenders * kNonces,
+        });
+    std::mt19937_64 random{42};
+    for (size_t sender = 0; sender < kSenders; ++sender) {
+      auto tag = [&](size_t nonce) {
+        return Transaction::Tag{static_cast<uint8_t>(sender),
+                                static_cast<uint8_t>(sender >> 8),
+                                static_cast<uint8_t>(nonce)};
+      };
+      for (size_t nonce = 0; nonce < kNonces; ++nonce) {
+        Transaction tx;
+        tx.ext.data.resize(200);
+        tx.bytes = kagome::primitives::encodedSize(tx.ext);
+        tx.hash[0] = sender;
+        tx.hash[1] = sender >> 8;
+        tx.hash[2] = nonce;
+        tx.priority = random() % 1000;
+        tx.valid_till = 1000;
+        tx.provided_tags = {tag(nonce)};
+        if (nonce != 0) {
+          tx.required_tags = {tag(nonce - 1)};
+        }
+        pool->submitOne(std::move(tx)).value();
+      }
+    }
+  }
+
+  kagome::common::WorkerThreadPool worker_thread_pool{
+      kagome::TestThreadPool{}};
+  std::shared_ptr<TransactionPoolImpl> pool;
+};
+
+/// Proposal as before: copy of pool in hash order, encoding each extrinsic
+static void hashOrder(benchmark::State &state) {
+  ReadyPool ready_pool;
+  Transaction::Priority fee = 0;
+  for (auto _ : state) {
+    fee = 0;
+    auto txs = ready_pool.pool->getReadyTransactions();
+    size_t included = 0;
+    for (auto &[hash, tx] : txs) {
+      if (included == kBlockTransactions) {
+        break;
+      }
+      scale::ScaleEncoderStream s(true);
+      s << tx->ext;
+      benchmark::DoNotOptimize(s.size());
+      fee += tx->priority;
+      ++included;
+    }
+  }
+  state.counters["fee"] = static_cast<double>(fee);
+}
+
+/// Proposal with lazy iterator, best first, using cached size
+static void bestFirst(benchmark::State &state) {
+  ReadyPool ready_pool;
+  Transaction::Priority fee = 0;
+  for (auto _ : state) {
+    fee = 0;
+    auto txs = ready_pool.pool->readyTransactions();
+    size_t included = 0;
+    while (auto tx = txs->next()) {
+      if (included == kBlockTransactions) {
+        break;
+      }
+      benchmark::DoNotOptimize(tx->bytes);
+      fee += tx->priority;
+      ++included;
+    }
+  }
+  state.counters["fee"] = static_cast<double>(fee);
+}
+
+BENCHMARK(hashOrder)->Unit(benchmark::kMillisecond);
+BENCHMARK(bestFirst)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
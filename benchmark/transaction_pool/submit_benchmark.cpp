@@ -0,0 +1,135 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/blockchain/block_storage_mock.hpp"
+#include "mock/core/network/transactions_transmitter_mock.hpp"
+#include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
+#include "mock/core/transaction_pool/pool_moderator_mock.hpp"
+#include "testutil/prepare_loggers.hpp"
+#include "transaction_pool/impl/transaction_pool_impl.hpp"
+
+using kagome::primitives::Extrinsic;
+using kagome::primitives::TransactionSource;
+using kagome::transaction_pool::TransactionPoolImpl;
+using TtqMock = testing::NiceMock<kagome::runtime::TaggedTransactionQueueMock>;
+
+/// Transactions in one flood, as large propagated transactions message
+constexpr size_t kFlood = 256;
+
+/// Validation cost of one transaction, as signature check and runtime call
+constexpr auto kValidation = std::chrono::microseconds(100);
+
+/**
+ * Pool with runtime mock spinning `kValidation` per transaction, so that
+ * measurement shows pool throughput without real runtime
+ */
+struct SubmitPool {
+  SubmitPool() {
+    ON_CALL(*ttq, validate_transaction(testing::_, testing::_))
+        .WillByDefault(testing::Invoke([](TransactionSource,
+                                          const Extrinsic &ext) {
+          auto until = std::chrono::steady_clock::now() + kValidation;
+          while (std::chrono::steady_clock::now() < until) {
+          }
+          kagome::primitives::ValidTransaction valid;
+          valid.provided_tags = {ext.data};
+          valid.longevity = 100;
+          return kagome::runtime::TaggedTransactionQueue::TransactionValidityAt{
+              {}, valid};
+        }));
+  }
+
+  /// Fresh pool for each flood, so nothing is already imported
+  std::shared_ptr<TransactionPoolImpl> makePool() {
+    return std::make_shared<TransactionPoolImpl>(
+        ttq,
+        std::make_shared<kagome::crypto::HasherImpl>(),
+        std::make_shared<
+            testing::NiceMock<kagome::network::TransactionsTransmitterMock>>(),
+        std::make_unique<
+            testing::NiceMock<kagome::transaction_pool::PoolModeratorMock>>(),
+        std::make_shared<kagome::blockchain::BlockHeaderRepositoryMock>(),
+        std::make_shared<kagome::blockchain::BlockStorageMock>(),
+        std::make_shared<
+            kagome::primitives::events::ExtrinsicSubscriptionEngine>(),
+        std::make_shared<kagome::subscription::ExtrinsicEventKeyRepository>(),
+        *worker_thread_pool,
+        std::make_shared<kagome::primitives::events::ChainSubscriptionEngine>(),
+        TransactionPoolImpl::Limits{.max_ready_num = kFlood,
+                                    .capacity = kFlood});
+  }
+
+  std::vector<Extrinsic> flood() const {
+    std::vector<Extrinsic> extrinsics;
+    for (size_t i = 0; i < kFlood; ++i) {
+      Extrinsic ext;
+      ext.data.resize(100);
+      ext.data[0] = i;
+      ext.data[1] = i >> 8;
+      extrinsics.emplace_back(std::move(ext));
+    }
+    return extrinsics;
+  }
+
+  std::shared_ptr<TtqMock> ttq = std::make_shared<TtqMock>();
+  std::shared_ptr<kagome::Watchdog> watchdog =
+      std::make_shared<kagome::Watchdog>(std::chrono::seconds(1));
+  std::unique_ptr<kagome::common::WorkerThreadPool> worker_thread_pool =
+      std::make_unique<kagome::common::WorkerThreadPool>(
+          watchdog, std::max<size_t>(2, std::thread::hardware_concurrency()));
+
+  ~SubmitPool() {
+    watchdog->stop();
+    worker_thread_pool.reset();
+  }
+};
+
+/// Transactions of flood submitted one by one, as before
+static void sequential(benchmark::State &state) {
+  SubmitPool submit_pool;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = submit_pool.makePool();
+    auto extrinsics = submit_pool.flood();
+    state.ResumeTiming();
+    for (auto &ext : extrinsics) {
+      pool->submitExtrinsic(TransactionSource::External, ext).value();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kFlood);
+}
+
+/// Transactions of flood submitted as one batch, validated in parallel
+static void batched(benchmark::State &state) {
+  SubmitPool submit_pool;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto pool = submit_pool.makePool();
+    auto extrinsics = submit_pool.flood();
+    state.ResumeTiming();
+    for (auto &result : pool->submitExtrinsics(TransactionSource::External,
+                                               std::move(extrinsics))) {
+      result.value();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kFlood);
+}
+
+BENCHMARK(sequential)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(batched)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+int main(int argc, char **argv) {
+  testutil::prepareLoggers(soralog::Level::WARN);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -6,7 +6,13 @@
 
 #include "api/jrpc/jrpc_handle_batch.hpp"
 
+#include <algorithm>
+#include <thread>
+
 #include <jsonrpc-lean/server.h>
+#include <libp2p/common/final_action.hpp>
+
+#include "utils/parallel_for.hpp"
 
 namespace kagome::api {
   /**
@@ -93,25 +99,100 @@ namespace kagome::api {
     }
   };
 
+  /**
+   * Captures string value of top level "method" key and aborts parsing.
+   */
+  struct MethodReader
+      : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, MethodReader> {
+    size_t level = 0;
+    bool method_key = false;
+    std::optional<std::string> method;
+
+    // scalar values other than string
+    bool Default() {
+      return level != 0 and not method_key;
+    }
+    bool String(const char *str, size_t length, bool) {
+      if (method_key) {
+        method.emplace(str, length);
+        return false;
+      }
+      return level != 0;
+    }
+    bool Key(const char *str, size_t length, bool) {
+      method_key = level == 1 and std::string_view{str, length} == "method";
+      return true;
+    }
+    bool StartObject() {
+      if (method_key) {
+        return false;
+      }
+      ++level;
+      return true;
+    }
+    bool EndObject(size_t) {
+      --level;
+      return true;
+    }
+    bool StartArray() {
+      if (level == 0 or method_key) {
+        return false;
+      }
+      ++level;
+      return true;
+    }
+    bool EndArray(size_t) {
+      --level;
+      return true;
+    }
+  };
+
+  std::optional<std::string> peekJrpcMethod(std::string_view request) {
+    MethodReader handler;
+    rapidjson::MemoryStream stream{request.data(), request.size()};
+    rapidjson::Reader reader;
+    reader.Parse(stream, handler);
+    return std::move(handler.method);
+  }
+
   JrpcHandleBatch::JrpcHandleBatch(jsonrpc::Server &handler,
-                                   std::string_view request) {
+                                   std::string_view request,
+                                   const JrpcBatchExecutor *executor) {
     std::string request_string;
     if (!request.empty() && request[0] == '[') {
+      std::vector<std::string_view> entries;
       auto cb = [&](std::string_view request) {
-        request_string = request;
-        auto formatted = handler.HandleRequest(request_string);
-        if (formatted->GetSize() == 0) {
+        entries.emplace_back(request);
+      };
+      Parser<decltype(cb) &> parser{.cb = std::move(cb)};
+      if (parser.parse(request)) {
+        if (entries.size() > kMaxBatchEntries) {
+          batch_ =
+              R"({"jsonrpc":"2.0","id":null,)"
+              R"("error":{"code":-32600,"message":"Batch too large"}})";
           return;
         }
-        if (batch_.empty()) {
-          batch_.push_back('[');
+        Responses responses(entries.size());
+        if (executor != nullptr && executor->io != nullptr
+            && executor->max_tasks != 0 && entries.size() > 1) {
+          handleConcurrently(handler, entries, responses, *executor);
         } else {
-          batch_.push_back(',');
+          for (size_t i = 0; i < entries.size(); ++i) {
+            request_string = entries[i];
+            responses[i] = handler.HandleRequest(request_string);
+          }
+        }
+        for (auto &formatted : responses) {
+          if (formatted->GetSize() == 0) {
+            continue;
+          }
+          if (batch_.empty()) {
+            batch_.push_back('[');
+          } else {
+            batch_.push_back(',');
+          }
+          batch_.append(formatted->GetData(), formatted->GetSize());
         }
-        batch_.append(formatted->GetData(), formatted->GetSize());
-      };
-      Parser<decltype(cb) &> parser{.cb = std::move(cb)};
-      if (parser.parse(request)) {
         if (!batch_.empty()) {
           batch_.push_back(']');
         }
@@ -122,6 +203,63 @@ namespace kagome::api {
     formatted_ = handler.HandleRequest(request_string);
   }
 
+  void JrpcHandleBatch::handleConcurrently(
+      jsonrpc::Server &handler,
+      const std::vector<std::string_view> &entries,
+      Responses &responses,
+      const JrpcBatchExecutor &executor) {
+    auto handle = [&](size_t i) {
+      std::string request_string{entries[i]};
+      responses[i] = handler.HandleRequest(request_string);
+    };
+
+    // malformed entries and unknown methods can't change state
+    const bool has_ordered = executor.ordered and std::ranges::any_of(
+        entries, [&](std::string_view entry) {
+          auto method = peekJrpcMethod(entry);
+          return method and executor.ordered(*method);
+        });
+    if (has_ordered) {
+      for (size_t i = 0; i < entries.size(); ++i) {
+        handle(i);
+      }
+      return;
+    }
+
+    const auto tasks = reserveTasks(
+        executor, std::min(entries.size() - 1, executor.max_tasks));
+    ::libp2p::common::FinalAction release([&] {
+      if (executor.total_tasks != nullptr) {
+        executor.total_tasks->fetch_sub(tasks);
+      }
+    });
+    const auto caller = std::this_thread::get_id();
+    parallelFor(*executor.io, tasks, entries.size(), [&](size_t i) {
+      if (executor.scope and std::this_thread::get_id() != caller) {
+        executor.scope([&] { handle(i); });
+      } else {
+        handle(i);
+      }
+    });
+  }
+
+  size_t JrpcHandleBatch::reserveTasks(const JrpcBatchExecutor &executor,
+                                       size_t tasks) {
+    if (executor.total_tasks == nullptr) {
+      return tasks;
+    }
+    auto &total = *executor.total_tasks;
+    auto current = total.load();
+    size_t reserved = 0;
+    do {
+      if (current >= executor.max_total_tasks) {
+        return 0;
+      }
+      reserved = std::min(tasks, executor.max_total_tasks - current);
+    } while (not total.compare_exchange_weak(current, current + reserved));
+    return reserved;
+  }
+
   std::string_view JrpcHandleBatch::response() const {
     if (formatted_ == nullptr) {
       return batch_;
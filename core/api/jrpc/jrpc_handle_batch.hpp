@@ -6,8 +6,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
+
+namespace boost::asio {
+  class io_context;
+}  // namespace boost::asio
 
 namespace jsonrpc {
   class FormattedData;
@@ -15,15 +23,57 @@ namespace jsonrpc {
 }  // namespace jsonrpc
 
 namespace kagome::api {
+  /**
+   * Reads "method" of single request, stops parsing as soon as it is found.
+   * @returns nullopt if request is malformed or method is not string
+   */
+  std::optional<std::string> peekJrpcMethod(std::string_view request);
+
+  /**
+   * Runs entries of batch request concurrently.
+   */
+  struct JrpcBatchExecutor {
+    /**
+     * Wraps entry handled on worker thread, to bind state of calling thread
+     * (e.g. session) to it.
+     */
+    using Scope = std::function<void(const std::function<void()> &)>;
+
+    /// worker pool, calling thread handles entries too
+    std::shared_ptr<boost::asio::io_context> io;
+    /// max number of worker tasks per batch
+    size_t max_tasks = 0;
+    /// number of worker tasks of all batches, shared by executors
+    std::atomic_size_t *total_tasks = nullptr;
+    /// max number of worker tasks of all batches
+    size_t max_total_tasks = 0;
+    Scope scope;
+    /**
+     * Whether method is ordered (pubsub or state-mutating, e.g.
+     * "author_submitExtrinsic" before "author_unwatchExtrinsic"),
+     * see `JRpcServer::markOrdered`.
+     */
+    std::function<bool(const std::string &)> ordered;
+  };
+
   /**
    * Handles single or batch requests.
    */
   class JrpcHandleBatch {
    public:
+    /// Batches with more entries are rejected
+    static constexpr size_t kMaxBatchEntries = 1024;
+
     /**
      * Construct response for single or batch request.
+     * Entries of batch are handled concurrently if `executor` is passed,
+     * unless batch contains ordered method, then all entries are handled
+     * in order on calling thread.
+     * Responses are combined in order of requests.
      */
-    JrpcHandleBatch(jsonrpc::Server &handler, std::string_view request);
+    JrpcHandleBatch(jsonrpc::Server &handler,
+                    std::string_view request,
+                    const JrpcBatchExecutor *executor = nullptr);
 
     /**
      * Get response.
@@ -31,6 +81,17 @@ namespace kagome::api {
     std::string_view response() const;
 
    private:
+    using Responses = std::vector<std::shared_ptr<jsonrpc::FormattedData>>;
+
+    static void handleConcurrently(jsonrpc::Server &handler,
+                                   const std::vector<std::string_view> &entries,
+                                   Responses &responses,
+                                   const JrpcBatchExecutor &executor);
+
+    /// Reserves up to `tasks` worker tasks within `max_total_tasks`
+    static size_t reserveTasks(const JrpcBatchExecutor &executor,
+                               size_t tasks);
+
     /**
      * Single response buffer returned by `jsonrpc::Server::HandleRequest`.
      */
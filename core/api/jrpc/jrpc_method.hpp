@@ -12,6 +12,7 @@
 #include <memory>
 #include <type_traits>
 
+#include "api/jrpc/json_stream_writer.hpp"
 #include "api/jrpc/value_converter.hpp"
 
 namespace kagome::api {
@@ -52,4 +53,38 @@ namespace kagome::api {
       }
     }
   };
+
+  /**
+   * Same as `Method`, but writes result with `writeJson`.
+   */
+  template <typename RequestType, typename Api>
+  class StreamMethod {
+   private:
+    std::weak_ptr<Api> api_;
+
+   public:
+    explicit StreamMethod(const std::shared_ptr<Api> &api) : api_(api) {}
+
+    void operator()(const jsonrpc::Request::Parameters &params,
+                    JsonStreamWriter &writer) {
+      auto api = api_.lock();
+      if (not api) {
+        throw jsonrpc::Fault("API not available");
+      }
+
+      RequestType request(api);
+
+      if (auto &&init_result = request.init(params); not init_result) {
+        throw jsonrpc::Fault(fmt::to_string(init_result.error()));
+      }
+
+      auto &&result = request.execute();
+
+      if (not result) {
+        throw jsonrpc::Fault(fmt::to_string(result.error()));
+      }
+
+      writeJson(writer, result.value());
+    }
+  };
 }  // namespace kagome::api
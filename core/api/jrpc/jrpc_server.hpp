@@ -12,9 +12,11 @@
 #include <jsonrpc-lean/response.h>
 #include <jsonrpc-lean/value.h>
 
+#include "api/jrpc/jrpc_handle_batch.hpp"
 #include "outcome/outcome.hpp"
 
 namespace kagome::api {
+  class JsonStreamWriter;
 
   /**
    * Instance of json rpc server, allows to register callbacks for rpc methods
@@ -23,6 +25,12 @@ namespace kagome::api {
   class JRpcServer {
    public:
     using Method = jsonrpc::MethodWrapper::Method;
+    /**
+     * Method writing result straight into response, bypassing
+     * `jsonrpc::Value`. Reports errors by throwing `jsonrpc::Fault`.
+     */
+    using StreamMethod = std::function<void(
+        const jsonrpc::Request::Parameters &, JsonStreamWriter &)>;
 
     virtual ~JRpcServer() = default;
 
@@ -45,6 +53,37 @@ namespace kagome::api {
       registerHandler(name, std::move(method), true);
     }
 
+    /**
+     * @brief marks registered method as ordered: pubsub or state-mutating
+     * method, entries of batch containing it are handled in order
+     * @param name rpc method name
+     */
+    virtual void markOrdered(const std::string &name) = 0;
+
+    /**
+     * @brief registers rpc request handler lambda of ordered method
+     * @param name rpc method name
+     * @param method handler functor
+     * @param unsafe method is unsafe
+     */
+    void registerOrderedHandler(const std::string &name,
+                                Method method,
+                                bool unsafe = false) {
+      registerHandler(name, std::move(method), unsafe);
+      markOrdered(name);
+    }
+
+    /**
+     * @brief registers streaming handler used for single requests of method,
+     * which also must be registered with `registerHandler` for batches
+     * @param name rpc method name
+     * @param method handler functor
+     * @param unsafe method is unsafe
+     */
+    virtual void registerStreamHandler(const std::string &name,
+                                       StreamMethod method,
+                                       bool unsafe = false) = 0;
+
     /**
      * @return name of handlers
      */
@@ -72,10 +111,12 @@ namespace kagome::api {
      * @param request json request string
      * @param allow_unsafe allow unsafe methods
      * @param cb callback
+     * @param scope wraps batch entries handled on other threads
      */
     virtual void processData(std::string_view request,
                              bool allow_unsafe,
-                             const ResponseHandler &cb) = 0;
+                             const ResponseHandler &cb,
+                             const JrpcBatchExecutor::Scope &scope = {}) = 0;
   };
 
 }  // namespace kagome::api
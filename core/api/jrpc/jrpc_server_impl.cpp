@@ -6,8 +6,12 @@
 
 #include "api/jrpc/jrpc_server_impl.hpp"
 
+#include <jsonrpc-lean/jsonreader.h>
+
 #include "api/jrpc/custom_json_writer.hpp"
 #include "api/jrpc/jrpc_handle_batch.hpp"
+#include "api/jrpc/json_stream_writer.hpp"
+#include "api/service/impl/rpc_batch_thread_pool.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, JRpcServerImpl::Error, e) {
   using E = kagome::api::JRpcServerImpl::Error;
@@ -20,7 +24,42 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, JRpcServerImpl::Error, e) {
 
 namespace {
   constexpr auto rpcRequestsCountMetricName = "kagome_rpc_requests_count";
-}
+
+  /// Writes fields preceding result or error, as `jsonrpc::JsonWriter` does
+  void writeResponseStart(kagome::api::JsonStreamWriter &writer,
+                          const jsonrpc::Value &id) {
+    writer.startObject();
+    writer.key(jsonrpc::json::JSONRPC_NAME);
+    writer.string(jsonrpc::json::JSONRPC_VERSION_2_0);
+    writer.key(jsonrpc::json::ID_NAME);
+    if (id.IsString()) {
+      writer.string(id.AsString());
+    } else if (id.IsInteger32()) {
+      writer.number(id.AsInteger32());
+    } else if (id.IsInteger64()) {
+      writer.number(id.AsInteger64());
+    } else {
+      writer.null();
+    }
+  }
+
+  std::string faultResponse(const jsonrpc::Value &id,
+                            int32_t code,
+                            std::string_view message) {
+    std::string response;
+    kagome::api::JsonStreamWriter writer{response};
+    writeResponseStart(writer, id);
+    writer.key(jsonrpc::json::ERROR_NAME);
+    writer.startObject();
+    writer.key(jsonrpc::json::ERROR_CODE_NAME);
+    writer.number(code);
+    writer.key(jsonrpc::json::ERROR_MESSAGE_NAME);
+    writer.string(message);
+    writer.endObject();
+    writer.endObject();
+    return response;
+  }
+}  // namespace
 
 namespace kagome::api {
 
@@ -37,6 +76,11 @@ namespace kagome::api {
         metrics_registry_->registerCounterMetric(rpcRequestsCountMetricName);
   }
 
+  JRpcServerImpl::JRpcServerImpl(RpcBatchThreadPool &rpc_batch_thread_pool)
+      : JRpcServerImpl() {
+    batch_io_ = rpc_batch_thread_pool.io_context();
+  }
+
   void JRpcServerImpl::registerHandler(const std::string &name,
                                        Method method,
                                        bool unsafe) {
@@ -48,6 +92,17 @@ namespace kagome::api {
     dispatcher.AddMethod(name, std::move(method));
   }
 
+  void JRpcServerImpl::markOrdered(const std::string &name) {
+    ordered_methods_.emplace(name);
+  }
+
+  void JRpcServerImpl::registerStreamHandler(const std::string &name,
+                                             StreamMethod method,
+                                             bool unsafe) {
+    stream_handlers_.insert_or_assign(
+        name, StreamHandler{.method = std::move(method), .unsafe = unsafe});
+  }
+
   std::vector<std::string> JRpcServerImpl::getHandlerNames() {
     auto &dispatcher = jsonrpc_handler_.GetDispatcher();
     return dispatcher.GetMethodNames();
@@ -86,11 +141,78 @@ namespace kagome::api {
     metric_rpc_requests_count_->inc();
   }
 
+  std::optional<std::string> JRpcServerImpl::processStream(
+      std::string_view request, bool allow_unsafe) {
+    if (stream_handlers_.empty() or request.empty() or request[0] != '{') {
+      return std::nullopt;
+    }
+    // other methods are parsed once, by `jsonrpc::Server`
+    auto method = peekJrpcMethod(request);
+    if (not method) {
+      return std::nullopt;
+    }
+    auto it = stream_handlers_.find(*method);
+    if (it == stream_handlers_.end()
+        or (it->second.unsafe and not allow_unsafe)) {
+      return std::nullopt;
+    }
+    std::string request_string{request};
+    jsonrpc::JsonReader reader{request_string};
+    std::optional<jsonrpc::Request> parsed;
+    try {
+      parsed.emplace(reader.GetRequest());
+    } catch (const jsonrpc::Fault &) {
+      // let `jsonrpc::Server` report malformed request
+      return std::nullopt;
+    }
+    auto &id = parsed->GetId();
+    if (not id.IsString() and not id.IsInteger32() and not id.IsInteger64()
+        and not id.IsNil()) {
+      // notification, no response
+      return std::nullopt;
+    }
+
+    std::string response;
+    try {
+      JsonStreamWriter writer{response};
+      writeResponseStart(writer, id);
+      writer.key(jsonrpc::json::RESULT_NAME);
+      it->second.method(parsed->GetParameters(), writer);
+      writer.endObject();
+    } catch (const jsonrpc::Fault &fault) {
+      response = faultResponse(id, fault.GetCode(), fault.GetString());
+    } catch (const std::exception &e) {
+      // same code as `jsonrpc::Dispatcher` uses for unknown exceptions
+      response = faultResponse(id, 0, e.what());
+    }
+    metric_rpc_requests_count_->inc();
+    return response;
+  }
+
   void JRpcServerImpl::processData(std::string_view request,
                                    bool allow_unsafe,
-                                   const ResponseHandler &cb) {
+                                   const ResponseHandler &cb,
+                                   const JrpcBatchExecutor::Scope &scope) {
+    if (auto response = processStream(request, allow_unsafe)) {
+      cb(*response);
+      return;
+    }
+    const JrpcBatchExecutor executor{
+        .io = batch_io_,
+        .max_tasks =
+            std::min(kMaxBatchTasks, RpcBatchThreadPool::threadCount()),
+        .total_tasks = &batch_tasks_,
+        .max_total_tasks = kMaxTotalBatchTasks,
+        .scope = scope,
+        .ordered =
+            [this](const std::string &method) {
+              return ordered_methods_.contains(method);
+            },
+    };
     JrpcHandleBatch response(
-        allow_unsafe ? jsonrpc_handler_ : jsonrpc_handler_safe_, request);
+        allow_unsafe ? jsonrpc_handler_ : jsonrpc_handler_safe_,
+        request,
+        &executor);
     cb(response.response());
   }
 
@@ -6,11 +6,21 @@
 
 #pragma once
 
+#include <atomic>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/di.hpp>
 #include <jsonrpc-lean/server.h>
 
 #include "api/jrpc/jrpc_server.hpp"
 #include "metrics/metrics.hpp"
 
+namespace kagome::api {
+  class RpcBatchThreadPool;
+}  // namespace kagome::api
+
 namespace kagome::api {
 
   class JRpcServerImpl : public JRpcServer {
@@ -19,12 +29,22 @@ namespace kagome::api {
       JSON_FORMAT_FAILED = 1,
     };
 
+    /// Batch entries are handled sequentially
     JRpcServerImpl();
 
+    /// Batch entries are handled concurrently on rpc batch pool
+    explicit JRpcServerImpl(RpcBatchThreadPool &rpc_batch_thread_pool);
+
     void registerHandler(const std::string &name,
                          Method method,
                          bool unsafe) override;
 
+    void markOrdered(const std::string &name) override;
+
+    void registerStreamHandler(const std::string &name,
+                               StreamMethod method,
+                               bool unsafe) override;
+
     /**
      * @return name of handlers
      */
@@ -32,7 +52,8 @@ namespace kagome::api {
 
     void processData(std::string_view request,
                      bool allow_unsafe,
-                     const ResponseHandler &cb) override;
+                     const ResponseHandler &cb,
+                     const JrpcBatchExecutor::Scope &scope) override;
 
     /**
      * @brief creates a valid jsonrpc response and passes it to \arg cb
@@ -44,6 +65,28 @@ namespace kagome::api {
                          const FormatterHandler &cb) override;
 
    private:
+    /// Max number of worker tasks handling entries of one batch.
+    /// Session handles one request at time, so it's limit per session too.
+    static constexpr size_t kMaxBatchTasks = 8;
+    /// Max number of worker tasks handling entries of all batches
+    static constexpr size_t kMaxTotalBatchTasks = 16;
+
+    /**
+     * Handles single request of method with streaming handler.
+     * @returns nullopt if request must be handled by `jsonrpc::Server`
+     */
+    std::optional<std::string> processStream(std::string_view request,
+                                             bool allow_unsafe);
+
+    struct StreamHandler {
+      StreamMethod method;
+      bool unsafe;
+    };
+    std::unordered_map<std::string, StreamHandler> stream_handlers_;
+    /// pubsub and state-mutating methods, see `markOrdered`
+    std::unordered_set<std::string> ordered_methods_;
+    std::shared_ptr<boost::asio::io_context> batch_io_;
+    std::atomic_size_t batch_tasks_ = 0;
     /// json rpc server instance
     jsonrpc::Server jsonrpc_handler_{};
     /// json rpc server instance for subset of safe methods
@@ -58,4 +101,9 @@ namespace kagome::api {
 
 }  // namespace kagome::api
 
+template <>
+struct boost::di::ctor_traits<kagome::api::JRpcServerImpl> {
+  BOOST_DI_INJECT_TRAITS(kagome::api::RpcBatchThreadPool &);
+};
+
 OUTCOME_HPP_DECLARE_ERROR(kagome::api, JRpcServerImpl::Error);
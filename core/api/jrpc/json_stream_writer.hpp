@@ -0,0 +1,170 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/buffer.hpp"
+#include "common/hexutil.hpp"
+
+namespace kagome::api {
+
+  /**
+   * Writes JSON straight into response string, without building
+   * `jsonrpc::Value` tree and without intermediate hex strings.
+   * Used for large responses of hot methods.
+   */
+  class JsonStreamWriter {
+   public:
+    explicit JsonStreamWriter(std::string &out) : out_{out} {}
+
+    void startObject() {
+      separator();
+      out_.push_back('{');
+      first_ = true;
+    }
+
+    void endObject() {
+      out_.push_back('}');
+      first_ = false;
+    }
+
+    void startArray() {
+      separator();
+      out_.push_back('[');
+      first_ = true;
+    }
+
+    void endArray() {
+      out_.push_back(']');
+      first_ = false;
+    }
+
+    void key(std::string_view key) {
+      separator();
+      escaped(key);
+      out_.push_back(':');
+      after_key_ = true;
+    }
+
+    void null() {
+      separator();
+      out_.append("null");
+    }
+
+    void boolean(bool value) {
+      separator();
+      out_.append(value ? "true" : "false");
+    }
+
+    void number(int64_t value) {
+      separator();
+      fmt::format_to(std::back_inserter(out_), "{}", value);
+    }
+
+    void string(std::string_view value) {
+      separator();
+      escaped(value);
+    }
+
+    /// Writes "0x" prefixed hex string, encoding bytes in place
+    void hex(common::BufferView bytes) {
+      separator();
+      auto offset = out_.size();
+      out_.resize(offset + 4 + 2 * bytes.size());
+      auto *out = out_.data() + offset;
+      std::memcpy(out, "\"0x", 3);
+      common::hex_lower_to(bytes, out + 3);
+      out_.back() = '"';
+    }
+
+   private:
+    void separator() {
+      if (after_key_) {
+        after_key_ = false;
+        return;
+      }
+      if (not first_) {
+        out_.push_back(',');
+      }
+      first_ = false;
+    }
+
+    void escaped(std::string_view value) {
+      out_.push_back('"');
+      auto begin = value.begin();
+      for (auto it = begin; it != value.end(); ++it) {
+        auto c = static_cast<uint8_t>(*it);
+        if (c >= 0x20 and c != '"' and c != '\\') {
+          continue;
+        }
+        out_.append(begin, it);
+        begin = it + 1;
+        switch (c) {
+          case '"':
+            out_.append("\\\"");
+            break;
+          case '\\':
+            out_.append("\\\\");
+            break;
+          case '\n':
+            out_.append("\\n");
+            break;
+          case '\r':
+            out_.append("\\r");
+            break;
+          case '\t':
+            out_.append("\\t");
+            break;
+          default:
+            fmt::format_to(std::back_inserter(out_), "\\u{:04x}", c);
+        }
+      }
+      out_.append(begin, value.end());
+      out_.push_back('"');
+    }
+
+    std::string &out_;
+    bool first_ = true;
+    bool after_key_ = false;
+  };
+
+  inline void writeJson(JsonStreamWriter &writer, const std::string &value) {
+    writer.string(value);
+  }
+
+  inline void writeJson(JsonStreamWriter &writer, common::BufferView value) {
+    writer.hex(value);
+  }
+
+  inline void writeJson(JsonStreamWriter &writer, const common::Buffer &value) {
+    writer.hex(value);
+  }
+
+  template <typename T>
+  void writeJson(JsonStreamWriter &writer, const std::optional<T> &value) {
+    if (not value) {
+      writer.null();
+      return;
+    }
+    writeJson(writer, *value);
+  }
+
+  template <typename T>
+  void writeJson(JsonStreamWriter &writer, const std::vector<T> &values) {
+    writer.startArray();
+    for (auto &value : values) {
+      writeJson(writer, value);
+    }
+    writer.endArray();
+  }
+}  // namespace kagome::api
@@ -29,11 +29,12 @@ namespace kagome::api::author {
   using Handler = kagome::api::Method<Request, AuthorApi>;
 
   void AuthorJRpcProcessor::registerHandlers() {
-    server_->registerHandler("author_submitExtrinsic",
-                             Handler<request::SubmitExtrinsic>(api_));
+    server_->registerOrderedHandler("author_submitExtrinsic",
+                                    Handler<request::SubmitExtrinsic>(api_));
 
-    server_->registerHandlerUnsafe("author_insertKey",
-                                   Handler<request::InsertKey>(api_));
+    server_->registerOrderedHandler("author_insertKey",
+                                    Handler<request::InsertKey>(api_),
+                                    true);
 
     server_->registerHandlerUnsafe("author_hasSessionKeys",
                                    Handler<request::HasSessionKeys>(api_));
@@ -41,14 +42,16 @@ namespace kagome::api::author {
     server_->registerHandlerUnsafe("author_hasKey",
                                    Handler<request::HasKey>(api_));
 
-    server_->registerHandlerUnsafe("author_rotateKeys",
-                                   Handler<request::RotateKeys>(api_));
+    server_->registerOrderedHandler("author_rotateKeys",
+                                    Handler<request::RotateKeys>(api_),
+                                    true);
 
-    server_->registerHandler("author_submitAndWatchExtrinsic",
-                             Handler<request::SubmitAndWatchExtrinsic>(api_));
+    server_->registerOrderedHandler(
+        "author_submitAndWatchExtrinsic",
+        Handler<request::SubmitAndWatchExtrinsic>(api_));
 
-    server_->registerHandler("author_unwatchExtrinsic",
-                             Handler<request::UnwatchExtrinsic>(api_));
+    server_->registerOrderedHandler("author_unwatchExtrinsic",
+                                    Handler<request::UnwatchExtrinsic>(api_));
 
     server_->registerHandler("author_pendingExtrinsics",
                              Handler<request::PendingExtrinsics>(api_));
@@ -46,23 +46,27 @@ namespace kagome::api::chain {
     server_->registerHandler("chain_getFinalisedHead",
                              Handler<request::GetFinalizedHead>(api_));
 
-    server_->registerHandler("chain_subscribeFinalizedHeads",
-                             Handler<request::SubscribeFinalizedHeads>(api_));
+    server_->registerOrderedHandler(
+        "chain_subscribeFinalizedHeads",
+        Handler<request::SubscribeFinalizedHeads>(api_));
 
-    server_->registerHandler("chain_unsubscribeFinalizedHeads",
-                             Handler<request::UnsubscribeFinalizedHeads>(api_));
+    server_->registerOrderedHandler(
+        "chain_unsubscribeFinalizedHeads",
+        Handler<request::UnsubscribeFinalizedHeads>(api_));
 
-    server_->registerHandler("chain_subscribeNewHeads",
-                             Handler<request::SubscribeNewHeads>(api_));
+    server_->registerOrderedHandler("chain_subscribeNewHeads",
+                                    Handler<request::SubscribeNewHeads>(api_));
 
-    server_->registerHandler("chain_unsubscribeNewHeads",
-                             Handler<request::UnsubscribeNewHeads>(api_));
+    server_->registerOrderedHandler(
+        "chain_unsubscribeNewHeads",
+        Handler<request::UnsubscribeNewHeads>(api_));
 
-    server_->registerHandler("chain_subscribeNewHead",
-                             Handler<request::SubscribeNewHeads>(api_));
+    server_->registerOrderedHandler("chain_subscribeNewHead",
+                                    Handler<request::SubscribeNewHeads>(api_));
 
-    server_->registerHandler("chain_unsubscribeNewHead",
-                             Handler<request::UnsubscribeNewHeads>(api_));
+    server_->registerOrderedHandler(
+        "chain_unsubscribeNewHead",
+        Handler<request::UnsubscribeNewHeads>(api_));
   }
 
 }  // namespace kagome::api::chain
@@ -251,17 +251,15 @@ namespace kagome::api {
   ApiServiceImpl::storeSessionWithId(Session::SessionId id,
                                      const std::shared_ptr<Session> &session) {
     std::lock_guard guard(subscribed_sessions_cs_);
-    auto &&[it, inserted] = subscribed_sessions_.emplace(
-        id,
-        std::make_shared<ApiServiceImpl::SessionSubscriptions>(
-            ApiServiceImpl::SessionSubscriptions{
-                .storage_sub = std::make_shared<StorageEventSubscriber>(
-                    subscription_engines_.storage, session),
-                .chain_sub = std::make_shared<ChainEventSubscriber>(
-                    subscription_engines_.chain, session),
-                .ext_sub = std::make_shared<ExtrinsicEventSubscriber>(
-                    subscription_engines_.ext, session),
-                .messages = {}}));
+    auto session_context = std::make_shared<SessionSubscriptions>();
+    session_context->storage_sub = std::make_shared<StorageEventSubscriber>(
+        subscription_engines_.storage, session);
+    session_context->chain_sub = std::make_shared<ChainEventSubscriber>(
+        subscription_engines_.chain, session);
+    session_context->ext_sub = std::make_shared<ExtrinsicEventSubscriber>(
+        subscription_engines_.ext, session);
+    auto &&[it, inserted] =
+        subscribed_sessions_.emplace(id, std::move(session_context));
 
     BOOST_ASSERT(inserted);
     return it->second;
@@ -299,7 +297,7 @@ namespace kagome::api {
 
                 auto &batch = batch_res.value();
 
-                session_context.messages = uploadMessagesListFromCache();
+                initMessages(session_context);
 
                 std::vector<
                     std::pair<common::Buffer, std::optional<common::Buffer>>>
@@ -342,7 +340,7 @@ namespace kagome::api {
         auto header =
             block_tree_->getBlockHeader(block_tree_->getLastFinalized().hash);
         if (!header.has_error()) {
-          session_context.messages = uploadMessagesListFromCache();
+          initMessages(session_context);
           forJsonData(server_,
                       logger_,
                       id,
@@ -385,7 +383,7 @@ namespace kagome::api {
         auto header =
             block_tree_->getBlockHeader(block_tree_->bestBlock().hash);
         if (!header.has_error()) {
-          session_context.messages = uploadMessagesListFromCache();
+          initMessages(session_context);
           forJsonData(server_,
                       logger_,
                       id,
@@ -427,7 +425,7 @@ namespace kagome::api {
         auto version_res = core_->version(block_tree_->getLastFinalized().hash);
         if (version_res.has_value()) {
           const auto &version = version_res.value();
-          session_context.messages = uploadMessagesListFromCache();
+          initMessages(session_context);
           forJsonData(server_,
                       logger_,
                       id,
@@ -513,13 +511,27 @@ namespace kagome::api {
     std::string str_request(request);
     boost::replace_first(str_request, "\"params\":null", "\"params\":[null]");
 
+    // batch entries handled on worker threads are bound to same session
+    auto scope = [session_id{session->id()}](const std::function<void()> &f) {
+      threaded_info.storeSessionId(session_id);
+      try {
+        f();
+      } catch (...) {
+        threaded_info.releaseSessionId();
+        throw;
+      }
+      threaded_info.releaseSessionId();
+    };
+
     // process new request
-    server_->processData(str_request,
-                         session->isUnsafeAllowed(),
-                         [&](std::string_view response) mutable {
-                           // process response
-                           session->respond(response);
-                         });
+    server_->processData(
+        str_request,
+        session->isUnsafeAllowed(),
+        [&](std::string_view response) mutable {
+          // process response
+          session->respond(response);
+        },
+        scope);
 
     try {
       withSession(session->id(), [&](SessionSubscriptions &session_context) {
@@ -108,6 +108,8 @@ namespace kagome::api {
       ChainEventSubscriberPtr chain_sub;
       ExtrinsicEventSubscriberPtr ext_sub;
       CachedAdditionMessagesList messages;
+      /// Entries of batch request may be handled concurrently
+      std::mutex mutex;
     };
 
    public:
@@ -202,6 +204,7 @@ namespace kagome::api {
     auto withSession(kagome::api::Session::SessionId id, Func &&f) {
       if (auto session_context = findSessionById(id)) {
         BOOST_ASSERT(*session_context);
+        std::lock_guard lock{(*session_context)->mutex};
         return std::forward<Func>(f)(**session_context);
       }
 
@@ -224,6 +227,13 @@ namespace kagome::api {
       return obj;
     }
 
+    /// Keeps messages added by earlier subscriptions of same batch
+    void initMessages(SessionSubscriptions &session_context) {
+      if (not session_context.messages) {
+        session_context.messages = uploadMessagesListFromCache();
+      }
+    }
+
     std::vector<std::shared_ptr<Listener>> listeners_;
     std::shared_ptr<JRpcServer> server_;
     log::Logger logger_;
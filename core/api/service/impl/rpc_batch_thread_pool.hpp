@@ -0,0 +1,39 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+
+#include "injector/inject.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/watchdog.hpp"
+
+namespace kagome::api {
+  /**
+   * Runs entries of batch requests, separately from `RpcThreadPool`.
+   * Batches with ordered (pubsub or state-mutating) methods are handled on
+   * rpc thread, so only queries of storage and runtime run here.
+   */
+  class RpcBatchThreadPool final : public ThreadPool {
+   public:
+    /// Max number of threads, batches don't use more
+    static constexpr size_t kMaxThreads = 8;
+
+    RpcBatchThreadPool(std::shared_ptr<Watchdog> watchdog, size_t thread_count)
+        : ThreadPool(
+              std::move(watchdog), "rpc_batch", thread_count, std::nullopt) {}
+
+    RpcBatchThreadPool(std::shared_ptr<Watchdog> watchdog, Inject, ...)
+        : RpcBatchThreadPool(std::move(watchdog), threadCount()) {}
+
+    static size_t threadCount() {
+      return std::clamp<size_t>(
+          std::thread::hardware_concurrency() / 2, 1, kMaxThreads);
+    }
+  };
+}  // namespace kagome::api
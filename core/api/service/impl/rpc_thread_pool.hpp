@@ -11,6 +11,10 @@
 #include "utils/watchdog.hpp"
 
 namespace kagome::api {
+  /**
+   * Runs rpc sessions on single thread.
+   * Api services and subscription engines posting to `RpcContext` rely on it.
+   */
   class RpcThreadPool final : public ThreadPool {
    public:
     RpcThreadPool(std::shared_ptr<Watchdog> watchdog,
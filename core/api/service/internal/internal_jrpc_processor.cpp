@@ -22,8 +22,9 @@ namespace kagome::api::internal {
   using Handler = Method<Request, InternalApi>;
 
   void InternalJrpcProcessor::registerHandlers() {
-    server_->registerHandlerUnsafe("internal_setLogLevel",
-                                   Handler<request::SetLogLevel>(api_));
+    server_->registerOrderedHandler("internal_setLogLevel",
+                                    Handler<request::SetLogLevel>(api_),
+                                    true);
   }
 
 }  // namespace kagome::api::internal
@@ -15,7 +15,7 @@
 
 #include "common/hexutil.hpp"
 #include "common/monadic_utils.hpp"
-#include "runtime/executor.hpp"
+#include "runtime/common/concurrent_call_executor.hpp"
 #include "storage/trie/on_read.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, StateApiImpl::Error, e) {
@@ -43,19 +43,19 @@ namespace kagome::api {
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<runtime::Metadata> metadata,
-      std::shared_ptr<runtime::Executor> executor,
+      std::shared_ptr<runtime::ConcurrentCallExecutor> call_executor,
       LazySPtr<api::ApiService> api_service)
       : storage_{std::move(trie_storage)},
         block_tree_{std::move(block_tree)},
         runtime_core_{std::move(runtime_core)},
         api_service_{api_service},
         metadata_{std::move(metadata)},
-        executor_{std::move(executor)} {
+        call_executor_{std::move(call_executor)} {
     BOOST_ASSERT(nullptr != storage_);
     BOOST_ASSERT(nullptr != block_tree_);
     BOOST_ASSERT(nullptr != runtime_core_);
     BOOST_ASSERT(nullptr != metadata_);
-    BOOST_ASSERT(nullptr != executor_);
+    BOOST_ASSERT(nullptr != call_executor_);
   }
 
   outcome::result<common::Buffer> StateApiImpl::call(
@@ -64,8 +64,7 @@ namespace kagome::api {
       const std::optional<primitives::BlockHash> &opt_at) const {
     auto at =
         opt_at.has_value() ? opt_at.value() : block_tree_->bestBlock().hash;
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(at));
-    return ctx.module_instance->callExportFunction(ctx, method, data);
+    return call_executor_->call(at, method, data);
   }
 
   outcome::result<std::vector<common::Buffer>> StateApiImpl::getKeysPaged(
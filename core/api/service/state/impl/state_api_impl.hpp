@@ -15,7 +15,7 @@
 #include "storage/trie/trie_storage.hpp"
 
 namespace kagome::runtime {
-  class Executor;
+  class ConcurrentCallExecutor;
 }
 
 namespace kagome::api {
@@ -35,7 +35,7 @@ namespace kagome::api {
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::Core> runtime_core,
                  std::shared_ptr<runtime::Metadata> metadata,
-                 std::shared_ptr<runtime::Executor> executor,
+                 std::shared_ptr<runtime::ConcurrentCallExecutor> call_executor,
                  LazySPtr<api::ApiService> api_service);
 
     outcome::result<common::Buffer> call(
@@ -98,7 +98,7 @@ namespace kagome::api {
 
     LazySPtr<api::ApiService> api_service_;
     std::shared_ptr<runtime::Metadata> metadata_;
-    std::shared_ptr<runtime::Executor> executor_;
+    std::shared_ptr<runtime::ConcurrentCallExecutor> call_executor_;
   };
 
 }  // namespace kagome::api
@@ -11,6 +11,7 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm_ext/push_back.hpp>
 
+#include "api/jrpc/json_stream_writer.hpp"
 #include "api/jrpc/value_converter.hpp"
 #include "api/service/state/state_api.hpp"
 
@@ -27,6 +28,16 @@ namespace kagome::api {
         std::pair{"proof", makeValue(j_proof)},
     };
   }
+
+  inline void writeJson(JsonStreamWriter &writer,
+                        const StateApi::ReadProof &proof) {
+    writer.startObject();
+    writer.key("at");
+    writer.hex(proof.at);
+    writer.key("proof");
+    writeJson(writer, proof.proof);
+    writer.endObject();
+  }
 }  // namespace kagome::api
 
 namespace kagome::api::state::request {
@@ -32,11 +32,16 @@ namespace kagome::api::state {
   template <typename Request>
   using Handler = kagome::api::Method<Request, StateApi>;
 
+  template <typename Request>
+  using StreamHandler = kagome::api::StreamMethod<Request, StateApi>;
+
   void StateJrpcProcessor::registerHandlers() {
     server_->registerHandler("state_call", Handler<request::Call>(api_));
 
     server_->registerHandler("state_getKeysPaged",
                              Handler<request::GetKeysPaged>(api_));
+    server_->registerStreamHandler("state_getKeysPaged",
+                                   StreamHandler<request::GetKeysPaged>(api_));
 
     server_->registerHandler("state_getStorage",
                              Handler<request::GetStorage>(api_));
@@ -56,6 +61,8 @@ namespace kagome::api::state {
 
     server_->registerHandler("state_getReadProof",
                              Handler<request::GetReadProof>(api_));
+    server_->registerStreamHandler("state_getReadProof",
+                                   StreamHandler<request::GetReadProof>(api_));
 
     server_->registerHandler("state_getRuntimeVersion",
                              Handler<request::GetRuntimeVersion>(api_));
@@ -65,20 +72,24 @@ namespace kagome::api::state {
     server_->registerHandler("chain_getRuntimeVersion",
                              Handler<request::GetRuntimeVersion>(api_));
 
-    server_->registerHandler("state_subscribeRuntimeVersion",
-                             Handler<request::SubscribeRuntimeVersion>(api_));
+    server_->registerOrderedHandler(
+        "state_subscribeRuntimeVersion",
+        Handler<request::SubscribeRuntimeVersion>(api_));
 
-    server_->registerHandler("state_subscribeStorage",
-                             Handler<request::SubscribeStorage>(api_));
+    server_->registerOrderedHandler("state_subscribeStorage",
+                                    Handler<request::SubscribeStorage>(api_));
 
-    server_->registerHandler("state_unsubscribeStorage",
-                             Handler<request::UnsubscribeStorage>(api_));
+    server_->registerOrderedHandler("state_unsubscribeStorage",
+                                    Handler<request::UnsubscribeStorage>(api_));
 
-    server_->registerHandler("state_unsubscribeRuntimeVersion",
-                             Handler<request::UnsubscribeRuntimeVersion>(api_));
+    server_->registerOrderedHandler(
+        "state_unsubscribeRuntimeVersion",
+        Handler<request::UnsubscribeRuntimeVersion>(api_));
 
     server_->registerHandler("state_getMetadata",
                              Handler<request::GetMetadata>(api_));
+    server_->registerStreamHandler("state_getMetadata",
+                                   StreamHandler<request::GetMetadata>(api_));
   }
 
 }  // namespace kagome::api::state
@@ -11,6 +11,9 @@
 #include <boost/asio/dispatch.hpp>
 #include <boost/beast/core/bind_handler.hpp>
 #include <boost/config.hpp>
+#include <zstd.h>
+
+#include "metrics/histogram_timer.hpp"
 
 namespace boost::beast {
   template <class NextLayer, class DynamicBuffer>
@@ -33,6 +36,78 @@ namespace boost::beast {
 
 namespace kagome::api {
   static constexpr boost::string_view kServerName = "Kagome";
+  /// Fastest level, responses are compressed on rpc thread
+  static constexpr int kZstdLevel = 1;
+
+  namespace {
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramTimer metric_http_request_time{
+        "kagome_rpc_http_request_time",
+        "Time taken to handle HTTP RPC request and write response",
+        {0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1},
+    };
+
+    const metrics::CounterHelper metric_http_keep_alive_requests{
+        "kagome_rpc_http_keep_alive_requests",
+        "Number of HTTP RPC requests read from reused connection",
+    };
+
+    const metrics::CounterHelper metric_http_compressed_responses{
+        "kagome_rpc_http_compressed_responses",
+        "Number of HTTP RPC responses compressed with zstd",
+    };
+
+    const metrics::CounterHelper metric_http_compression_saved_bytes{
+        "kagome_rpc_http_compression_saved_bytes",
+        "Number of bytes saved by compression of HTTP RPC responses",
+    };
+
+    std::string_view trim(std::string_view str) {
+      auto begin = str.find_first_not_of(" \t");
+      if (begin == std::string_view::npos) {
+        return {};
+      }
+      return str.substr(begin, str.find_last_not_of(" \t") - begin + 1);
+    }
+
+    /// Checks whether `Accept-Encoding` header value allows zstd coding
+    bool acceptsZstd(std::string_view accept_encoding) {
+      while (not accept_encoding.empty()) {
+        auto comma = accept_encoding.find(',');
+        auto item = accept_encoding.substr(0, comma);
+        accept_encoding.remove_prefix(comma == std::string_view::npos
+                                          ? accept_encoding.size()
+                                          : comma + 1);
+        auto semicolon = item.find(';');
+        if (trim(item.substr(0, semicolon)) != "zstd") {
+          continue;
+        }
+        if (semicolon == std::string_view::npos) {
+          return true;
+        }
+        // "q=0", "q=0.0" and so on disable coding
+        auto weight = trim(item.substr(semicolon + 1));
+        return not weight.starts_with("q=0")
+            or weight.find_first_not_of("0.", 2) != std::string_view::npos;
+      }
+      return false;
+    }
+
+    std::optional<std::string> compressZstd(std::string_view data) {
+      std::string compressed;
+      compressed.resize(ZSTD_compressBound(data.size()));
+      auto size = ZSTD_compress(compressed.data(),
+                                compressed.size(),
+                                data.data(),
+                                data.size(),
+                                kZstdLevel);
+      if (ZSTD_isError(size)) {
+        return std::nullopt;
+      }
+      compressed.resize(size);
+      return compressed;
+    }
+  }  // namespace
 
   WsSessionImpl::WsSessionImpl(std::shared_ptr<WsSession> impl,
                                SessionId id,
@@ -152,6 +227,21 @@ namespace kagome::api {
         res.set(boost::beast::http::field::server, kServerName);
         res.set(boost::beast::http::field::content_type, "application/json");
         res.keep_alive(req.keep_alive());
+        if (response.size() >= self->config_.compress_min_size) {
+          res.set(boost::beast::http::field::vary, "Accept-Encoding");
+          auto accept_encoding =
+              req[boost::beast::http::field::accept_encoding];
+          if (acceptsZstd({accept_encoding.data(), accept_encoding.size()})) {
+            if (auto compressed = compressZstd(response)) {
+              metric_http_compressed_responses->inc();
+              metric_http_compression_saved_bytes->inc(
+                  static_cast<double>(response.size())
+                  - static_cast<double>(compressed->size()));
+              res.body() = std::move(*compressed);
+              res.set(boost::beast::http::field::content_encoding, "zstd");
+            }
+          }
+        }
         self->httpWrite();
         return;
       }
@@ -246,8 +336,11 @@ namespace kagome::api {
   }
 
   bool WsSession::isUnsafeAllowed() const {
-    return allow_unsafe_.allow(
-        stream_.next_layer().next_layer().socket().remote_endpoint());
+    if (not unsafe_allowed_) {
+      unsafe_allowed_ = allow_unsafe_.allow(
+          stream_.next_layer().next_layer().socket().remote_endpoint());
+    }
+    return *unsafe_allowed_;
   }
 
   std::shared_ptr<WsSessionImpl> WsSession::sessionMake() {
@@ -299,6 +392,11 @@ namespace kagome::api {
             self->wsAccept();
             return;
           }
+          self->http_request_time_ = metrics::HistogramTimer::Clock::now();
+          if (++self->http_requests_ > 1) {
+            // pipelined requests are read from buffer in order, one by one
+            metric_http_keep_alive_requests->inc();
+          }
           // allow only POST method
           if (req.method() != boost::beast::http::verb::post) {
             auto &res = self->http_response_.emplace(
@@ -324,6 +422,10 @@ namespace kagome::api {
         *http_response_,
         [self = shared_from_this()](boost::system::error_code ec, size_t) {
           self->stream_.next_layer().next_layer().expires_never();
+          if (self->http_request_time_) {
+            metric_http_request_time.observe(*self->http_request_time_);
+            self->http_request_time_.reset();
+          }
           if (ec) {
             self->httpClose();
             return;
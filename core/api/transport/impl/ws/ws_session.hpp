@@ -72,9 +72,12 @@ namespace kagome::api {
       static constexpr size_t kDefaultRequestSize = 10000u;
       static constexpr Session::Duration kDefaultTimeout =
           std::chrono::seconds(30);
+      static constexpr size_t kDefaultCompressMinSize = 64u << 10;
 
       size_t max_request_size{kDefaultRequestSize};
       Session::Duration operation_timeout{kDefaultTimeout};
+      /// HTTP responses of this size or larger are compressed, if accepted
+      size_t compress_min_size{kDefaultCompressMinSize};
     };
 
     WsSession(Session::Context &context,
@@ -184,7 +187,13 @@ namespace kagome::api {
         http_request_;
     std::optional<boost::beast::http::response<boost::beast::http::string_body>>
         http_response_;
+    /// when last HTTP request was read
+    std::optional<std::chrono::steady_clock::time_point> http_request_time_;
+    /// number of HTTP requests read from this connection
+    size_t http_requests_ = 0;
     bool is_ws_ = false;
+    /// remote endpoint doesn't change, check it once per connection
+    mutable std::optional<bool> unsafe_allowed_;
 
     std::queue<std::string> pending_responses_;
 
@@ -167,11 +167,23 @@ namespace kagome::application {
     virtual const boost::asio::ip::tcp::endpoint &openmetricsHttpEndpoint()
         const = 0;
 
+    /**
+     * @return whether runtime allocator statistics are collected and exported
+     * as metrics
+     */
+    virtual bool runtimeAllocatorStats() const = 0;
+
     /**
      * @return maximum number of WS RPC connections
      */
     virtual uint32_t maxWsConnections() const = 0;
 
+    /**
+     * @return admission budget of concurrent state_call RPC in estimated
+     * milliseconds of runtime execution, 0 - 1000 per CPU core
+     */
+    virtual uint32_t rpcCallBudget() const = 0;
+
     /**
      * @return Kademlia random walk interval
      */
@@ -248,6 +260,11 @@ namespace kagome::application {
      */
     virtual bool purgeWavmCache() const = 0;
 
+    /**
+     * @return disk budget of compiled runtime artifacts in MiB, 0 - unlimited
+     */
+    virtual uint32_t runtimeCacheLimit() const = 0;
+
     virtual uint32_t parachainRuntimeInstanceCacheSize() const = 0;
 
     virtual uint32_t parachainPrecompilationThreadNum() const = 0;
@@ -267,6 +284,11 @@ namespace kagome::application {
      */
     virtual size_t pvfMaxWorkers() const = 0;
 
+    /**
+     * @return memory budget of availability store in-memory tier in MiB
+     */
+    virtual uint32_t availabilityStoreMemoryLimit() const = 0;
+
     /**
      * Whether secure validator mode should be disabled.
      */
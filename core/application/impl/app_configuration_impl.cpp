@@ -116,7 +116,11 @@ namespace {
 #endif
   const uint32_t def_db_cache_size = 1024;
   const uint32_t def_parachain_runtime_instance_cache_size = 100;
+  const uint32_t def_runtime_cache_limit = 8192;
   const uint32_t def_max_parallel_downloads = 5;
+  const uint32_t def_av_store_memory_limit = 512;
+  const uint32_t def_rpc_call_budget = 0;
+  const bool def_runtime_allocator_stats = false;
 
   /**
    * Generate once at run random node name if form of UUID
@@ -279,6 +283,7 @@ namespace kagome::application {
         openmetrics_http_host_(def_openmetrics_http_host),
         rpc_port_(def_rpc_port),
         openmetrics_http_port_(def_openmetrics_http_port),
+        runtime_allocator_stats_(def_runtime_allocator_stats),
         out_peers_(def_out_peers),
         in_peers_(def_in_peers),
         in_peers_light_(def_in_peers_light),
@@ -297,7 +302,8 @@ namespace kagome::application {
         enable_offchain_indexing_{def_enable_offchain_indexing},
         recovery_state_{def_block_to_recover},
         db_cache_size_{def_db_cache_size},
-        state_pruning_depth_{} {}
+        state_pruning_depth_{},
+        av_store_memory_limit_{def_av_store_memory_limit} {}
 
   fs::path AppConfigurationImpl::chainSpecPath() const {
     return chain_spec_path_.native();
@@ -825,8 +831,12 @@ namespace kagome::application {
         ("rpc-host", po::value<std::string>(), "address for RPC over HTTP and Websocket")
         ("rpc-port", po::value<uint16_t>(), "port for RPC over HTTP and Websocket")
         ("ws-max-connections", po::value<uint32_t>(), "maximum number of WS RPC server connections")
+        ("rpc-call-budget", po::value<uint32_t>()->default_value(def_rpc_call_budget),
+          "Admission budget of concurrent state_call RPC in estimated <ms> of runtime execution. 0 - 1000 per CPU core")
         ("prometheus-host", po::value<std::string>(), "address for OpenMetrics over HTTP")
         ("prometheus-port", po::value<uint16_t>(), "port for OpenMetrics over HTTP")
+        ("runtime-allocator-stats", po::bool_switch()->default_value(def_runtime_allocator_stats),
+          "Collect runtime allocator statistics and export them as OpenMetrics")
         ("out-peers", po::value<uint32_t>()->default_value(def_out_peers), "number of outgoing connections we're trying to maintain")
         ("in-peers", po::value<uint32_t>()->default_value(def_in_peers), "maximum number of inbound full nodes peers")
         ("in-peers-light", po::value<uint32_t>()->default_value(def_in_peers_light), "maximum number of inbound light nodes peers")
@@ -861,6 +871,8 @@ namespace kagome::application {
         ("wasm-interpreter", po::value<std::string>()->default_value(def_wasm_interpreter),
           fmt::format("choose the desired wasm interpreter ({})", interpreters_str).c_str())
         ("purge-wavm-cache", "purge WAVM runtime cache")
+        ("runtime-cache-limit", po::value<uint32_t>()->default_value(def_runtime_cache_limit),
+          "Disk budget of compiled runtime artifacts <MiB>, least recently used are removed. 0 - unlimited")
         ("parachain-runtime-instance-cache-size",
           po::value<uint32_t>()->default_value(def_parachain_runtime_instance_cache_size),
           "Number of parachain runtime instances to keep cached")
@@ -872,6 +884,8 @@ namespace kagome::application {
         "Disables spawn of child pvf check processes, thus they could not be aborted by deadline timer")
         ("pvf-max-workers", po::value<size_t>()->default_value(pvf_max_workers_),
         "Max PVF execution threads or processes.")
+        ("av-store-memory-limit", po::value<uint32_t>()->default_value(def_av_store_memory_limit),
+        "Memory budget of availability store in-memory tier <MiB>. Evicted data is served from the database.")
         ("insecure-validator-i-know-what-i-do", po::bool_switch(), "Allows a validator to run insecurely outside of Secure Validator Mode.")
         ("precompile-relay", po::bool_switch(), "precompile relay")
         ("precompile-para", po::value<decltype(PrecompileWasmConfig::parachains)>()->multitoken(), "paths to wasm or chainspec files")
@@ -1315,6 +1329,10 @@ namespace kagome::application {
       openmetrics_http_port_ = val;
     });
 
+    find_argument<bool>(vm, "runtime-allocator-stats", [&](bool flag) {
+      runtime_allocator_stats_ = flag;
+    });
+
     if (auto str = find_argument<std::string>(vm, "rpc-methods")) {
       if (auto value = parseAllowUnsafeRpc(*str)) {
         allow_unsafe_rpc_ = *value;
@@ -1342,6 +1360,10 @@ namespace kagome::application {
       max_ws_connections_ = val;
     });
 
+    if (auto arg = find_argument<uint32_t>(vm, "rpc-call-budget")) {
+      rpc_call_budget_ = *arg;
+    }
+
     find_argument<uint32_t>(vm, "random-walk-interval", [&](uint32_t val) {
       random_walk_interval_ = val;
     });
@@ -1476,6 +1498,10 @@ namespace kagome::application {
       parachain_runtime_instance_cache_size_ = *arg;
     }
 
+    if (auto arg = find_argument<uint32_t>(vm, "runtime-cache-limit")) {
+      runtime_cache_limit_ = *arg;
+    }
+
     if (!find_argument(vm, "validator")
         || find_argument(vm, "no-precompile-parachain-modules")) {
       should_precompile_parachain_modules_ = false;
@@ -1496,6 +1522,10 @@ namespace kagome::application {
       pvf_max_workers_ = *arg;
     }
 
+    if (auto arg = find_argument<uint32_t>(vm, "av-store-memory-limit")) {
+      av_store_memory_limit_ = *arg;
+    }
+
     if (find_argument(vm, "insecure-validator-i-know-what-i-do")) {
       disable_secure_mode_ = true;
     }
@@ -127,9 +127,15 @@ namespace kagome::application {
         const override {
       return openmetrics_http_endpoint_;
     }
+    bool runtimeAllocatorStats() const override {
+      return runtime_allocator_stats_;
+    }
     uint32_t maxWsConnections() const override {
       return max_ws_connections_;
     }
+    uint32_t rpcCallBudget() const override {
+      return rpc_call_budget_;
+    }
     std::chrono::seconds getRandomWalkInterval() const override {
       return std::chrono::seconds(random_walk_interval_);
     }
@@ -170,6 +176,9 @@ namespace kagome::application {
     bool purgeWavmCache() const override {
       return purge_wavm_cache_;
     }
+    uint32_t runtimeCacheLimit() const override {
+      return runtime_cache_limit_;
+    }
     uint32_t parachainRuntimeInstanceCacheSize() const override {
       return parachain_runtime_instance_cache_size_;
     }
@@ -235,6 +244,9 @@ namespace kagome::application {
     size_t pvfMaxWorkers() const override {
       return pvf_max_workers_;
     }
+    uint32_t availabilityStoreMemoryLimit() const override {
+      return av_store_memory_limit_;
+    }
     bool disableSecureMode() const override {
       return disable_secure_mode_;
     }
@@ -351,6 +363,7 @@ namespace kagome::application {
     std::optional<filesystem::path> keystore_path_;
     uint16_t rpc_port_;
     uint16_t openmetrics_http_port_;
+    bool runtime_allocator_stats_;
     uint32_t out_peers_;
     uint32_t in_peers_;
     uint32_t in_peers_light_;
@@ -361,6 +374,7 @@ namespace kagome::application {
     std::string node_name_;
     std::string node_version_;
     uint32_t max_ws_connections_;
+    uint32_t rpc_call_budget_ = 0;
     uint32_t random_walk_interval_;
     SyncMethod sync_method_;
     RuntimeExecutionMethod runtime_exec_method_;
@@ -382,12 +396,14 @@ namespace kagome::application {
     std::optional<BenchmarkConfigSection> benchmark_config_;
     AllowUnsafeRpc allow_unsafe_rpc_ = AllowUnsafeRpc::kAuto;
     uint32_t parachain_runtime_instance_cache_size_ = 100;
+    uint32_t runtime_cache_limit_ = 8192;
     uint32_t parachain_precompilation_thread_num_ =
         std::thread::hardware_concurrency() / 2;
     bool should_precompile_parachain_modules_{true};
     bool use_pvf_subprocess_{true};
     size_t pvf_max_workers_{
         std::max<size_t>(std::thread::hardware_concurrency(), 1)};
+    uint32_t av_store_memory_limit_;
     bool disable_secure_mode_{false};
     std::optional<PrecompileWasmConfig> precompile_wasm_;
     uint32_t max_parallel_downloads_;
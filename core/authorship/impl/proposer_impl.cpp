@@ -95,13 +95,8 @@ namespace kagome::authorship {
                  parent_block);
       }
 
-      /// TODO(iceseer): switch to callback case(this case is needed to make
-      /// tests complete)
-
-      // Retrieve ready transactions from the transaction pool
-      std::vector<std::pair<primitives::Transaction::Hash,
-                            std::shared_ptr<const primitives::Transaction>>>
-          ready_txs = transaction_pool_->getReadyTransactions();
+      // Ready transactions are taken lazily, best first
+      auto ready_txs = transaction_pool_->readyTransactions();
 
       bool transaction_pushed = false;
       bool hit_block_size_limit = false;
@@ -120,16 +115,14 @@ namespace kagome::authorship {
       size_t included_tx_count = 0;
 
       // Iterate through the ready transactions
-      for (const auto &[hash, tx] : ready_txs) {
+      while (auto tx = ready_txs->next()) {
         // Check if the deadline has been reached
         if (deadline && clock_->now() >= deadline) {
           break;
         }
 
-        // Estimate the size of the transaction
-        scale::ScaleEncoderStream s(true);
-        s << tx->ext;
-        auto estimate_tx_size = s.size();
+        // Size of the encoded transaction is cached by transaction pool
+        auto estimate_tx_size = tx->bytes;
 
         // Check if adding the transaction would exceed the block size limit
         if (block_size + estimate_tx_size > block_size_limit) {
@@ -140,6 +133,7 @@ namespace kagome::authorship {
                 "Transaction would overflow the block size limit, but will "
                 "try {} more transactions before quitting.",
                 kMaxSkippedTransactions - skipped);
+            ready_txs->reportInvalid();
             continue;
           }
           // Reached the block size limit, stop adding transactions
@@ -153,6 +147,7 @@ namespace kagome::authorship {
         SL_DEBUG(logger_, "Adding extrinsic: {}", tx->ext.data);
         auto inserted_res = block_builder->pushExtrinsic(tx->ext);
         if (not inserted_res) {
+          ready_txs->reportInvalid();
           if (BlockBuilderError::EXHAUSTS_RESOURCES == inserted_res.error()) {
             if (skipped < kMaxSkippedTransactions) {
               // Skip the transaction and continue with the next one
@@ -177,7 +172,7 @@ namespace kagome::authorship {
           block_size += estimate_tx_size;
           transaction_pushed = true;
           ++included_tx_count;
-          included_hashes.emplace_back(hash);
+          included_hashes.emplace_back(tx->hash);
         }
       }
 
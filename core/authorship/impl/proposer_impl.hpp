@@ -71,7 +71,7 @@ namespace kagome::authorship {
      * 1. Creates a new block builder.
      * 2. Retrieves and adds the inherent extrinsics to the block.
      * 3. Removes stale transactions from the transaction pool.
-     * 4. Retrieves ready transactions from the transaction pool.
+     * 4. Takes ready transactions from the transaction pool, best first.
      * 5. Adds transactions to the block until the block size limit is reached
      * or the deadline is met.
      * 6. Finalizes the block construction and returns the built block.
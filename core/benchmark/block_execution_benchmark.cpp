@@ -13,6 +13,7 @@
 
 #include "blockchain/block_tree.hpp"
 #include "primitives/runtime_dispatch_info.hpp"
+#include "runtime/common/memory_allocator.hpp"
 #include "runtime/module_repository.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "storage/trie/trie_storage.hpp"
@@ -246,6 +247,10 @@ namespace kagome::benchmark {
 
     std::chrono::steady_clock clock;
 
+    // allocator of call is accounted when memory is reset for next call
+    runtime::MemoryAllocatorImpl::enableStats(true);
+    auto allocator_stats_before = runtime::MemoryAllocatorImpl::totalStats();
+
     std::vector<Stats<std::chrono::nanoseconds>> duration_stats;
     duration_stats.reserve(blocks.size());
     for (size_t i = 0; i < blocks.size(); i++) {
@@ -298,6 +303,22 @@ namespace kagome::benchmark {
               * 100.0);
     }
 
+    auto allocator_stats = runtime::MemoryAllocatorImpl::totalStats();
+    fmt::print("Runtime allocator, max heap {} bytes\n",
+               allocator_stats.max_heap);
+    for (size_t order = 0; order < allocator_stats.orders.size(); ++order) {
+      auto &stats = allocator_stats.orders[order];
+      auto allocations = stats.allocations
+                       - allocator_stats_before.orders[order].allocations;
+      if (allocations == 0) {
+        continue;
+      }
+      fmt::print("  chunk {} bytes: {} allocations, max in use {}\n",
+                 size_t{8} << order,
+                 allocations,
+                 stats.max_in_use);
+    }
+
     return outcome::success();
   }
 
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <span>
+
 #include "primitives/block.hpp"
 #include "primitives/block_data.hpp"
 #include "primitives/block_id.hpp"
@@ -13,6 +15,17 @@
 
 namespace kagome::blockchain {
 
+  /**
+   * Parts of block as they are stored, scale encoded.
+   * Missing or not requested parts are std::nullopt.
+   */
+  struct EncodedBlockData {
+    primitives::BlockHash hash;
+    std::optional<common::Buffer> header;
+    std::optional<common::Buffer> body;
+    std::optional<common::Buffer> justification;
+  };
+
   /**
    * A wrapper for a storage of blocks
    * Provides a convenient interface to work with it
@@ -105,6 +118,17 @@ namespace kagome::blockchain {
     virtual outcome::result<std::optional<primitives::BlockHeader>>
     tryGetBlockHeader(const primitives::BlockHash &block_hash) const = 0;
 
+    /**
+     * Finds ancestor of block {@param block} with number
+     * {@param ancestor_number}. Uses skip list of stored headers, so takes
+     * logarithmic number of reads of distance between blocks.
+     * @returns hash of ancestor, std::nullopt if ancestry of block is not
+     * stored, or error
+     */
+    virtual outcome::result<std::optional<primitives::BlockHash>>
+    getAncestorHash(const primitives::BlockInfo &block,
+                    primitives::BlockNumber ancestor_number) const = 0;
+
     // -- body --
 
     /**
@@ -172,6 +196,18 @@ namespace kagome::blockchain {
     virtual outcome::result<std::optional<primitives::BlockData>> getBlockData(
         const primitives::BlockHash &block_hash) const = 0;
 
+    /**
+     * Reads parts of blocks {@param block_hashes} without decoding, with one
+     * batched read per requested part
+     * @param header, body, justification - which parts to read
+     * @returns blocks in order of hashes, or error
+     */
+    virtual outcome::result<std::vector<EncodedBlockData>> getEncodedBlocks(
+        std::span<const primitives::BlockHash> block_hashes,
+        bool header,
+        bool body,
+        bool justification) const = 0;
+
     /**
      * Removes all data of block with hash {@param block_hash} from block
      * storage
@@ -17,6 +17,12 @@ namespace kagome::blockchain {
   using storage::Space;
   using Buffer = common::Buffer;
 
+  inline auto blockSkipKey(const primitives::BlockHash &block_hash) {
+    auto key = storage::kBlockSkipLookupPrefix;
+    key.put(block_hash);
+    return key;
+  }
+
   BlockStorageImpl::BlockStorageImpl(
       std::shared_ptr<storage::SpacedStorage> storage,
       std::shared_ptr<crypto::Hasher> hasher)
@@ -196,6 +202,9 @@ namespace kagome::blockchain {
     const auto &block_hash = header.hash();
     OUTCOME_TRY(putToSpace(
         *storage_, Space::kHeader, block_hash, std::move(encoded_header)));
+    header_cache_.exclusiveAccess(
+        [&](auto &cache) { cache.put(block_hash, header); });
+    OUTCOME_TRY(putSkip(header));
     return block_hash;
   }
 
@@ -214,6 +223,83 @@ namespace kagome::blockchain {
     return fetchBlockHeader(block_hash);
   }
 
+  outcome::result<std::optional<primitives::BlockHash>>
+  BlockStorageImpl::getAncestorHash(
+      const primitives::BlockInfo &block,
+      primitives::BlockNumber ancestor_number) const {
+    if (ancestor_number > block.number) {
+      return std::nullopt;
+    }
+    auto walk = block;
+    while (walk.number > ancestor_number) {
+      // Same walk as bitcoin's `CBlockIndex::GetAncestor`: follow skip pointer
+      // unless it overshoots, or skip pointer of parent is better
+      auto skip_number = skipNumber(walk.number);
+      auto parent_skip_number = skipNumber(walk.number - 1);
+      if (skip_number == ancestor_number
+          or (skip_number > ancestor_number
+              and not(parent_skip_number + 2 < skip_number
+                      and parent_skip_number >= ancestor_number))) {
+        OUTCOME_TRY(skip_opt, getSkip(walk.hash));
+        if (skip_opt.has_value()) {
+          walk = {skip_number, skip_opt.value()};
+          continue;
+        }
+      }
+      OUTCOME_TRY(header_opt, fetchBlockHeader(walk.hash));
+      if (not header_opt.has_value()) {
+        return std::nullopt;
+      }
+      walk = {walk.number - 1, header_opt->parent_hash};
+    }
+    return walk.hash;
+  }
+
+  primitives::BlockNumber BlockStorageImpl::skipNumber(
+      primitives::BlockNumber number) {
+    auto invert_lowest_one = [](primitives::BlockNumber n) {
+      return n & (n - 1);
+    };
+    if (number < 2) {
+      return 0;
+    }
+    // Odd numbers refer a bit further than even, so paths starting from
+    // any block converge quickly
+    return (number & 1) != 0
+             ? invert_lowest_one(invert_lowest_one(number - 1)) + 1
+             : invert_lowest_one(number);
+  }
+
+  outcome::result<std::optional<primitives::BlockHash>>
+  BlockStorageImpl::getSkip(const primitives::BlockHash &block_hash) const {
+    auto key_space = storage_->getSpace(Space::kLookupKey);
+    OUTCOME_TRY(data_opt, key_space->tryGet(blockSkipKey(block_hash)));
+    if (data_opt.has_value()) {
+      OUTCOME_TRY(hash, primitives::BlockHash::fromSpan(data_opt.value()));
+      return hash;
+    }
+    return std::nullopt;
+  }
+
+  outcome::result<void> BlockStorageImpl::putSkip(
+      const primitives::BlockHeader &header) {
+    auto skip_number = skipNumber(header.number);
+    if (header.number == 0 or skip_number + 1 >= header.number) {
+      // parent hash is already in header
+      return outcome::success();
+    }
+    OUTCOME_TRY(skip_opt, getAncestorHash(*header.parentInfo(), skip_number));
+    if (not skip_opt.has_value()) {
+      SL_TRACE(logger_,
+               "Ancestry of block {} is not stored, skip pointer is omitted",
+               header.blockInfo());
+      return outcome::success();
+    }
+    auto key_space = storage_->getSpace(Space::kLookupKey);
+    return key_space->put(blockSkipKey(header.hash()),
+                          Buffer{skip_opt.value()});
+  }
+
   outcome::result<void> BlockStorageImpl::putBlockBody(
       const primitives::BlockHash &block_hash,
       const primitives::BlockBody &block_body) {
@@ -281,10 +367,6 @@ namespace kagome::blockchain {
     // insert provided block's parts into the database
     OUTCOME_TRY(block_hash, putBlockHeader(block.header));
 
-    OUTCOME_TRY(encoded_header, scale::encode(block.header));
-    OUTCOME_TRY(putToSpace(
-        *storage_, Space::kHeader, block_hash, std::move(encoded_header)));
-
     OUTCOME_TRY(encoded_body, scale::encode(block.body));
     OUTCOME_TRY(putToSpace(
         *storage_, Space::kBlockBody, block_hash, std::move(encoded_body)));
@@ -318,8 +400,49 @@ namespace kagome::blockchain {
     return block_data;
   }
 
+  outcome::result<std::vector<EncodedBlockData>>
+  BlockStorageImpl::getEncodedBlocks(
+      std::span<const primitives::BlockHash> block_hashes,
+      bool header,
+      bool body,
+      bool justification) const {
+    std::vector<EncodedBlockData> blocks;
+    blocks.reserve(block_hashes.size());
+    std::vector<common::BufferView> keys;
+    keys.reserve(block_hashes.size());
+    for (const auto &block_hash : block_hashes) {
+      blocks.emplace_back(EncodedBlockData{.hash = block_hash});
+      keys.emplace_back(block_hash);
+    }
+
+    auto read = [&](Space space, std::optional<Buffer> EncodedBlockData::*part)
+        -> outcome::result<void> {
+      OUTCOME_TRY(values, storage_->getSpace(space)->tryGetMany(keys));
+      for (size_t i = 0; i < blocks.size(); ++i) {
+        if (values[i].has_value()) {
+          blocks[i].*part = std::move(*values[i]).intoBuffer();
+        }
+      }
+      return outcome::success();
+    };
+    if (header) {
+      OUTCOME_TRY(read(Space::kHeader, &EncodedBlockData::header));
+    }
+    if (body) {
+      OUTCOME_TRY(read(Space::kBlockBody, &EncodedBlockData::body));
+    }
+    if (justification) {
+      OUTCOME_TRY(
+          read(Space::kJustification, &EncodedBlockData::justification));
+    }
+    return blocks;
+  }
+
   outcome::result<void> BlockStorageImpl::removeBlock(
       const primitives::BlockHash &block_hash) {
+    header_cache_.exclusiveAccess(
+        [&](auto &cache) { cache.erase(block_hash); });
+
     // Check if block still in storage
     OUTCOME_TRY(header_opt, fetchBlockHeader(block_hash));
     if (not header_opt) {
@@ -370,6 +493,19 @@ namespace kagome::blockchain {
       return res;
     }
 
+    {  // Remove skip pointer of block
+      auto key_space = storage_->getSpace(Space::kLookupKey);
+      if (auto res = key_space->remove(blockSkipKey(block_hash));
+          res.has_error()) {
+        SL_ERROR(logger_,
+                 "could not remove skip pointer of block {} from the storage: "
+                 "{}",
+                 block_info,
+                 res.error());
+        return res;
+      }
+    }
+
     {  // Remove block header
       auto header_space = storage_->getSpace(Space::kHeader);
       if (auto res = header_space->remove(block_info.hash); res.has_error()) {
@@ -389,6 +525,16 @@ namespace kagome::blockchain {
   outcome::result<std::optional<primitives::BlockHeader>>
   BlockStorageImpl::fetchBlockHeader(
       const primitives::BlockHash &block_hash) const {
+    auto cached = header_cache_.exclusiveAccess(
+        [&](auto &cache) -> std::optional<primitives::BlockHeader> {
+          if (auto header = cache.get(block_hash)) {
+            return header->get();
+          }
+          return std::nullopt;
+        });
+    if (cached.has_value()) {
+      return cached;
+    }
     OUTCOME_TRY(encoded_header_opt,
                 getFromSpace(*storage_, Space::kHeader, block_hash));
     if (encoded_header_opt.has_value()) {
@@ -396,6 +542,8 @@ namespace kagome::blockchain {
           header,
           scale::decode<primitives::BlockHeader>(encoded_header_opt.value()));
       header.hash_opt.emplace(block_hash);
+      header_cache_.exclusiveAccess(
+          [&](auto &cache) { cache.put(block_hash, header); });
       return std::make_optional(std::move(header));
     }
     return std::nullopt;
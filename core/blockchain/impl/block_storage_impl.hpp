@@ -12,6 +12,8 @@
 #include "log/logger.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/spaced_storage.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome::blockchain {
 
@@ -66,6 +68,10 @@ namespace kagome::blockchain {
     outcome::result<std::optional<primitives::BlockHeader>> tryGetBlockHeader(
         const primitives::BlockHash &block_hash) const override;
 
+    outcome::result<std::optional<primitives::BlockHash>> getAncestorHash(
+        const primitives::BlockInfo &block,
+        primitives::BlockNumber ancestor_number) const override;
+
     // -- body --
 
     outcome::result<void> putBlockBody(
@@ -98,9 +104,18 @@ namespace kagome::blockchain {
     outcome::result<std::optional<primitives::BlockData>> getBlockData(
         const primitives::BlockHash &block_hash) const override;
 
+    outcome::result<std::vector<EncodedBlockData>> getEncodedBlocks(
+        std::span<const primitives::BlockHash> block_hashes,
+        bool header,
+        bool body,
+        bool justification) const override;
+
     outcome::result<void> removeBlock(
         const primitives::BlockHash &block_hash) override;
 
+    /// Number of recently used decoded headers kept in memory
+    static constexpr size_t kHeaderCacheSize = 4096;
+
    private:
     BlockStorageImpl(std::shared_ptr<storage::SpacedStorage> storage,
                      std::shared_ptr<crypto::Hasher> hasher);
@@ -108,12 +123,24 @@ namespace kagome::blockchain {
     outcome::result<std::optional<primitives::BlockHeader>> fetchBlockHeader(
         const primitives::BlockHash &block_hash) const;
 
+    /// Number of block which skip pointer of block {@param number} refers to
+    static primitives::BlockNumber skipNumber(primitives::BlockNumber number);
+
+    outcome::result<std::optional<primitives::BlockHash>> getSkip(
+        const primitives::BlockHash &block_hash) const;
+
+    /// Stores skip pointer of block, if its ancestry is known
+    outcome::result<void> putSkip(const primitives::BlockHeader &header);
+
     std::shared_ptr<storage::SpacedStorage> storage_;
     std::shared_ptr<crypto::Hasher> hasher_;
 
     mutable std::optional<std::vector<primitives::BlockHash>>
         block_tree_leaves_;
 
+    mutable SafeObject<Lru<primitives::BlockHash, primitives::BlockHeader>>
+        header_cache_{kHeaderCacheSize};
+
     log::Logger logger_;
   };
 }  // namespace kagome::blockchain
@@ -1072,6 +1072,15 @@ namespace kagome::blockchain {
             return BlockTreeError::TARGET_IS_PAST_MAX;
           }
           auto count = to - from + 1;
+          // Reject forks before collecting whole chain
+          OUTCOME_TRY(ancestor_opt,
+                      p.storage_->getAncestorHash({to, descendant}, from));
+          if (not ancestor_opt.has_value()) {
+            return BlockTreeError::EXISTING_BLOCK_NOT_FOUND;
+          }
+          if (ancestor_opt.value() != ancestor) {
+            return BlockTreeError::BLOCK_ON_DEAD_END;
+          }
           OUTCOME_TRY(chain,
                       getDescendingChainToBlockNoLock(p, descendant, count));
           if (chain.size() != count) {
@@ -1146,20 +1155,11 @@ namespace kagome::blockchain {
       return finalized(ancestor, ancestor_depth);
     }
 
-    auto current_hash = descendant;
     KAGOME_PROFILE_START(search_finalized_chain)
-    while (current_hash != ancestor) {
-      auto current_header_res = p.storage_->getBlockHeader(current_hash);
-      if (!current_header_res) {
-        return false;
-      }
-      if (current_header_res.value().number <= ancestor_depth) {
-        return false;
-      }
-      current_hash = current_header_res.value().parent_hash;
-    }
+    auto ancestor_res = p.storage_->getAncestorHash(
+        {descendant_depth, descendant}, ancestor_depth);
     KAGOME_PROFILE_END(search_finalized_chain)
-    return true;
+    return ancestor_res.has_value() and ancestor_res.value() == ancestor;
   }
 
   bool BlockTreeImpl::hasDirectChain(
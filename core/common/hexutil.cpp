@@ -6,6 +6,9 @@
 
 #include "common/hexutil.hpp"
 
+#include <array>
+#include <cstring>
+
 #include <qtils/hex.hpp>
 #include <qtils/unhex.hpp>
 
@@ -29,12 +32,37 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::common, UnhexError, e) {
 }
 
 namespace kagome::common {
+  namespace {
+    /// Both hex digits of each byte, so byte is encoded with single lookup
+    constexpr auto kHexPairs = [] {
+      constexpr std::string_view kDigits = "0123456789abcdef";
+      std::array<std::array<char, 2>, 256> pairs{};
+      for (size_t i = 0; i < pairs.size(); ++i) {
+        pairs[i] = {kDigits[i >> 4], kDigits[i & 0xf]};
+      }
+      return pairs;
+    }();
+  }  // namespace
+
+  void hex_lower_to(BufferView bytes, char *out) {
+    for (auto byte : bytes) {
+      std::memcpy(out, kHexPairs[byte].data(), 2);
+      out += 2;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
   std::string hex_lower(BufferView bytes) {
-    return fmt::format("{:x}", std::span{bytes});
+    std::string hex(2 * bytes.size(), '\0');
+    hex_lower_to(bytes, hex.data());
+    return hex;
   }
 
   std::string hex_lower_0x(BufferView bytes) {
-    return fmt::format("{:0x}", std::span{bytes});
+    std::string hex(2 + 2 * bytes.size(), '\0');
+    hex[0] = '0';
+    hex[1] = 'x';
+    hex_lower_to(bytes, hex.data() + 2);
+    return hex;
   }
 
   outcome::result<std::vector<uint8_t>> unhex(std::string_view hex) {
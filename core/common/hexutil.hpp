@@ -46,6 +46,13 @@ namespace kagome::common {
    */
   std::string hex_lower_0x(BufferView bytes);
 
+  /**
+   * @brief Writes lowercase hex representation of bytes without prefix
+   * @param bytes bytes
+   * @param out destination of `2 * bytes.size()` chars
+   */
+  void hex_lower_to(BufferView bytes, char *out);
+
   template <std::output_iterator<uint8_t> Iter>
   outcome::result<void> unhex_to(std::string_view hex, Iter out) {
     try {
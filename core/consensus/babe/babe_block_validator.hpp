@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
+
 #include "primitives/block.hpp"
 
 namespace kagome::consensus::babe {
@@ -16,6 +19,20 @@ namespace kagome::consensus::babe {
 
     virtual outcome::result<void> validateHeader(
         const primitives::BlockHeader &header) const = 0;
+
+    /// Seal and VRF check, which may run on any thread
+    using Precheck = std::function<void()>;
+
+    /**
+     * Resolves epoch config for queued header ahead of its import.
+     * Successful result of returned check is remembered, so `validateHeader`
+     * doesn't repeat it. Must be called on thread of `validateHeader`.
+     * @param ancestor imported ancestor of header
+     * @returns nullopt if header is not in epoch of `ancestor`
+     */
+    virtual std::optional<Precheck> precheckHeader(
+        const primitives::BlockHeader &header,
+        const primitives::BlockHeader &ancestor) const = 0;
   };
 
 }  // namespace kagome::consensus::babe
@@ -185,20 +185,105 @@ namespace kagome::consensus::babe {
       }
     }
 
+    const Prechecked prechecked{
+        .epoch_number = epoch_number,
+        .authority_id = authority_id,
+        .threshold = threshold,
+        .randomness = babe_config.randomness,
+    };
+
+    // seal may be checked ahead of import with the same epoch config
+    if (header.hash_opt.has_value()) {
+      auto found = prechecked_.exclusiveAccess([&](auto &lru) {
+        auto it = lru.get(header.hash());
+        if (not it or it->get() != prechecked) {
+          return false;
+        }
+        lru.erase(header.hash());
+        return true;
+      });
+      if (found) {
+        return outcome::success();
+      }
+    }
+
+    return verifySeal(header, babe_header, prechecked);
+  }
+
+  std::optional<BabeBlockValidator::Precheck>
+  BabeBlockValidatorImpl::precheckHeader(
+      const primitives::BlockHeader &header,
+      const primitives::BlockHeader &ancestor) const {
+    auto babe_header_res = getBabeBlockHeader(header);
+    auto ancestor_babe_header_res = getBabeBlockHeader(ancestor);
+    if (not babe_header_res or not ancestor_babe_header_res
+        or not ancestor.parentInfo() or not header.hash_opt) {
+      return std::nullopt;
+    }
+    auto &babe_header = babe_header_res.value();
+
+    // config of next epoch may be announced by queued block,
+    // so header is checked in order of import
+    auto slots_util = slots_util_.get();
+    auto ancestor_epoch_res = slots_util->slotToEpoch(
+        *ancestor.parentInfo(), ancestor_babe_header_res.value().slot_number);
+    auto epoch_res =
+        slots_util->slotToEpoch(ancestor.blockInfo(), babe_header.slot_number);
+    if (not ancestor_epoch_res or not epoch_res
+        or epoch_res.value() != ancestor_epoch_res.value()) {
+      return std::nullopt;
+    }
+    auto config_res =
+        config_repo_->config(ancestor.blockInfo(), epoch_res.value());
+    if (not config_res) {
+      return std::nullopt;
+    }
+    auto &config = *config_res.value();
+    if (babe_header.authority_index >= config.authorities.size()) {
+      return std::nullopt;
+    }
+
+    Prechecked prechecked{
+        .epoch_number = epoch_res.value(),
+        .authority_id = config.authorities[babe_header.authority_index].id,
+        .threshold = calculateThreshold(config.leadership_rate,
+                                        config.authorities,
+                                        babe_header.authority_index),
+        .randomness = config.randomness,
+    };
+    return [weak{weak_from_this()},
+            header,
+            babe_header,
+            prechecked{std::move(prechecked)}] {
+      auto self = weak.lock();
+      if (not self) {
+        return;
+      }
+      if (self->verifySeal(header, babe_header, prechecked)) {
+        self->prechecked_.exclusiveAccess(
+            [&](auto &lru) { lru.put(header.hash(), prechecked); });
+      }
+    };
+  }
+
+  outcome::result<void> BabeBlockValidatorImpl::verifySeal(
+      const primitives::BlockHeader &header,
+      const BabeBlockHeader &babe_header,
+      const Prechecked &prechecked) const {
     OUTCOME_TRY(seal, getSeal(header));
 
     // signature in seal of the header must be valid
-    if (!verifySignature(header, seal, authority_id)) {
+    if (!verifySignature(header, seal, prechecked.authority_id)) {
       return ValidationError::INVALID_SIGNATURE;
     }
 
     // VRF must prove that the peer is the leader of the slot
     if (babe_header.needVRFCheck()
         && !verifyVRF(babe_header,
-                      epoch_number,
-                      authority_id,
-                      threshold,
-                      babe_config.randomness,
+                      prechecked.epoch_number,
+                      prechecked.authority_id,
+                      prechecked.threshold,
+                      prechecked.randomness,
                       babe_header.needVRFWithThresholdCheck())) {
       return ValidationError::INVALID_VRF;
     }
@@ -17,6 +17,8 @@
 #include "primitives/block.hpp"
 #include "primitives/event_types.hpp"
 #include "telemetry/service.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome::application {
   class AppStateManager;
@@ -61,7 +63,11 @@ namespace kagome::consensus::babe {
     void prepare();
 
     outcome::result<void> validateHeader(
-        const primitives::BlockHeader &block_header) const;
+        const primitives::BlockHeader &block_header) const override;
+
+    std::optional<Precheck> precheckHeader(
+        const primitives::BlockHeader &header,
+        const primitives::BlockHeader &ancestor) const override;
 
     enum class ValidationError {
       NO_VALIDATOR = 1,
@@ -73,6 +79,19 @@ namespace kagome::consensus::babe {
     };
 
    private:
+    /// Max number of remembered successful prechecks
+    static constexpr size_t kMaxPrechecked = 256;
+
+    /// Epoch config seal and VRF of header were checked with ahead of import
+    struct Prechecked {
+      EpochNumber epoch_number;
+      AuthorityId authority_id;
+      Threshold threshold;
+      Randomness randomness;
+
+      bool operator==(const Prechecked &) const = default;
+    };
+
     /**
      * Validate the block header
      * @param block to be validated
@@ -87,6 +106,14 @@ namespace kagome::consensus::babe {
         const babe::AuthorityId &authority_id,
         const Threshold &threshold,
         const babe::BabeConfiguration &config) const;
+    /**
+     * Verify signature in seal and VRF of the block header
+     * @return nothing or validation error
+     */
+    outcome::result<void> verifySeal(const primitives::BlockHeader &header,
+                                     const BabeBlockHeader &babe_header,
+                                     const Prechecked &prechecked) const;
+
     /**
      * Verify that block is signed by valid signature
      * @param header Header to be checked
@@ -125,6 +152,9 @@ namespace kagome::consensus::babe {
     std::shared_ptr<runtime::BabeApi> babe_api_;
     primitives::events::SyncStateSubscriptionEnginePtr sync_state_observable_;
 
+    mutable SafeObject<Lru<primitives::BlockHash, Prechecked>> prechecked_{
+        kMaxPrechecked};
+
     bool was_synchronized_ = false;
     std::shared_ptr<void> sync_state_observer_;
   };
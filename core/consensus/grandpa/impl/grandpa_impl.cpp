@@ -22,6 +22,7 @@
 #include "consensus/grandpa/grandpa_context.hpp"
 #include "consensus/grandpa/has_authority_set_change.hpp"
 #include "consensus/grandpa/impl/grandpa_thread_pool.hpp"
+#include "consensus/grandpa/impl/justification_verifier.hpp"
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
 #include "consensus/grandpa/impl/vote_tracker_impl.hpp"
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
@@ -79,6 +80,7 @@ namespace kagome::consensus::grandpa {
       std::shared_ptr<crypto::Hasher> hasher,
       std::shared_ptr<Environment> environment,
       std::shared_ptr<crypto::Ed25519Provider> crypto_provider,
+      std::shared_ptr<JustificationVerifier> justification_verifier,
       std::shared_ptr<crypto::SessionKeys> session_keys,
       std::shared_ptr<AuthorityManager> authority_manager,
       std::shared_ptr<network::Synchronizer> synchronizer,
@@ -94,6 +96,7 @@ namespace kagome::consensus::grandpa {
         hasher_{std::move(hasher)},
         environment_{std::move(environment)},
         crypto_provider_{std::move(crypto_provider)},
+        justification_verifier_{std::move(justification_verifier)},
         session_keys_{std::move(session_keys)},
         authority_manager_(std::move(authority_manager)),
         synchronizer_(std::move(synchronizer)),
@@ -112,6 +115,7 @@ namespace kagome::consensus::grandpa {
             libp2p::basic::Scheduler::Config{})} {
     BOOST_ASSERT(environment_ != nullptr);
     BOOST_ASSERT(crypto_provider_ != nullptr);
+    BOOST_ASSERT(justification_verifier_ != nullptr);
     BOOST_ASSERT(authority_manager_ != nullptr);
     BOOST_ASSERT(synchronizer_ != nullptr);
     BOOST_ASSERT(peer_manager_ != nullptr);
@@ -1150,24 +1154,7 @@ namespace kagome::consensus::grandpa {
   outcome::result<void> GrandpaImpl::verifyJustification(
       const GrandpaJustification &justification,
       const AuthoritySet &authorities) {
-    auto voters = VoterSet::make(authorities).value();
-    MovableRoundState state;
-    state.round_number = justification.round_number;
-    auto round = std::make_shared<VotingRoundImpl>(
-        shared_from_this(),
-        GrandpaConfig{.voters = voters,
-                      .round_number = justification.round_number},
-        hasher_,
-        environment_,
-        std::make_shared<VoteCryptoProviderImpl>(
-            nullptr, crypto_provider_, justification.round_number, voters),
-        std::make_shared<VoteTrackerImpl>(),
-        std::make_shared<VoteTrackerImpl>(),
-        std::make_shared<VoteGraphImpl>(
-            primitives::BlockInfo{}, voters, environment_),
-        scheduler_,
-        state);
-    return round->validatePrecommitJustification(justification);
+    return justification_verifier_->verify(justification, authorities);
   }
 
   void GrandpaImpl::applyJustification(
@@ -46,6 +46,7 @@ namespace kagome::consensus::grandpa {
   class AuthorityManager;
   class Environment;
   struct MovableRoundState;
+  class JustificationVerifier;
   class VoterSet;
   class GrandpaThreadPool;
 }  // namespace kagome::consensus::grandpa
@@ -109,6 +110,7 @@ namespace kagome::consensus::grandpa {
         std::shared_ptr<crypto::Hasher> hasher,
         std::shared_ptr<Environment> environment,
         std::shared_ptr<crypto::Ed25519Provider> crypto_provider,
+        std::shared_ptr<JustificationVerifier> justification_verifier,
         std::shared_ptr<crypto::SessionKeys> session_keys,
         std::shared_ptr<AuthorityManager> authority_manager,
         std::shared_ptr<network::Synchronizer> synchronizer,
@@ -259,6 +261,7 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<Environment> environment_;
     std::shared_ptr<crypto::Ed25519Provider> crypto_provider_;
+    std::shared_ptr<JustificationVerifier> justification_verifier_;
     std::shared_ptr<crypto::SessionKeys> session_keys_;
     std::shared_ptr<AuthorityManager> authority_manager_;
     std::shared_ptr<network::Synchronizer> synchronizer_;
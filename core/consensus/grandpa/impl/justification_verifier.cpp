@@ -0,0 +1,175 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/justification_verifier.hpp"
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "blockchain/block_tree.hpp"
+#include "common/worker_thread_pool.hpp"
+#include "consensus/grandpa/ancestry_verifier.hpp"
+#include "consensus/grandpa/voter_set.hpp"
+#include "consensus/grandpa/voting_round_error.hpp"
+#include "crypto/ed25519_provider.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace kagome::consensus::grandpa {
+  JustificationVerifier::JustificationVerifier(
+      std::shared_ptr<crypto::Hasher> hasher,
+      std::shared_ptr<crypto::Ed25519Provider> ed_provider,
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      common::WorkerThreadPool &worker_thread_pool)
+      : hasher_{std::move(hasher)},
+        ed_provider_{std::move(ed_provider)},
+        block_tree_{std::move(block_tree)},
+        worker_io_{worker_thread_pool.io_context()},
+        logger_{log::createLogger("JustificationVerifier", "grandpa")} {
+    BOOST_ASSERT(hasher_ != nullptr);
+    BOOST_ASSERT(ed_provider_ != nullptr);
+    BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(worker_io_ != nullptr);
+  }
+
+  outcome::result<void> JustificationVerifier::verify(
+      const GrandpaJustification &justification,
+      const AuthoritySet &authorities) const {
+    OUTCOME_TRY(voters, VoterSet::make(authorities));
+    // Weight is cheap to check, so reject insufficient justification before
+    // verifying signatures
+    OUTCOME_TRY(verifyWeight(justification, *voters));
+    if (not verifySignatures(justification, voters->id())) {
+      return VotingRoundError::INVALID_SIGNATURE;
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> JustificationVerifier::verifyWeight(
+      const GrandpaJustification &justification, const VoterSet &voters) const {
+    AncestryVerifier ancestry_verifier(justification.votes_ancestries,
+                                       *hasher_);
+    auto has_ancestry = [&](const primitives::BlockInfo &ancestor,
+                            const primitives::BlockInfo &descendant) {
+      return ancestry_verifier.hasAncestry(ancestor, descendant)
+          or block_tree_->hasDirectChain(ancestor, descendant);
+    };
+
+    auto faulty = (voters.totalWeight() - 1) / 3;
+    size_t threshold = voters.totalWeight() - faulty;
+    size_t total_weight = 0;
+    std::unordered_map<Id, primitives::BlockInfo> votes;
+    std::unordered_set<Id> equivocators;
+
+    for (const auto &signed_precommit : justification.items) {
+      if (auto [it, success] = votes.emplace(signed_precommit.id,
+                                             signed_precommit.getBlockInfo());
+          success) {
+        // New vote
+        auto weight_opt = voters.voterWeight(signed_precommit.id);
+        if (not weight_opt) {
+          SL_DEBUG(logger_,
+                   "Voter {} is not in the current voter set",
+                   signed_precommit.id);
+          continue;
+        }
+        if (has_ancestry(justification.block_info,
+                         signed_precommit.getBlockInfo())) {
+          total_weight += weight_opt.value();
+        } else {
+          SL_DEBUG(logger_,
+                   "Vote does not have ancestry with target block: "
+                   "vote={} target={}",
+                   signed_precommit.getBlockInfo(),
+                   justification.block_info);
+        }
+      } else if (equivocators.emplace(signed_precommit.id).second) {
+        // Detected equivocation
+        auto weight_opt = voters.voterWeight(signed_precommit.id);
+        if (not weight_opt) {
+          continue;
+        }
+        if (has_ancestry(justification.block_info, it->second)) {
+          total_weight -= weight_opt.value();
+          threshold -= weight_opt.value();
+        }
+      } else {
+        SL_WARN(logger_,
+                "Round #{}: Received third precommit of caught equivocator "
+                "from {}",
+                justification.round_number,
+                signed_precommit.id);
+        return VotingRoundError::REDUNDANT_EQUIVOCATION;
+      }
+    }
+
+    if (total_weight < threshold) {
+      SL_WARN(logger_,
+              "Round #{}: Received justification does not have super-majority: "
+              "total_weight={} < threshold={}",
+              justification.round_number,
+              total_weight,
+              threshold);
+      return VotingRoundError::NOT_ENOUGH_WEIGHT;
+    }
+    return outcome::success();
+  }
+
+  bool JustificationVerifier::verifySignatures(
+      const GrandpaJustification &justification, VoterSetId set_id) const {
+    const auto count = justification.items.size();
+    const auto chunks = (count + kChunkSize - 1) / kChunkSize;
+    if (chunks <= 1) {
+      return verifySignatures(justification, set_id, 0, count);
+    }
+
+    std::atomic_bool invalid = false;
+    parallelFor(*worker_io_,
+                std::max<size_t>(1, std::thread::hardware_concurrency()),
+                chunks,
+                [&](size_t chunk) {
+                  // remaining chunks are skipped after first invalid
+                  if (invalid.load()) {
+                    return;
+                  }
+                  auto begin = chunk * kChunkSize;
+                  auto end = std::min(begin + kChunkSize, count);
+                  if (not verifySignatures(justification, set_id, begin, end)) {
+                    invalid.store(true);
+                  }
+                });
+    return not invalid.load();
+  }
+
+  bool JustificationVerifier::verifySignatures(
+      const GrandpaJustification &justification,
+      VoterSetId set_id,
+      size_t begin,
+      size_t end) const {
+    for (auto i = begin; i < end; ++i) {
+      const auto &signed_precommit = justification.items[i];
+      if (not signed_precommit.is<Precommit>()) {
+        return false;
+      }
+      auto payload = scale::encode(signed_precommit.message,
+                                   justification.round_number,
+                                   set_id)
+                         .value();
+      auto res = ed_provider_->verify(
+          signed_precommit.signature, payload, signed_precommit.id);
+      if (not res or not res.value()) {
+        SL_WARN(
+            logger_,
+            "Round #{}: Precommit signed by {} was rejected: invalid signature",
+            justification.round_number,
+            signed_precommit.id);
+        return false;
+      }
+    }
+    return true;
+  }
+}  // namespace kagome::consensus::grandpa
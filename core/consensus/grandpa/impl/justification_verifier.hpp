@@ -0,0 +1,73 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <boost/asio/io_context.hpp>
+
+#include "consensus/grandpa/structs.hpp"
+#include "consensus/grandpa/types/authority.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::blockchain {
+  class BlockTree;
+}  // namespace kagome::blockchain
+
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
+namespace kagome::crypto {
+  class Ed25519Provider;
+  class Hasher;
+}  // namespace kagome::crypto
+
+namespace kagome::consensus::grandpa {
+  class VoterSet;
+
+  /**
+   * Verifies GRANDPA justifications without constructing voting round.
+   * Votes weight and ancestry are checked first using ancestry proof of
+   * justification and block tree. Then precommit signatures are verified in
+   * chunks, spread over worker pool. Calling thread takes chunks too, so
+   * verification never waits for busy or stopped worker pool.
+   */
+  class JustificationVerifier {
+   public:
+    JustificationVerifier(std::shared_ptr<crypto::Hasher> hasher,
+                          std::shared_ptr<crypto::Ed25519Provider> ed_provider,
+                          std::shared_ptr<blockchain::BlockTree> block_tree,
+                          common::WorkerThreadPool &worker_thread_pool);
+
+    /// Signatures verified by one worker task at once
+    static constexpr size_t kChunkSize = 32;
+
+    outcome::result<void> verify(const GrandpaJustification &justification,
+                                 const AuthoritySet &authorities) const;
+
+   private:
+    /// Checks that votes descending from justified block have supermajority
+    outcome::result<void> verifyWeight(
+        const GrandpaJustification &justification,
+        const VoterSet &voters) const;
+
+    /// Checks signatures of all precommits
+    bool verifySignatures(const GrandpaJustification &justification,
+                          VoterSetId set_id) const;
+
+    /// Checks signatures of precommits in [begin, end)
+    bool verifySignatures(const GrandpaJustification &justification,
+                          VoterSetId set_id,
+                          size_t begin,
+                          size_t end) const;
+
+    std::shared_ptr<crypto::Hasher> hasher_;
+    std::shared_ptr<crypto::Ed25519Provider> ed_provider_;
+    std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<boost::asio::io_context> worker_io_;
+    log::Logger logger_;
+  };
+}  // namespace kagome::consensus::grandpa
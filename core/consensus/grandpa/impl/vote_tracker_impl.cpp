@@ -13,14 +13,14 @@ namespace kagome::consensus::grandpa {
 
   VoteTracker::PushResult VoteTrackerImpl::push(const SignedMessage &vote,
                                                 size_t weight) {
-    auto vote_it = messages_.find(vote.id);
-    if (vote_it == messages_.end()) {
-      messages_[vote.id] = vote;
+    auto [index_it, inserted] = index_.try_emplace(vote.id, messages_.size());
+    if (inserted) {
+      messages_.emplace_back(vote);
       total_weight_ += weight;
       return PushResult::SUCCESS;
     }
 
-    auto &known_vote_variant = vote_it->second;
+    auto &known_vote_variant = messages_[index_it->second];
 
     return visit_in_place(
         known_vote_variant,
@@ -31,7 +31,7 @@ namespace kagome::consensus::grandpa {
           }
 
           // Otherwise, it's another vote of known voter, make it equivocation
-          messages_[vote.id] = EquivocatorySignedMessage(known_vote, vote);
+          known_vote_variant = EquivocatorySignedMessage(known_vote, vote);
           return PushResult::EQUIVOCATED;
         },
         [](const EquivocatorySignedMessage &) {
@@ -41,35 +41,43 @@ namespace kagome::consensus::grandpa {
   }
 
   void VoteTrackerImpl::unpush(const SignedMessage &vote, size_t weight) {
-    auto vote_it = messages_.find(vote.id);
-    if (vote_it == messages_.end()) {
+    auto index_it = index_.find(vote.id);
+    if (index_it == index_.end()) {
       return;
     }
-    auto &existing_vote = vote_it->second;
-    visit_in_place(
-        existing_vote,
+    auto index = index_it->second;
+    auto matches = visit_in_place(
+        messages_[index],
         [&](const SignedMessage &voting_message) {
-          if (voting_message == vote) {
-            messages_.erase(vote_it);
-            total_weight_ -= weight;
-          }
+          return voting_message == vote;
         },
-        [](const auto &...) {});
+        [](const EquivocatorySignedMessage &) { return false; });
+    if (not matches) {
+      return;
+    }
+    index_.erase(index_it);
+    // move last vote into freed position
+    if (index + 1 != messages_.size()) {
+      messages_[index] = std::move(messages_.back());
+      auto moved_id = visit_in_place(
+          messages_[index],
+          [](const SignedMessage &voting_message) { return voting_message.id; },
+          [](const EquivocatorySignedMessage &equivocation) {
+            return equivocation.first.id;
+          });
+      index_[moved_id] = index;
+    }
+    messages_.pop_back();
+    total_weight_ -= weight;
   }
 
   std::vector<VoteVariant> VoteTrackerImpl::getMessages() const {
-    std::vector<VoteVariant> votes;
-    // the actual number may be bigger, but it's a good guess
-    votes.reserve(messages_.size());
-    for (const auto &[key, value] : messages_) {
-      votes.push_back(value);
-    }
-    return votes;
+    return messages_;
   }
 
   std::optional<VoteVariant> VoteTrackerImpl::getMessage(Id id) const {
-    if (auto it = messages_.find(id); it != messages_.end()) {
-      return it->second;
+    if (auto it = index_.find(id); it != index_.end()) {
+      return messages_[it->second];
     }
     return std::nullopt;
   }
@@ -8,8 +8,14 @@
 
 #include "consensus/grandpa/vote_tracker.hpp"
 
+#include <unordered_map>
+
 namespace kagome::consensus::grandpa {
 
+  /**
+   * Keeps votes densely in order of arrival, voter id maps to position of its
+   * vote
+   */
   class VoteTrackerImpl : public VoteTracker {
    public:
     PushResult push(const SignedMessage &vote, size_t weight) override;
@@ -23,7 +29,8 @@ namespace kagome::consensus::grandpa {
     size_t getTotalWeight() const override;
 
    private:
-    std::map<Id, VoteVariant> messages_;
+    std::vector<VoteVariant> messages_;
+    std::unordered_map<Id, size_t> index_;
     size_t total_weight_ = 0;
   };
 
@@ -707,7 +707,7 @@ namespace kagome::consensus::grandpa {
       // Skip known equivocators
       if (auto index = voter_set_->voterIndex(signed_precommit.id);
           index.has_value()) {
-        if (precommit_equivocators_.at(index.value())) {
+        if (precommit_equivocators_.test(index.value())) {
           continue;
         }
       }
@@ -1110,7 +1110,7 @@ namespace kagome::consensus::grandpa {
     auto [type, type_str_, equivocators, tracker] =
         [&]() -> std::tuple<VoteType,
                             const char *const,
-                            std::vector<bool> &,
+                            VoterBitset &,
                             VoteTracker &> {
       if constexpr (std::is_same_v<T, Prevote>) {
         return {
@@ -1281,18 +1281,12 @@ namespace kagome::consensus::grandpa {
     const auto tolerated_equivocations = voter_set_->totalWeight() - threshold_;
 
     // get total weight of all equivocators
-    // NOLINTNEXTLINE(boost-use-ranges)
-    const auto current_equivocations = std::accumulate(
-        precommit_equivocators_.begin(),
-        precommit_equivocators_.end(),
-        0ul,
-        [this, index = 0ul](size_t sum, auto isEquivocator) mutable -> size_t {
-          if (not isEquivocator) {
-            ++index;
-            return sum;
-          }
-          return sum + voter_set_->voterWeight(index++).value();
-        });
+    size_t current_equivocations = 0;
+    for (auto index = precommit_equivocators_.find_first();
+         index != VoterBitset::npos;
+         index = precommit_equivocators_.find_next(index)) {
+      current_equivocations += voter_set_->voterWeight(index).value();
+    }
 
     const auto additional_equivocations =
         tolerated_equivocations - current_equivocations;
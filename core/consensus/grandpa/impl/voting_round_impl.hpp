@@ -10,6 +10,7 @@
 
 #include <libp2p/basic/scheduler.hpp>
 
+#include "consensus/grandpa/vote_weight.hpp"
 #include "log/logger.hpp"
 
 namespace kagome::consensus::grandpa {
@@ -334,8 +335,8 @@ namespace kagome::consensus::grandpa {
 
     // equivocators arrays. Index in vector corresponds to the index of voter in
     // voter set, value corresponds to the weight of the voter
-    std::vector<bool> prevote_equivocators_;
-    std::vector<bool> precommit_equivocators_;
+    VoterBitset prevote_equivocators_;
+    VoterBitset precommit_equivocators_;
 
     // Proposed primary vote.
     // It's best final candidate of previous round
@@ -282,15 +282,15 @@ namespace kagome::consensus::grandpa {
       }
     }
 
-    Entry active_node = entries_.at(node_key);
-    if (not condition(active_node.cumulative_vote)) {
+    const Entry *active_node = &entries_.at(node_key);
+    if (not condition(active_node->cumulative_vote)) {
       return std::nullopt;
     }
 
     /// entries to be processed
     std::stack<std::reference_wrapper<const Entry>> nodes;
 
-    nodes.emplace(active_node);
+    nodes.emplace(*active_node);
     while (not nodes.empty()) {
       auto &node = nodes.top().get();
       nodes.pop();
@@ -308,12 +308,12 @@ namespace kagome::consensus::grandpa {
           continue;
         }
 
-        if (descendant.number > active_node.number
-            or (descendant.number == active_node.number
-                and active_node.cumulative_vote.sum(vote_type)
+        if (descendant.number > active_node->number
+            or (descendant.number == active_node->number
+                and active_node->cumulative_vote.sum(vote_type)
                         < descendant.cumulative_vote.sum(vote_type))) {
           node_key = descendant_hash;
-          active_node = descendant;
+          active_node = &descendant;
 
           nodes.emplace(descendant);
         }
@@ -326,7 +326,7 @@ namespace kagome::consensus::grandpa {
         force_constrain ? current_best : std::nullopt;
 
     Subchain subchain =
-        ghostFindMergePoint(vote_type, node_key, active_node, info, condition);
+        ghostFindMergePoint(vote_type, node_key, *active_node, info, condition);
     auto &hashes = subchain.hashes;
 
     if (hashes.empty()) {
@@ -361,7 +361,7 @@ namespace kagome::consensus::grandpa {
     size_t offset = 0;
     while (true) {
       std::optional<BlockHash> new_best;
-      std::optional<VoteWeight> new_best_vote_weight;
+      const VoteWeight *new_best_vote_weight = nullptr;
 
       ++offset;
       for (const auto &d_node : descendants) {
@@ -372,22 +372,21 @@ namespace kagome::consensus::grandpa {
         }
 
         BlockHash &d_block = ancestor_opt.value();
-        auto it = descendant_blocks.find(d_block);
-        if (it == descendant_blocks.end()) {
-          // if not found, insert then
-          descendant_blocks[d_block] = entry.cumulative_vote;
-        } else {
+        auto [it, inserted] =
+            descendant_blocks.try_emplace(d_block, entry.cumulative_vote);
+        if (not inserted) {
           // if found, update weight
-          descendant_blocks[d_block].merge(entry.cumulative_vote, voter_set_);
+          auto &weight = it->second;
+          weight.merge(entry.cumulative_vote, voter_set_);
 
           // check if block fulfills condition
-          if (condition(descendant_blocks[d_block])) {
+          if (condition(weight)) {
             if (not new_best_vote_weight
                 or new_best_vote_weight->sum(vote_type)
-                       < descendant_blocks[d_block].sum(vote_type)) {
+                       < weight.sum(vote_type)) {
               // we found our best block
               new_best = d_block;
-              new_best_vote_weight = descendant_blocks[d_block];
+              new_best_vote_weight = &weight;
             }
           }
         }
@@ -16,6 +16,9 @@
 
 namespace kagome::consensus::grandpa {
 
+  /// Dense set of voters, indexed by position in voter set
+  using VoterBitset = boost::dynamic_bitset<uint64_t>;
+
   /**
    * Vote weight is a structure that keeps track of who voted for the vote and
    * with which weight
@@ -26,17 +29,18 @@ namespace kagome::consensus::grandpa {
     using Weight = size_t;
 
     struct OneTypeVoteWeight {
-      std::vector<bool> flags;
+      /// voters, indexed by position in voter set
+      VoterBitset flags;
       Weight sum = 0;
 
       void set(size_t index, size_t weight) {
         if (flags.size() <= index) {
-          flags.resize(index + 1, 0);
+          flags.resize(index + 1, false);
         }
-        if (flags[index]) {
+        if (flags.test(index)) {
           return;
         }
-        flags[index] = true;
+        flags.set(index);
         sum += weight;
       }
 
@@ -44,22 +48,22 @@ namespace kagome::consensus::grandpa {
         if (flags.size() <= index) {
           return;
         }
-        if (not flags[index]) {
+        if (not flags.test(index)) {
           return;
         }
-        flags[index] = false;
+        flags.reset(index);
         sum -= weight;
       }
 
-      Weight total(const std::vector<bool> &equivocators,
+      Weight total(const VoterBitset &equivocators,
                    const VoterSet &voter_set) const {
         Weight result = sum;
 
-        for (size_t i = voter_set.size(); i > 0;) {
-          --i;
-
-          if ((flags.size() <= i or not flags[i]) and equivocators.size() > i
-              and equivocators[i]) {
+        // equivocators are few, visit only them
+        for (auto i = equivocators.find_first();
+             i != VoterBitset::npos and i < voter_set.size();
+             i = equivocators.find_next(i)) {
+          if (flags.size() <= i or not flags.test(i)) {
             result += voter_set.voterWeight(i).value();
           }
         }
@@ -69,16 +73,32 @@ namespace kagome::consensus::grandpa {
 
       void merge(const OneTypeVoteWeight &other,
                  const std::shared_ptr<VoterSet> &voter_set) {
-        for (auto i = other.flags.size(); i > 0;) {
-          --i;
-          if (other.flags[i]) {
-            set(i, voter_set->voterWeight(i).value());
+        if (flags.size() < other.flags.size()) {
+          flags.resize(other.flags.size(), false);
+        }
+        for (auto i = other.flags.find_first(); i != VoterBitset::npos;
+             i = other.flags.find_next(i)) {
+          if (not flags.test(i)) {
+            flags.set(i);
+            sum += voter_set->voterWeight(i).value();
           }
         }
       }
 
       bool operator==(const OneTypeVoteWeight &other) const {
-        return sum == other.sum and flags == other.flags;
+        if (sum != other.sum) {
+          return false;
+        }
+        if (flags.size() == other.flags.size()) {
+          return flags == other.flags;
+        }
+        // sizes differ only by trailing unset voters
+        auto &[shorter, longer] = flags.size() < other.flags.size()
+                                    ? std::tie(flags, other.flags)
+                                    : std::tie(other.flags, flags);
+        auto extended = shorter;
+        extended.resize(longer.size(), false);
+        return extended == longer;
       }
     };
 
@@ -113,7 +133,7 @@ namespace kagome::consensus::grandpa {
     }
 
     Weight total(VoteType vote_type,
-                 const std::vector<bool> &equivocators,
+                 const VoterBitset &equivocators,
                  const VoterSet &voter_set) const {
       switch (vote_type) {
         case VoteType::Prevote:
@@ -31,6 +31,13 @@ namespace kagome::consensus {
         "Time taken to verify and import blocks",
         {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10},
     };
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    metrics::HistogramTimer metric_block_header_validation_time{
+        "kagome_block_header_validation_time",
+        "Time taken to validate header of imported block",
+        {0.001, 0.002, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25},
+    };
   }  // namespace
 
   BlockExecutorImpl::BlockExecutorImpl(
@@ -104,10 +111,12 @@ namespace kagome::consensus {
       return;
     }
 
+    auto validation_timer = metric_block_header_validation_time.manual();
     if (auto r = appender_->validateHeader(block); r.has_error()) {
       callback(r.as_failure());
       return;
     }
+    validation_timer();
 
     // Calculate best block before new one will be applied
     auto previous_best_block = block_tree_->bestBlock();
@@ -0,0 +1,109 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "crypto/sr25519/sr25519_batch_verifier.hpp"
+
+#include <boost/asio/post.hpp>
+
+namespace kagome::crypto {
+  Sr25519BatchVerifier::Sr25519BatchVerifier(
+      std::shared_ptr<Sr25519Provider> crypto_provider,
+      std::shared_ptr<boost::asio::io_context> owner,
+      std::shared_ptr<PoolHandler> worker_pool_handler,
+      Config config)
+      : crypto_provider_{std::move(crypto_provider)},
+        owner_{std::move(owner)},
+        worker_pool_handler_{std::move(worker_pool_handler)},
+        config_{config},
+        timer_{*owner_} {
+    BOOST_ASSERT(crypto_provider_);
+    BOOST_ASSERT(owner_);
+    BOOST_ASSERT(worker_pool_handler_);
+    BOOST_ASSERT(config_.max_batch > 0);
+    batch_.reserve(config_.max_batch);
+  }
+
+  void Sr25519BatchVerifier::push(const Sr25519Signature &signature,
+                                  common::Buffer message,
+                                  const Sr25519PublicKey &public_key,
+                                  Callback cb) {
+    BOOST_ASSERT(owner_->get_executor().running_in_this_thread());
+    batch_.emplace_back(Entry{
+        .signature = signature,
+        .message = std::move(message),
+        .public_key = public_key,
+        .cb = std::move(cb),
+    });
+    if (batch_.size() >= config_.max_batch) {
+      flush();
+      return;
+    }
+    if (not timer_armed_) {
+      timer_armed_ = true;
+      timer_.expires_after(config_.max_delay);
+      timer_.async_wait(
+          [weak{weak_from_this()}](const boost::system::error_code &ec) {
+            if (ec) {
+              return;
+            }
+            if (auto self = weak.lock()) {
+              self->timer_armed_ = false;
+              self->flush();
+            }
+          });
+    }
+  }
+
+  void Sr25519BatchVerifier::flush() {
+    if (timer_armed_) {
+      timer_armed_ = false;
+      timer_.cancel();
+    }
+    if (batch_.empty()) {
+      return;
+    }
+    Batch batch;
+    batch.reserve(config_.max_batch);
+    std::swap(batch, batch_);
+    SL_TRACE(logger_, "Verify batch of {} signatures", batch.size());
+    worker_pool_handler_->execute(
+        [weak{weak_from_this()},
+         batch{std::make_shared<Batch>(std::move(batch))}] {
+          auto self = weak.lock();
+          if (not self) {
+            return;
+          }
+          auto valid = self->verify(*batch);
+          boost::asio::post(*self->owner_,
+                            [batch, valid{std::move(valid)}] {
+                              for (size_t i = 0; i < batch->size(); ++i) {
+                                (*batch)[i].cb(valid[i]);
+                              }
+                            });
+        });
+  }
+
+  std::vector<bool> Sr25519BatchVerifier::verify(const Batch &batch) const {
+    std::vector<Sr25519VerifyItem> items;
+    items.reserve(batch.size());
+    for (auto &entry : batch) {
+      items.emplace_back(Sr25519VerifyItem{
+          .signature = entry.signature,
+          .message = entry.message,
+          .public_key = entry.public_key,
+      });
+    }
+    auto valid = crypto_provider_->verifyBatch(items);
+    if (not valid) {
+      SL_DEBUG(logger_,
+               "Failed to verify batch of {} signatures: {}",
+               batch.size(),
+               valid.error());
+      return std::vector<bool>(batch.size(), false);
+    }
+    return std::move(valid.value());
+  }
+}  // namespace kagome::crypto
@@ -0,0 +1,77 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "common/buffer.hpp"
+#include "crypto/sr25519_provider.hpp"
+#include "log/logger.hpp"
+#include "utils/pool_handler.hpp"
+
+namespace kagome::crypto {
+  /**
+   * Micro-batching stage for sr25519 signatures.
+   * Accumulates signatures arriving on owner thread for up to `max_delay`
+   * or until `max_batch` signatures are collected, and verifies them together
+   * on worker pool. Each signature is verified once, so invalid signature
+   * doesn't cause recheck of whole batch.
+   * Callbacks are called on owner thread in order of `push`.
+   * `push` and `flush` must be called on owner thread.
+   */
+  class Sr25519BatchVerifier
+      : public std::enable_shared_from_this<Sr25519BatchVerifier> {
+   public:
+    using Callback = std::function<void(bool valid)>;
+
+    struct Config {
+      size_t max_batch = 64;
+      std::chrono::milliseconds max_delay{2};
+    };
+
+    Sr25519BatchVerifier(std::shared_ptr<Sr25519Provider> crypto_provider,
+                         std::shared_ptr<boost::asio::io_context> owner,
+                         std::shared_ptr<PoolHandler> worker_pool_handler,
+                         Config config);
+
+    /// Queues signature for verification
+    void push(const Sr25519Signature &signature,
+              common::Buffer message,
+              const Sr25519PublicKey &public_key,
+              Callback cb);
+
+    /// Sends queued signatures to verification without waiting
+    void flush();
+
+   private:
+    struct Entry {
+      Sr25519Signature signature;
+      common::Buffer message;
+      Sr25519PublicKey public_key;
+      Callback cb;
+    };
+    using Batch = std::vector<Entry>;
+
+    /// Verifies batch, returns validity of each entry
+    std::vector<bool> verify(const Batch &batch) const;
+
+    log::Logger logger_ = log::createLogger("Sr25519BatchVerifier", "crypto");
+    std::shared_ptr<Sr25519Provider> crypto_provider_;
+    std::shared_ptr<boost::asio::io_context> owner_;
+    std::shared_ptr<PoolHandler> worker_pool_handler_;
+    Config config_;
+    Batch batch_;
+    boost::asio::steady_timer timer_;
+    bool timer_armed_ = false;
+  };
+}  // namespace kagome::crypto
@@ -76,6 +76,25 @@ namespace kagome::crypto {
     }
     return outcome::success(result);
   }
+
+  outcome::result<std::vector<bool>> Sr25519ProviderImpl::verifyBatch(
+      std::span<const Sr25519VerifyItem> items) const {
+    // schnorrkel binding exposes no batch entry point,
+    // so items are verified sequentially
+    std::vector<bool> valid;
+    valid.reserve(items.size());
+    try {
+      for (auto &item : items) {
+        valid.emplace_back(sr25519_verify(item.signature.data(),
+                                          item.message.data(),
+                                          item.message.size(),
+                                          item.public_key.data()));
+      }
+    } catch (...) {
+      return Sr25519ProviderError::VERIFY_UNKNOWN_ERROR;
+    }
+    return valid;
+  }
 }  // namespace kagome::crypto
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::crypto, Sr25519ProviderError, e) {
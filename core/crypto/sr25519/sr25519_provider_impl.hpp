@@ -28,6 +28,9 @@ namespace kagome::crypto {
         const Sr25519Signature &signature,
         common::BufferView message,
         const Sr25519PublicKey &public_key) const override;
+
+    outcome::result<std::vector<bool>> verifyBatch(
+        std::span<const Sr25519VerifyItem> items) const override;
   };
 
 }  // namespace kagome::crypto
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "crypto/bip39/bip39_types.hpp"
 #include "crypto/sr25519_types.hpp"
 
@@ -21,6 +24,13 @@ namespace kagome::crypto {
                              // method of bound function
   };
 
+  /// Signature with message and public key, element of batch verification
+  struct Sr25519VerifyItem {
+    Sr25519Signature signature;
+    common::BufferView message;
+    Sr25519PublicKey public_key;
+  };
+
   class Sr25519Provider {
    public:
     using Keypair = Sr25519Keypair;
@@ -58,6 +68,13 @@ namespace kagome::crypto {
         common::BufferView message,
         const Sr25519PublicKey &public_key) const = 0;
 
+    /**
+     * Verifies all signatures of \param items, each of them once
+     * @return validity of each signature
+     */
+    virtual outcome::result<std::vector<bool>> verifyBatch(
+        std::span<const Sr25519VerifyItem> items) const = 0;
+
     virtual outcome::result<bool> verify_deprecated(
         const Sr25519Signature &signature,
         common::BufferView message,
@@ -7,9 +7,13 @@
 #include "host_api/impl/crypto_extension.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
+#include <future>
 
 #include <fmt/format.h>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/assert.hpp>
 #include <span>
 
@@ -58,6 +62,51 @@ namespace kagome::host_api {
   using secp256k1::Secp256k1VerifyError;
   using secp256k1::UncompressedPublicKey;
 
+  struct CryptoExtension::BatchChunk {
+    struct Ed25519Item {
+      crypto::Ed25519Signature signature;
+      common::Buffer message;
+      crypto::Ed25519PublicKey public_key;
+    };
+    struct Sr25519Item {
+      crypto::Sr25519Signature signature;
+      common::Buffer message;
+      crypto::Sr25519PublicKey public_key;
+    };
+
+    size_t size() const {
+      return ed25519.size() + sr25519.size();
+    }
+
+    bool verify(const crypto::Ed25519Provider &ed25519_provider,
+                const crypto::Sr25519Provider &sr25519_provider) const {
+      for (auto &item : ed25519) {
+        auto res = ed25519_provider.verify(
+            item.signature, item.message, item.public_key);
+        if (not res or not res.value()) {
+          return false;
+        }
+      }
+      // deprecated verification used by batch methods also accepts legacy
+      // signatures, each signature is verified once
+      for (auto &item : sr25519) {
+        auto res = sr25519_provider.verify_deprecated(
+            item.signature, item.message, item.public_key);
+        if (not res or not res.value()) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    std::vector<Ed25519Item> ed25519;
+    std::vector<Sr25519Item> sr25519;
+    /// set by whoever verifies chunk, worker or runtime thread in finish
+    std::atomic_flag taken;
+    std::promise<bool> promise;
+    std::future<bool> future = promise.get_future();
+  };
+
   CryptoExtension::CryptoExtension(
       std::shared_ptr<const runtime::MemoryProvider> memory_provider,
       std::shared_ptr<const crypto::Sr25519Provider> sr25519_provider,
@@ -65,7 +114,8 @@ namespace kagome::host_api {
       std::shared_ptr<const crypto::Ed25519Provider> ed25519_provider,
       std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
       std::shared_ptr<const crypto::Hasher> hasher,
-      std::optional<std::shared_ptr<crypto::KeyStore>> key_store)
+      std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
+      std::shared_ptr<boost::asio::io_context> worker_io)
       : memory_provider_(std::move(memory_provider)),
         sr25519_provider_(std::move(sr25519_provider)),
         ecdsa_provider_(std::move(ecdsa_provider)),
@@ -73,6 +123,7 @@ namespace kagome::host_api {
         secp256k1_provider_(std::move(secp256k1_provider)),
         hasher_(std::move(hasher)),
         key_store_(std::move(key_store)),
+        worker_io_(std::move(worker_io)),
         logger_{log::createLogger("CryptoExtension", "crypto_extension")} {
     BOOST_ASSERT(memory_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
@@ -162,7 +213,7 @@ namespace kagome::host_api {
     if (batch_verify_) {
       throw_with_error(logger_, "batch already started");
     }
-    batch_verify_ = kVerifySuccess;
+    batch_verify_.emplace();
   }
 
   runtime::WasmSize
@@ -170,8 +221,18 @@ namespace kagome::host_api {
     if (not batch_verify_) {
       throw_with_error(logger_, "batch not started");
     }
-    auto ok = *batch_verify_;
+    auto batch = std::move(*batch_verify_);
     batch_verify_.reset();
+    if (batch.pending) {
+      batch.chunks.emplace_back(std::move(batch.pending));
+    }
+    auto ok = kVerifySuccess;
+    for (auto &chunk : batch.chunks) {
+      if (not verifyChunk(*chunk)) {
+        ok = kVerifyFail;
+      }
+    }
+    SL_TRACE_FUNC_CALL(logger_, ok, batch.chunks.size());
     return ok;
   }
 
@@ -294,12 +355,27 @@ namespace kagome::host_api {
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
-    SL_TRACE_FUNC_CALL(
-        logger_,
-        "Deprecated API method ext_crypto_ed25519_batch_verify_version_1 being "
-        "called. Passing call to ext_crypto_ed25519_verify_version_1");
-    return batchVerify(
-        ext_crypto_ed25519_verify_version_1(sig, msg_span, pubkey_data));
+    if (not batch_verify_) {
+      SL_TRACE_FUNC_CALL(
+          logger_,
+          "Deprecated API method ext_crypto_ed25519_batch_verify_version_1 "
+          "being called outside of batch. Passing call to "
+          "ext_crypto_ed25519_verify_version_1");
+      return ext_crypto_ed25519_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    auto &memory = getMemory();
+    pendingChunk().ed25519.emplace_back(BatchChunk::Ed25519Item{
+        crypto::Ed25519Signature::fromSpan(
+            memory.loadN(sig, ed25519_constants::SIGNATURE_SIZE))
+            .value(),
+        common::Buffer{memory.loadN(msg_data, msg_len)},
+        crypto::Ed25519PublicKey::fromSpan(
+            memory.loadN(pubkey_data, ed25519_constants::PUBKEY_SIZE))
+            .value(),
+    });
+    sendPendingChunk();
+    return kVerifySuccess;
   }
 
   runtime::WasmSpan CryptoExtension::ext_crypto_sr25519_public_keys_version_1(
@@ -431,12 +507,27 @@ namespace kagome::host_api {
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
-    SL_TRACE_FUNC_CALL(
-        logger_,
-        "Deprecated API method ext_crypto_sr25519_batch_verify_version_1 being "
-        "called. Passing call to ext_crypto_sr25519_verify_version_1");
-    return batchVerify(  // NOLINT(cppcoreguidelines-narrowing-conversions)
-        ext_crypto_sr25519_verify_version_1(sig, msg_span, pubkey_data));
+    if (not batch_verify_) {
+      SL_TRACE_FUNC_CALL(
+          logger_,
+          "Deprecated API method ext_crypto_sr25519_batch_verify_version_1 "
+          "being called outside of batch. Passing call to "
+          "ext_crypto_sr25519_verify_version_1");
+      return ext_crypto_sr25519_verify_version_1(sig, msg_span, pubkey_data);
+    }
+    auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
+    auto &memory = getMemory();
+    pendingChunk().sr25519.emplace_back(BatchChunk::Sr25519Item{
+        crypto::Sr25519Signature::fromSpan(
+            memory.loadN(sig, sr25519_constants::SIGNATURE_SIZE))
+            .value(),
+        common::Buffer{memory.loadN(msg_data, msg_len)},
+        crypto::Sr25519PublicKey::fromSpan(
+            memory.loadN(pubkey_data, sr25519_constants::PUBLIC_SIZE))
+            .value(),
+    });
+    sendPendingChunk();
+    return kVerifySuccess;
   }
 
   int32_t CryptoExtension::ext_crypto_sr25519_verify_version_1(
@@ -759,11 +850,40 @@ namespace kagome::host_api {
     batch_verify_.reset();
   }
 
-  runtime::WasmSize CryptoExtension::batchVerify(runtime::WasmSize ok) {
-    if (batch_verify_) {
-      *batch_verify_ &= ok;
+  CryptoExtension::BatchChunk &CryptoExtension::pendingChunk() {
+    auto &pending = batch_verify_.value().pending;
+    if (not pending) {
+      pending = std::make_shared<BatchChunk>();
     }
-    return ok;
+    return *pending;
+  }
+
+  void CryptoExtension::sendPendingChunk() {
+    auto &batch = batch_verify_.value();
+    if (not worker_io_ or batch.pending->size() < kBatchChunkSize) {
+      return;
+    }
+    auto chunk = std::move(batch.pending);
+    batch.chunks.emplace_back(chunk);
+    boost::asio::post(*worker_io_,
+                      [chunk{std::move(chunk)},
+                       ed25519_provider{ed25519_provider_},
+                       sr25519_provider{sr25519_provider_}] {
+                        if (chunk->taken.test_and_set()) {
+                          return;
+                        }
+                        chunk->promise.set_value(chunk->verify(
+                            *ed25519_provider, *sr25519_provider));
+                      });
+  }
+
+  bool CryptoExtension::verifyChunk(BatchChunk &chunk) const {
+    // runtime may itself run on worker pool, so chunks not started by workers
+    // are verified here instead of waiting for free worker
+    if (not chunk.taken.test_and_set()) {
+      return chunk.verify(*ed25519_provider_, *sr25519_provider_);
+    }
+    return chunk.future.get();
   }
 
   runtime::WasmPointer
@@ -6,9 +6,8 @@
 
 #pragma once
 
-#include <future>
 #include <optional>
-#include <queue>
+#include <vector>
 
 #include "crypto/key_store.hpp"
 #include "log/logger.hpp"
@@ -26,6 +25,10 @@ namespace kagome::crypto {
   struct KeyType;
 }  // namespace kagome::crypto
 
+namespace boost::asio {
+  class io_context;
+}  // namespace boost::asio
+
 namespace kagome::host_api {
   /**
    * Implements extension functions related to cryptography
@@ -35,6 +38,13 @@ namespace kagome::host_api {
     static constexpr uint32_t kVerifySuccess = 1;
     static constexpr uint32_t kVerifyFail = 0;
 
+    /// Queued signatures sent to worker pool at once
+    static constexpr size_t kBatchChunkSize = 64;
+
+    /**
+     * @param worker_io runs chunks of queued batch signatures, if nullptr
+     * they are verified on runtime thread in finish of batch
+     */
     CryptoExtension(
         std::shared_ptr<const runtime::MemoryProvider> memory_provider,
         std::shared_ptr<const crypto::Sr25519Provider> sr25519_provider,
@@ -42,7 +52,8 @@ namespace kagome::host_api {
         std::shared_ptr<const crypto::Ed25519Provider> ed25519_provider,
         std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
         std::shared_ptr<const crypto::Hasher> hasher,
-        std::optional<std::shared_ptr<crypto::KeyStore>> key_store);
+        std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
+        std::shared_ptr<boost::asio::io_context> worker_io = nullptr);
 
     void reset();
 
@@ -122,10 +133,10 @@ namespace kagome::host_api {
 
     /**
      * @see HostApi::ext_crypto_ed25519_batch_verify
-     * Deprecated and left here for backward-compatibility with old runtimes and
-     * not going to be used now.
+     * Deprecated and left here for backward-compatibility with old runtimes.
      *
-     * Emulates the behavior, but isn't doing any batch verification.
+     * Inside of batch signature is queued and verified on worker pool,
+     * result is returned by finish of batch.
      */
     runtime::WasmSize ext_crypto_ed25519_batch_verify_version_1(
         runtime::WasmPointer sig,
@@ -162,10 +173,10 @@ namespace kagome::host_api {
 
     /**
      * @see HostApi::ext_crypto_sr25519_batch_verify
-     * Deprecated and left here for backward-compatibility with old runtimes and
-     * not going to be used now.
+     * Deprecated and left here for backward-compatibility with old runtimes.
      *
-     * Emulates the behavior, but isn't doing any batch verification.
+     * Inside of batch signature is queued and verified on worker pool,
+     * result is returned by finish of batch.
      */
     int32_t ext_crypto_sr25519_batch_verify_version_1(
         runtime::WasmPointer sig,
@@ -250,6 +261,15 @@ namespace kagome::host_api {
         runtime::WasmPointer key_type, runtime::WasmSpan seed) const;
 
    private:
+    /// Signatures verified together, defined in cpp
+    struct BatchChunk;
+
+    /// Signatures queued between start and finish of batch
+    struct BatchVerify {
+      std::shared_ptr<BatchChunk> pending;
+      std::vector<std::shared_ptr<BatchChunk>> chunks;
+    };
+
     runtime::Memory &getMemory() const {
       return memory_provider_->getCurrentMemory()->get();
     }
@@ -268,7 +288,12 @@ namespace kagome::host_api {
     runtime::WasmSpan ecdsaRecoverCompressed(bool allow_overflow,
                                              runtime::WasmPointer sig,
                                              runtime::WasmPointer msg);
-    runtime::WasmSize batchVerify(runtime::WasmSize ok);
+    /// Chunk to queue signature to, created on demand
+    BatchChunk &pendingChunk();
+    /// Sends pending chunk to worker pool when it is full
+    void sendPendingChunk();
+    /// Verifies chunk unless worker has started it, then waits for worker
+    bool verifyChunk(BatchChunk &chunk) const;
     crypto::KeyType loadKeyType(runtime::WasmPointer ptr) const;
 
     std::shared_ptr<const runtime::MemoryProvider> memory_provider_;
@@ -280,7 +305,8 @@ namespace kagome::host_api {
     std::shared_ptr<const crypto::Hasher> hasher_;
     // not needed in PVF workers
     std::optional<std::shared_ptr<crypto::KeyStore>> key_store_;
+    std::shared_ptr<boost::asio::io_context> worker_io_;
     log::Logger logger_;
-    std::optional<runtime::WasmSize> batch_verify_;
+    std::optional<BatchVerify> batch_verify_;
   };
 }  // namespace kagome::host_api
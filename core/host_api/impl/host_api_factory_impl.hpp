@@ -26,6 +26,10 @@ namespace kagome::offchain {
   class OffchainWorkerPool;
 }  // namespace kagome::offchain
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::host_api {
 
   class HostApiFactoryImpl final : public HostApiFactory {
@@ -44,7 +48,8 @@ namespace kagome::host_api {
         std::shared_ptr<crypto::KeyStore> key_store,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<common::WorkerThreadPool> worker_thread_pool);
 
     std::unique_ptr<HostApi> make(
         std::shared_ptr<const runtime::CoreApiFactory> core_factory,
@@ -65,6 +70,8 @@ namespace kagome::host_api {
     std::shared_ptr<offchain::OffchainPersistentStorage>
         offchain_persistent_storage_;
     std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool_;
+    /// verifies batched signatures, nullptr to verify them on runtime thread
+    std::shared_ptr<common::WorkerThreadPool> worker_thread_pool_;
   };
 
 }  // namespace kagome::host_api
@@ -7,6 +7,7 @@
 #include "host_api/impl/host_api_impl.hpp"
 
 #include "common/bytestr.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "crypto/ecdsa/ecdsa_provider_impl.hpp"
 #include "crypto/ed25519/ed25519_provider_impl.hpp"
 #include "crypto/hasher/hasher_impl.hpp"
@@ -84,7 +85,8 @@ namespace kagome::host_api {
       std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<common::WorkerThreadPool> worker_thread_pool)
       : memory_provider_([&] {
           BOOST_ASSERT(memory_provider);
           return std::move(memory_provider);
@@ -99,7 +101,9 @@ namespace kagome::host_api {
                     std::move(ed25519_provider),
                     std::move(secp256k1_provider),
                     hasher,
-                    std::move(key_store)),
+                    std::move(key_store),
+                    worker_thread_pool ? worker_thread_pool->io_context()
+                                       : nullptr),
         elliptic_curves_ext_(memory_provider_, std::move(elliptic_curves)),
         io_ext_(memory_provider_),
         memory_ext_(memory_provider_),
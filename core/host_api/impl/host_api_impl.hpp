@@ -24,6 +24,10 @@ namespace kagome::runtime {
   class CoreApiFactory;
 }  // namespace kagome::runtime
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::host_api {
 
   class OffchainExtension;
@@ -48,7 +52,8 @@ namespace kagome::host_api {
         std::optional<std::shared_ptr<crypto::KeyStore>> key_store,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<common::WorkerThreadPool> worker_thread_pool);
 
     ~HostApiImpl() override = default;
 
@@ -91,7 +91,16 @@ namespace kagome::host_api {
                "Error in ext_storage_read_version_1: {}",
                data_opt_res.error());
     }
-    return memory.storeBuffer(scale::encode(res).value());
+    // Option<u32> takes at most 5 bytes, encoded without heap allocation
+    std::array<uint8_t, 5> encoded{};
+    size_t encoded_size = 0;
+    kagome::scale::encode(
+        [&](const uint8_t *const ptr, size_t count) {
+          memcpy(encoded.data() + encoded_size, ptr, count);
+          encoded_size += count;
+        },
+        res);
+    return memory.storeBuffer(common::BufferView{encoded}.first(encoded_size));
   }
 
   outcome::result<std::optional<common::BufferOrView>> StorageExtension::get(
@@ -154,10 +163,9 @@ namespace kagome::host_api {
 
     auto &option = result.value();
 
-    return memory.storeBuffer(
-        scale::encode(common::map_optional(option, [](auto &r) {
-          return r.view();
-        })).value());
+    // value is written from storage straight into wasm memory
+    return memory.storeOptionalBytes(
+        common::map_optional(option, [](auto &r) { return r.view(); }));
   }
 
   void StorageExtension::ext_storage_clear_version_1(
@@ -225,20 +233,14 @@ namespace kagome::host_api {
                      res.error());
       return kErrorSpan;
     }
-    auto &&next_key_opt = res.value();
-    if (auto enc_res = scale::encode(next_key_opt); enc_res.has_value()) {
-      SL_TRACE_FUNC_CALL(logger_,
-                         res.value().has_value()
-                             ? res.value().value()
-                             : common::Buffer().put("no value"),
-                         key_bytes);
-      return memory.storeBuffer(enc_res.value());
-    } else {  // NOLINT(readability-else-after-return)
-      logger_->error(
-          "ext_storage_next_key result encoding resulted with error: {}",
-          enc_res.error());
-    }
-    return kErrorSpan;
+    auto &next_key_opt = res.value();
+    SL_TRACE_FUNC_CALL(logger_,
+                       next_key_opt.has_value()
+                           ? next_key_opt.value()
+                           : common::Buffer().put("no value"),
+                       key_bytes);
+    return memory.storeOptionalBytes(common::map_optional(
+        next_key_opt, [](auto &next_key) { return next_key.view(); }));
   }
 
   void StorageExtension::ext_storage_append_version_1(
@@ -249,6 +251,22 @@ namespace kagome::host_api {
     auto key_bytes = memory.loadN(key_ptr, key_size);
     auto append_bytes = memory.loadN(append_ptr, append_size);
 
+    auto batch = storage_provider_->getCurrentBatch();
+    if (auto topper =
+            std::dynamic_pointer_cast<storage::trie::TopperTrieBatchImpl>(
+                batch)) {
+      // appends in place, without copying whole value
+      SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, append_bytes);
+      auto append_result = topper->append(key_bytes, append_bytes);
+      if (not append_result) {
+        logger_->error(
+            "ext_storage_append_version_1 failed, due to fail in trie db "
+            "with reason: {}",
+            append_result.error());
+      }
+      return;
+    }
+
     auto val_opt_res = get(key_bytes);
     if (val_opt_res.has_error()) {
       throw std::runtime_error(fmt::format(
@@ -258,7 +276,6 @@ namespace kagome::host_api {
     auto &&val = val_opt ? common::Buffer{val_opt.value()} : common::Buffer{};
 
     if (scale::append_or_new_vec(val.asVector(), append_bytes).has_value()) {
-      auto batch = storage_provider_->getCurrentBatch();
       SL_TRACE_VOID_FUNC_CALL(logger_, key_bytes, val);
       auto put_result = batch->put(key_bytes, std::move(val));
       if (not put_result) {
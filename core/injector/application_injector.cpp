@@ -78,6 +78,7 @@
 #include "consensus/grandpa/impl/environment_impl.hpp"
 #include "consensus/grandpa/impl/grandpa_impl.hpp"
 #include "consensus/grandpa/impl/grandpa_thread_pool.hpp"
+#include "consensus/grandpa/impl/justification_verifier.hpp"
 #include "consensus/grandpa/impl/verified_justification_queue.hpp"
 #include "consensus/production_consensus.hpp"
 #include "consensus/timeline/impl/block_appender_base.hpp"
@@ -170,6 +171,7 @@
 #include "runtime/binaryen/module/module_factory_impl.hpp"
 #include "runtime/common/core_api_factory_impl.hpp"
 #include "runtime/common/module_repository_impl.hpp"
+#include "runtime/common/runtime_artifact_store.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
 #include "runtime/common/runtime_properties_cache_impl.hpp"
 #include "runtime/common/runtime_upgrade_tracker_impl.hpp"
@@ -511,7 +513,15 @@ namespace {
         makeBinaryenInjector(),
         makeWavmInjector(),
         di::bind<runtime::RuntimeInstancesPool>.template to<runtime::RuntimeInstancesPoolImpl>(),
-        di::bind<runtime::ModuleRepository>.template to<runtime::ModuleRepositoryImpl>(),
+        bind_by_lambda<runtime::ModuleRepository>([](const auto &injector) {
+          auto module_repository =
+              injector.template create<sptr<runtime::ModuleRepositoryImpl>>();
+          module_repository->precompileRuntimeUpgrades(
+              injector.template create<
+                  primitives::events::ChainSubscriptionEnginePtr>(),
+              injector.template create<common::WorkerThreadPool &>());
+          return module_repository;
+        }),
         di::bind<runtime::CoreApiFactory>.template to<runtime::CoreApiFactoryImpl>(),
         bind_by_lambda<runtime::ModuleFactory>(
             [method, interpreter](
@@ -7,9 +7,16 @@
 #include "metrics_watcher.hpp"
 
 #include "filesystem/common.hpp"
+#include "runtime/common/memory_allocator.hpp"
 
 namespace {
   constexpr auto storageSizeMetricName = "kagome_storage_size";
+  constexpr auto allocatorAllocationsMetricName =
+      "kagome_runtime_allocator_allocations";
+  constexpr auto allocatorMaxInUseMetricName =
+      "kagome_runtime_allocator_max_in_use";
+  constexpr auto allocatorMaxHeapMetricName =
+      "kagome_runtime_allocator_max_heap_bytes";
 }  // namespace
 
 namespace kagome::metrics {
@@ -30,9 +37,39 @@ namespace kagome::metrics {
     metric_storage_size_ =
         metrics_registry_->registerGaugeMetric(storageSizeMetricName);
 
+    if (app_config.runtimeAllocatorStats()) {
+      registerAllocatorMetrics();
+    }
+
     app_state_manager->takeControl(*this);
   }
 
+  void MetricsWatcher::registerAllocatorMetrics() {
+    runtime::MemoryAllocatorImpl::enableStats(true);
+    allocator_stats_ = true;
+    metrics_registry_->registerCounterFamily(
+        allocatorAllocationsMetricName,
+        "Number of runtime allocations by chunk size");
+    metrics_registry_->registerGaugeFamily(
+        allocatorMaxInUseMetricName,
+        "Maximal number of simultaneously allocated runtime chunks by size "
+        "during runtime call");
+    for (size_t order = 0; order < metric_allocations_.size(); ++order) {
+      std::map<std::string, std::string> labels{
+          {"size", std::to_string(size_t{8} << order)}};
+      metric_allocations_[order] = metrics_registry_->registerCounterMetric(
+          allocatorAllocationsMetricName, labels);
+      metric_max_in_use_[order] = metrics_registry_->registerGaugeMetric(
+          allocatorMaxInUseMetricName, labels);
+    }
+    metrics_registry_->registerGaugeFamily(
+        allocatorMaxHeapMetricName,
+        "Maximal runtime heap size used by bump allocation during runtime "
+        "call");
+    metric_max_heap_ =
+        metrics_registry_->registerGaugeMetric(allocatorMaxHeapMetricName);
+  }
+
   bool MetricsWatcher::start() {
     thread_ = std::thread([this] {
       soralog::util::setThreadName("metric-watcher");
@@ -41,6 +78,9 @@ namespace kagome::metrics {
         if (storage_size_res.has_value()) {
           metric_storage_size_->set(storage_size_res.value());
         }
+        if (allocator_stats_) {
+          measure_allocator_stats();
+        }
 
         // Granulated waiting
         for (auto i = 0; i < 30; ++i) {
@@ -62,6 +102,19 @@ namespace kagome::metrics {
     }
   }
 
+  void MetricsWatcher::measure_allocator_stats() {
+    auto stats = runtime::MemoryAllocatorImpl::totalStats();
+    for (size_t order = 0; order < stats.orders.size(); ++order) {
+      // total only grows, counter gets increment since previous measure
+      auto allocations = stats.orders[order].allocations;
+      metric_allocations_[order]->inc(
+          static_cast<double>(allocations - allocations_[order]));
+      allocations_[order] = allocations;
+      metric_max_in_use_[order]->set(stats.orders[order].max_in_use);
+    }
+    metric_max_heap_->set(stats.max_heap);
+  }
+
   outcome::result<uintmax_t> MetricsWatcher::measure_storage_size() {
     std::error_code ec;
 
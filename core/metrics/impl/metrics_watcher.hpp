@@ -14,6 +14,7 @@
 #include "filesystem/common.hpp"
 #include "metrics/metrics.hpp"
 #include "outcome/outcome.hpp"
+#include "runtime/common/memory_allocator.hpp"
 
 namespace kagome::metrics {
 
@@ -29,6 +30,8 @@ namespace kagome::metrics {
 
    private:
     outcome::result<uintmax_t> measure_storage_size();
+    void registerAllocatorMetrics();
+    void measure_allocator_stats();
 
     filesystem::path storage_path_;
 
@@ -38,6 +41,14 @@ namespace kagome::metrics {
     // Metrics
     metrics::RegistryPtr metrics_registry_;
     metrics::Gauge *metric_storage_size_;
+    bool allocator_stats_ = false;
+    // by allocation size order
+    std::array<metrics::Counter *, runtime::MemoryAllocatorImpl::kOrders>
+        metric_allocations_;
+    std::array<uint64_t, runtime::MemoryAllocatorImpl::kOrders> allocations_{};
+    std::array<metrics::Gauge *, runtime::MemoryAllocatorImpl::kOrders>
+        metric_max_in_use_;
+    metrics::Gauge *metric_max_heap_;
   };
 
 }  // namespace kagome::metrics
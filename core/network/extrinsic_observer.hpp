@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "common/blob.hpp"
 #include "outcome/outcome.hpp"
 
@@ -24,6 +26,10 @@ namespace kagome::network {
 
     virtual outcome::result<common::Hash256> onTxMessage(
         const primitives::Extrinsic &extrinsic) = 0;
+
+    /// Submits extrinsics of one network message, validating them in parallel
+    virtual std::vector<outcome::result<common::Hash256>> onTxMessages(
+        std::vector<primitives::Extrinsic> extrinsics) = 0;
   };
 
 }  // namespace kagome::network
@@ -23,4 +23,11 @@ namespace kagome::network {
                                   extrinsic);
   }
 
+  std::vector<outcome::result<common::Hash256>>
+  ExtrinsicObserverImpl::onTxMessages(
+      std::vector<primitives::Extrinsic> extrinsics) {
+    return pool_->submitExtrinsics(primitives::TransactionSource::External,
+                                   std::move(extrinsics));
+  }
+
 }  // namespace kagome::network
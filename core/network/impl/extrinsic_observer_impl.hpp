@@ -24,6 +24,9 @@ namespace kagome::network {
     outcome::result<common::Hash256> onTxMessage(
         const primitives::Extrinsic &extrinsic) override;
 
+    std::vector<outcome::result<common::Hash256>> onTxMessages(
+        std::vector<primitives::Extrinsic> extrinsics) override;
+
    private:
     std::shared_ptr<kagome::transaction_pool::TransactionPool> pool_;
     log::Logger logger_;
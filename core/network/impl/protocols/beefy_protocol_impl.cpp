@@ -17,6 +17,8 @@ namespace kagome::network {
   // https://github.com/paritytech/polkadot-sdk/blob/edf79aa972bcf2e043e18065a9bb860ecdbd1a6e/substrate/client/consensus/beefy/src/communication/mod.rs#L82-L83
   constexpr size_t kPeersLimit = 25;
 
+  constexpr size_t kQueueLimitBytes = 1 << 20;
+
   BeefyProtocolImpl::BeefyProtocolImpl(
       const notifications::Factory &notifications_factory,
       const blockchain::GenesisBlockHash &genesis,
@@ -25,7 +27,8 @@ namespace kagome::network {
       : notifications_{notifications_factory.make(
             {make_protocols(kBeefyProtocol, genesis)},
             kPeersLimit,
-            kPeersLimit)},
+            kPeersLimit,
+            {.name = "beefy", .bytes = kQueueLimitBytes})},
         roles_{roles},
         beefy_{std::move(beefy)} {}
 
@@ -53,11 +56,8 @@ namespace kagome::network {
 
   void BeefyProtocolImpl::broadcast(
       std::shared_ptr<consensus::beefy::BeefyGossipMessage> message) {
-    auto message_raw = notifications::encode(message);
-    notifications_->peersOut([&](const PeerId &peer_id, size_t) {
-      notifications_->write(peer_id, message_raw);
-      return true;
-    });
+    notifications_->broadcast(notifications::encodeFramed(message),
+                              [](const PeerId &, size_t) { return true; });
   }
 
   void BeefyProtocolImpl::start() {
@@ -26,6 +26,8 @@ namespace kagome::network {
   // https://github.com/paritytech/polkadot-sdk/blob/edf79aa972bcf2e043e18065a9bb860ecdbd1a6e/substrate/client/network/sync/src/engine.rs#L86
   constexpr size_t kSeenCapacity = 1024;
 
+  constexpr size_t kQueueLimitBytes = 1 << 20;
+
   static const struct {
     void inc(bool inc) const {
       for (auto &metric : metrics) {
@@ -66,7 +68,8 @@ namespace kagome::network {
         notifications_{notifications_factory.make(
             {make_protocols(kBlockAnnouncesProtocol, genesis_hash, chain_spec)},
             app_config.inPeers(),
-            app_config.outPeers())},
+            app_config.outPeers(),
+            {.name = "block_announce", .bytes = kQueueLimitBytes})},
         handshake_{.roles = roles, .genesis_hash = genesis_hash},
         block_tree_(std::move(block_tree)),
         observer_(std::move(observer)),
@@ -143,13 +146,10 @@ namespace kagome::network {
 
   void BlockAnnounceProtocol::blockAnnounce(BlockAnnounce &&announce) {
     REINVOKE(*main_pool_handler_, blockAnnounce, std::move(announce));
-    auto message_raw = notifications::encode(announce);
-    notifications_->peersOut([&](const PeerId &peer_id, size_t) {
-      if (not seen_.add(peer_id, announce.header.hash())) {
-        return true;
-      }
-      notifications_->write(peer_id, message_raw);
-      return true;
-    });
+    notifications_->broadcast(
+        notifications::encodeFramed(announce),
+        [&](const PeerId &peer_id, size_t) {
+          return seen_.add(peer_id, announce.header.hash());
+        });
   }
 }  // namespace kagome::network
@@ -20,6 +20,11 @@ namespace kagome::network {
   // https://github.com/paritytech/polkadot-sdk/blob/edf79aa972bcf2e043e18065a9bb860ecdbd1a6e/substrate/client/network-gossip/src/state_machine.rs#L40
   constexpr size_t kSeenCapacity = 8192;
 
+  // votes are latency sensitive, so they get largest budget
+  constexpr size_t kQueueLimitBytes = 8 << 20;
+
+  constexpr notifications::QueueKey kNeighborQueueKey = 0;
+
   GrandpaProtocol::GrandpaProtocol(
       const notifications::Factory &notifications_factory,
       std::shared_ptr<crypto::Hasher> hasher,
@@ -34,7 +39,8 @@ namespace kagome::network {
             {make_protocols(
                 kGrandpaProtocol, genesis_hash, kProtocolPrefixParitytech)},
             0,
-            0)},
+            0,
+            {.name = "grandpa", .bytes = kQueueLimitBytes})},
         hasher_{std::move(hasher)},
         roles_{roles},
         grandpa_observer_(std::move(grandpa_observer)),
@@ -53,7 +59,11 @@ namespace kagome::network {
                                     Buffer &&handshake) {
     TRY_FALSE(scale::decode<Roles>(handshake));
     if (out) {
-      write(peer_id, rawMessage(last_neighbor_));
+      if (not last_neighbor_raw_) {
+        last_neighbor_raw_ = rawMessage(last_neighbor_);
+        last_neighbor_raw_->key = kNeighborQueueKey;
+      }
+      write(peer_id, *last_neighbor_raw_);
     }
     return true;
   }
@@ -198,6 +208,8 @@ namespace kagome::network {
     }
     auto set_changed = msg.voter_set_id != last_neighbor_.voter_set_id;
     last_neighbor_ = msg;
+    last_neighbor_raw_ = rawMessage(msg);
+    last_neighbor_raw_->key = kNeighborQueueKey;
 
     SL_DEBUG(log_,
              "Send neighbor message: grandpa round number {}",
@@ -228,13 +240,10 @@ namespace kagome::network {
       return true;
     };
 
-    auto raw_message = rawMessage(msg);
-    notifications_->peersOut([&](const PeerId &peer_id, size_t) {
-      if (filter(peer_id)) {
-        write(peer_id, raw_message);
-      }
-      return true;
-    });
+    notifications_->broadcast(
+        last_neighbor_raw_->raw,
+        [&](const PeerId &peer_id, size_t) { return filter(peer_id); },
+        last_neighbor_raw_->key);
   }
 
   void GrandpaProtocol::finalize(
@@ -469,9 +478,9 @@ namespace kagome::network {
 
   GrandpaProtocol::RawMessage GrandpaProtocol::rawMessage(
       const GrandpaMessage &message) const {
-    auto message_raw = notifications::encode(message);
-    auto hash = rawMessageHash(message, *message_raw);
-    return {.raw = std::move(message_raw), .hash = hash};
+    auto message_raw = scale::encode(message).value();
+    auto hash = rawMessageHash(message, message_raw);
+    return {.raw = notifications::frame(message_raw), .hash = hash};
   }
 
   bool GrandpaProtocol::write(const PeerId &peer_id, RawMessage raw_message) {
@@ -483,7 +492,8 @@ namespace kagome::network {
         return false;
       }
     }
-    notifications_->write(peer_id, std::move(raw_message.raw));
+    notifications_->writeFramed(
+        peer_id, std::move(raw_message.raw), raw_message.key);
     return true;
   }
 
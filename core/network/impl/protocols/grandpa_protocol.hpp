@@ -77,8 +77,10 @@ namespace kagome::network {
     static constexpr auto kGrandpaProtocolName = "GrandpaProtocol";
 
     struct RawMessage {
-      std::shared_ptr<Buffer> raw;
+      notifications::FramedMessage raw;
       std::optional<Hash256> hash;
+      /// replaces queued message with same key
+      std::optional<notifications::QueueKey> key;
     };
     std::optional<Hash256> rawMessageHash(const GrandpaMessage &message,
                                           BufferView message_raw) const;
@@ -108,6 +110,8 @@ namespace kagome::network {
         recent_catchup_requests_by_round_;
 
     GrandpaNeighborMessage last_neighbor_{};
+    /// `last_neighbor_` encoded once for all peers
+    std::optional<RawMessage> last_neighbor_raw_;
 
     std::set<libp2p::peer::PeerId> recent_catchup_requests_by_peer_;
 
@@ -31,6 +31,13 @@ namespace kagome::network {
   // https://github.com/paritytech/polkadot-sdk/blob/edf79aa972bcf2e043e18065a9bb860ecdbd1a6e/polkadot/node/network/protocol/src/peer_set.rs#L98-L99
   constexpr size_t kValidationPeersLimit = kMinGossipPeers / 2 - 1;
 
+  constexpr size_t kCollationQueueLimitBytes = 1 << 20;
+
+  // statements and approvals are gossiped in bursts
+  constexpr size_t kValidationQueueLimitBytes = 16 << 20;
+
+  constexpr notifications::QueueKey kViewQueueKey = 0;
+
   inline auto makeProtocols(const ParachainProtocolInject &inject,
                             const std::string_view &fmt) {
     return make_protocols(fmt, *inject.genesis_hash, kProtocolPrefixPolkadot);
@@ -43,14 +50,14 @@ namespace kagome::network {
 
   template <typename M>
   auto encodeMessage(const auto &message) {
-    return notifications::encode(WireMessage<M>{message});
+    return notifications::encodeFramed(WireMessage<M>{message});
   }
 
   inline auto encodeView(const View &view) {
     return encodeMessage<CollationMessage0>(ViewUpdate{view});
   }
 
-  std::pair<size_t, std::shared_ptr<Buffer>> encodeMessage(
+  std::pair<size_t, notifications::FramedMessage> encodeMessage(
       const VersionedValidatorProtocolMessage &message) {
     size_t protocol_group =
         boost::get<vstaging::ValidatorProtocolMessage>(&message) ? 0 : 1;
@@ -64,9 +71,13 @@ namespace kagome::network {
       ParachainProtocolInject &&inject,
       notifications::ProtocolsGroups protocols_groups,
       size_t limit_in,
-      size_t limit_out)
+      size_t limit_out,
+      notifications::QueueLimit queue_limit)
       : notifications_{inject.notifications_factory->make(
-            std::move(protocols_groups), limit_in, limit_out)},
+            std::move(protocols_groups),
+            limit_in,
+            limit_out,
+            std::move(queue_limit))},
         collation_versions_{CollationVersion::VStaging, CollationVersion::V1},
         roles_{inject.roles},
         peer_manager_{inject.peer_manager},
@@ -86,8 +97,10 @@ namespace kagome::network {
     state.value().get().collation_version =
         collation_versions_.at(protocol_group);
     if (out) {
-      notifications_->write(
-          peer_id, protocol_group, encodeView(peer_view_->getMyViewStripped()));
+      notifications_->writeFramed(peer_id,
+                                  protocol_group,
+                                  encodeView(peer_view_->getMyViewStripped()),
+                                  kViewQueueKey);
     }
     return true;
   }
@@ -117,10 +130,13 @@ namespace kagome::network {
 
   void ParachainProtocol::write(const View &view) {
     auto message = encodeView(view);
-    notifications_->peersOut([&](const PeerId &peer_id, size_t protocol_group) {
-      notifications_->write(peer_id, protocol_group, message);
-      return true;
-    });
+    for (size_t i = 0; i < collation_versions_.size(); ++i) {
+      notifications_->broadcast(
+          i,
+          message,
+          [](const PeerId &, size_t) { return true; },
+          kViewQueueKey);
+    }
   }
 
   template <typename Types, typename Observer>
@@ -150,6 +166,7 @@ namespace kagome::network {
           },
           kCollationPeersLimit,
           0,
+          {.name = "collation", .bytes = kCollationQueueLimitBytes},
       },
       observer_{std::move(observer)} {}
 
@@ -167,7 +184,7 @@ namespace kagome::network {
       return;
     }
     CollationTypes::with(*protocol_group, [&]<typename M>() {
-      notifications_->write(
+      notifications_->writeFramed(
           peer_id, *protocol_group, encodeMessage<M>(seconded));
     });
   }
@@ -183,6 +200,7 @@ namespace kagome::network {
           },
           kValidationPeersLimit,
           kValidationPeersLimit,
+          {.name = "validation", .bytes = kValidationQueueLimitBytes},
       },
       observer_{std::move(observer)} {}
 
@@ -195,22 +213,19 @@ namespace kagome::network {
 
   void ValidationProtocol::write(
       const PeerId &peer_id,
-      std::pair<size_t, std::shared_ptr<Buffer>> message) {
-    notifications_->write(peer_id, message.first, std::move(message.second));
+      std::pair<size_t, notifications::FramedMessage> message) {
+    notifications_->writeFramed(
+        peer_id, message.first, std::move(message.second));
   }
 
   void ValidationProtocol::write(const BitfieldDistribution &message) {
-    std::vector<std::shared_ptr<Buffer>> messages;
     for (size_t i = 0; i < collation_versions_.size(); ++i) {
       ValidationTypes::with(i, [&]<typename M>() {
-        messages.emplace_back(encodeMessage<M>(message));
+        notifications_->broadcast(i,
+                                  encodeMessage<M>(message),
+                                  [](const PeerId &, size_t) { return true; });
       });
     }
-    notifications_->peersOut([&](const PeerId &peer_id, size_t protocol_group) {
-      notifications_->write(
-          peer_id, protocol_group, messages.at(protocol_group));
-      return true;
-    });
   }
 
   void ValidationProtocol::reserve(const PeerId &peer_id, bool add) {
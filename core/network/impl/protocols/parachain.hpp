@@ -29,7 +29,7 @@ namespace kagome::network {
 namespace kagome::network {
   using libp2p::PeerId;
 
-  std::pair<size_t, std::shared_ptr<Buffer>> encodeMessage(
+  std::pair<size_t, notifications::FramedMessage> encodeMessage(
       const VersionedValidatorProtocolMessage &message);
 
   struct ParachainProtocolInject {
@@ -47,7 +47,8 @@ namespace kagome::network {
     ParachainProtocol(ParachainProtocolInject &&inject,
                       notifications::ProtocolsGroups protocols_groups,
                       size_t limit_in,
-                      size_t limit_out);
+                      size_t limit_out,
+                      notifications::QueueLimit queue_limit);
 
     // Controller
     Buffer handshake() override;
@@ -114,7 +115,7 @@ namespace kagome::network {
                    Buffer &&message) override;
 
     void write(const PeerId &peer_id,
-               std::pair<size_t, std::shared_ptr<Buffer>> message);
+               std::pair<size_t, notifications::FramedMessage> message);
     void write(const PeerId &peer_id,
                const VersionedValidatorProtocolMessage &message) {
       write(peer_id, encodeMessage(message));
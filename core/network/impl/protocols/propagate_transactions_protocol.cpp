@@ -25,6 +25,9 @@ namespace kagome::network {
   // https://github.com/paritytech/polkadot-sdk/blob/edf79aa972bcf2e043e18065a9bb860ecdbd1a6e/substrate/client/network/transactions/src/config.rs#L33
   constexpr size_t kSeenCapacity = 10240;
 
+  // transactions are resent by other peers, so they are dropped first
+  constexpr size_t kQueueLimitBytes = 512 << 10;
+
   PropagateTransactionsProtocol::PropagateTransactionsProtocol(
       const notifications::Factory &notifications_factory,
       Roles roles,
@@ -44,7 +47,8 @@ namespace kagome::network {
             {make_protocols(
                 kPropagateTransactionsProtocol, genesis_hash, chain_spec)},
             0,
-            0)},
+            0,
+            {.name = "transactions", .bytes = kQueueLimitBytes})},
         roles_{roles},
         hasher_{std::move(hasher)},
         main_pool_handler_{main_thread_pool.handlerStarted()},
@@ -89,12 +93,17 @@ namespace kagome::network {
                peer_id);
 
     if (timeline_->wasSynchronized()) {
+      std::vector<primitives::Extrinsic> unseen;
       for (auto &ext : message.extrinsics) {
         auto hash = hasher_->blake2b_256(ext.data);
         if (not seen_.add(peer_id, hash)) {
           continue;
         }
-        auto result = extrinsic_observer_->onTxMessage(ext);
+        unseen.emplace_back(std::move(ext));
+      }
+      // whole message is validated as one batch
+      auto results = extrinsic_observer_->onTxMessages(std::move(unseen));
+      for (auto &result : results) {
         if (result) {
           SL_DEBUG(log_, "  Received tx {}", result.value());
         } else {
@@ -123,16 +132,16 @@ namespace kagome::network {
     SL_DEBUG(log_, "Propagate transaction");
     std::vector<PeerId> peers;
     size_t metric = 0;
-    auto message_raw = notifications::encode(PropagatedExtrinsics{{tx.ext}});
-    notifications_->peersOut([&](const PeerId &peer_id, size_t) {
-      if (not seen_.add(peer_id, tx.hash)) {
-        return true;
-      }
-      notifications_->write(peer_id, message_raw);
-      ++metric;
-      peers.emplace_back(peer_id);
-      return true;
-    });
+    notifications_->broadcast(
+        notifications::encodeFramed(PropagatedExtrinsics{{tx.ext}}),
+        [&](const PeerId &peer_id, size_t) {
+          if (not seen_.add(peer_id, tx.hash)) {
+            return false;
+          }
+          ++metric;
+          peers.emplace_back(peer_id);
+          return true;
+        });
     // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
     metric_propagated_tx_counter_->inc(metric);
     if (auto key = ext_event_key_repo_->get(tx.hash); key.has_value()) {
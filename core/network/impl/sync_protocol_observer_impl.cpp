@@ -30,13 +30,16 @@ namespace kagome::network {
   SyncProtocolObserverImpl::SyncProtocolObserverImpl(
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers,
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
       std::shared_ptr<Beefy> beefy)
       : block_tree_{std::move(block_tree)},
         blocks_headers_{std::move(blocks_headers)},
+        block_storage_{std::move(block_storage)},
         beefy_{std::move(beefy)},
         log_(log::createLogger("SyncProtocolObserver", "network")) {
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(blocks_headers_);
+    BOOST_ASSERT(block_storage_);
   }
 
   outcome::result<network::BlocksResponse>
@@ -158,32 +161,48 @@ namespace kagome::network {
     auto justification_needed =
         has(request.fields, network::BlockAttribute::JUSTIFICATION);
 
-    for (const auto &hash : hash_chain) {
+    // Read whole chain at once, parts are decoded only to be checked
+    auto blocks_res = block_storage_->getEncodedBlocks(
+        hash_chain, header_needed, body_needed, justification_needed);
+    if (not blocks_res) {
+      SL_WARN(log_, "cannot read requested blocks: {}", blocks_res.error());
+      return;
+    }
+
+    for (const auto &block : blocks_res.value()) {
+      const auto &hash = block.hash;
       auto &new_block =
           response.blocks.emplace_back(primitives::BlockData{.hash = hash});
 
       if (header_needed) {
-        auto header_res = blocks_headers_->getBlockHeader(hash);
-        if (header_res) {
-          new_block.header = std::move(header_res.value());
-        } else {
+        if (block.header) {
+          if (auto r = scale::decode<primitives::BlockHeader>(*block.header)) {
+            new_block.header = std::move(r.value());
+            new_block.header->hash_opt.emplace(hash);
+          }
+        }
+        if (not new_block.header) {
           response.blocks.pop_back();
           break;
         }
       }
       if (body_needed) {
-        auto body_res = block_tree_->getBlockBody(hash);
-        if (body_res) {
-          new_block.body = std::move(body_res.value());
-        } else {
+        if (block.body) {
+          if (auto r = scale::decode<primitives::BlockBody>(*block.body)) {
+            new_block.body = std::move(r.value());
+          }
+        }
+        if (not new_block.body) {
           response.blocks.pop_back();
           break;
         }
       }
       if (justification_needed) {
-        auto justification_res = block_tree_->getBlockJustification(hash);
-        if (justification_res) {
-          new_block.justification = std::move(justification_res.value());
+        if (block.justification) {
+          if (auto r = scale::decode<primitives::Justification>(
+                  *block.justification)) {
+            new_block.justification = std::move(r.value());
+          }
         }
         if (request.multiple_justifications) {
           std::optional<primitives::BlockNumber> number;
@@ -15,10 +15,13 @@
 #include "blockchain/block_tree.hpp"
 #include "blockchain/block_tree_error.hpp"
 #include "common/main_thread_pool.hpp"
+#include "common/worker_thread_pool.hpp"
+#include "consensus/babe/babe_block_validator.hpp"
 #include "consensus/beefy/beefy.hpp"
 #include "consensus/grandpa/environment.hpp"
 #include "consensus/grandpa/has_authority_set_change.hpp"
 #include "consensus/timeline/timeline.hpp"
+#include "metrics/histogram_timer.hpp"
 #include "network/peer_manager.hpp"
 #include "network/protocols/state_protocol.hpp"
 #include "network/protocols/sync_protocol.hpp"
@@ -69,6 +72,20 @@ namespace {
 
   constexpr auto kRandomWarpInterval = std::chrono::minutes{1};
 
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  kagome::metrics::HistogramTimer metric_block_queue_time{
+      "kagome_sync_block_queue_time",
+      "Time downloaded block waits in queue before its import",
+      {0.01, 0.05, 0.1, 0.5, 1, 5, 10, 30, 60},
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  kagome::metrics::HistogramTimer metric_block_precheck_time{
+      "kagome_sync_block_precheck_time",
+      "Time taken to check seal and VRF of block ahead of its import",
+      {0.001, 0.002, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25},
+  };
+
   kagome::network::BlockAttribute attributesForSync(
       kagome::application::SyncMethod method) {
     using SM = kagome::application::SyncMethod;
@@ -107,7 +124,9 @@ namespace kagome::network {
       std::shared_ptr<Beefy> beefy,
       std::shared_ptr<consensus::grandpa::Environment> grandpa_environment,
       common::MainThreadPool &main_thread_pool,
-      std::shared_ptr<blockchain::BlockStorage> block_storage)
+      common::WorkerThreadPool &worker_thread_pool,
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
+      std::shared_ptr<consensus::babe::BabeBlockValidator> babe_block_validator)
       : log_(log::createLogger("Synchronizer", "synchronizer")),
         block_tree_(std::move(block_tree)),
         block_appender_(std::move(block_appender)),
@@ -125,7 +144,10 @@ namespace kagome::network {
         chain_sub_engine_(std::move(chain_sub_engine)),
         main_pool_handler_{
             poolHandlerReadyMake(app_state_manager, main_thread_pool)},
+        worker_pool_handler_{
+            poolHandlerReadyMake(app_state_manager, worker_thread_pool)},
         block_storage_{std::move(block_storage)},
+        babe_block_validator_{std::move(babe_block_validator)},
         max_parallel_downloads_{app_config.maxParallelDownloads()},
         random_gen_{std::random_device{}()} {
     BOOST_ASSERT(block_tree_);
@@ -140,6 +162,7 @@ namespace kagome::network {
     BOOST_ASSERT(chain_sub_engine_);
     BOOST_ASSERT(main_pool_handler_);
     BOOST_ASSERT(block_storage_);
+    BOOST_ASSERT(babe_block_validator_);
 
     sync_method_ = app_config.syncMethod();
 
@@ -1008,6 +1031,7 @@ namespace kagome::network {
       }
       pop();
       any_block_applied = true;
+      metric_block_queue_time.observe(it->second.enqueued);
 
       const auto &last_finalized_block = block_tree_->getLastFinalized();
 
@@ -1075,6 +1099,9 @@ namespace kagome::network {
             return;
           }
         }
+        if (parent) {
+          precheckNextBlocks(block_info.hash, parent->hash);
+        }
         return;
       }
       ancestry_.erase(block_info.hash);
@@ -1084,6 +1111,68 @@ namespace kagome::network {
     }
   }
 
+  void SynchronizerImpl::precheckNextBlocks(
+      const primitives::BlockHash &importing,
+      const primitives::BlockHash &parent) {
+    // enqueued block -> its ancestor from block tree
+    std::unordered_map<primitives::BlockHash, primitives::BlockHash>
+        imported_ancestors{{importing, parent}};
+    std::unordered_map<primitives::BlockHash, primitives::BlockHeader>
+        ancestor_headers;
+    size_t ahead = 0;
+    for (const auto &block_info : generations_) {
+      if (ahead++ >= kMaxBlocksPrecheckedAhead
+          or prechecks_in_progress_ >= kMaxBlocksPrecheckedAhead) {
+        break;
+      }
+      auto it = known_blocks_.find(block_info.hash);
+      if (it == known_blocks_.end()) {
+        continue;
+      }
+      BOOST_ASSERT(it->second.data.header.has_value());
+      const auto &header = *it->second.data.header;
+
+      // generations are ordered by number, so parents are visited first
+      primitives::BlockHash ancestor;
+      if (auto a = imported_ancestors.find(header.parent_hash);
+          a != imported_ancestors.end()) {
+        ancestor = a->second;
+      } else if (block_tree_->has(header.parent_hash)) {
+        ancestor = header.parent_hash;
+      } else {
+        continue;
+      }
+      imported_ancestors.emplace(block_info.hash, ancestor);
+
+      if (it->second.prechecked) {
+        continue;
+      }
+
+      auto h = ancestor_headers.find(ancestor);
+      if (h == ancestor_headers.end()) {
+        auto ancestor_header = block_tree_->getBlockHeader(ancestor);
+        if (not ancestor_header) {
+          continue;
+        }
+        h = ancestor_headers.emplace(ancestor, ancestor_header.value()).first;
+      }
+      auto precheck = babe_block_validator_->precheckHeader(header, h->second);
+      if (not precheck) {
+        continue;
+      }
+      it->second.prechecked = true;
+      ++prechecks_in_progress_;
+      worker_pool_handler_->execute(
+          [WEAK_SELF, precheck{std::move(*precheck)}] {
+            auto timer = metric_block_precheck_time.manual();
+            precheck();
+            timer();
+            WEAK_LOCK(self);
+            --self->prechecks_in_progress_;
+          });
+    }
+  }
+
   void SynchronizerImpl::processBlockAdditionResult(
       outcome::result<void> block_addition_result,
       const primitives::BlockHash &hash,
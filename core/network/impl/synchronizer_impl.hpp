@@ -46,7 +46,8 @@ namespace kagome::blockchain {
 
 namespace kagome::common {
   class MainThreadPool;
-}
+  class WorkerThreadPool;
+}  // namespace kagome::common
 
 namespace kagome::consensus {
   class BlockHeaderAppender;
@@ -54,6 +55,10 @@ namespace kagome::consensus {
   class Timeline;
 }  // namespace kagome::consensus
 
+namespace kagome::consensus::babe {
+  class BabeBlockValidator;
+}  // namespace kagome::consensus::babe
+
 namespace kagome::consensus::grandpa {
   class Environment;
 }  // namespace kagome::consensus::grandpa
@@ -96,6 +101,10 @@ namespace kagome::network {
     static constexpr std::chrono::milliseconds kRecentnessDuration =
         std::chrono::seconds(60);
 
+    /// Max number of enqueued blocks, which headers are checked ahead of
+    /// import at once
+    static constexpr size_t kMaxBlocksPrecheckedAhead = 32;
+
     enum class Error {
       SHUTTING_DOWN = 1,
       EMPTY_RESPONSE,
@@ -128,7 +137,10 @@ namespace kagome::network {
         std::shared_ptr<Beefy> beefy,
         std::shared_ptr<consensus::grandpa::Environment> grandpa_environment,
         common::MainThreadPool &main_thread_pool,
-        std::shared_ptr<blockchain::BlockStorage> block_storage);
+        common::WorkerThreadPool &worker_thread_pool,
+        std::shared_ptr<blockchain::BlockStorage> block_storage,
+        std::shared_ptr<consensus::babe::BabeBlockValidator>
+            babe_block_validator);
 
     /** @see AppStateManager::takeControl */
     bool start();
@@ -217,6 +229,13 @@ namespace kagome::network {
     /// Pops next block from queue and tries to apply that
     void applyNextBlock();
 
+    /// Starts checking seal and VRF of next enqueued blocks on worker pool,
+    /// while block {@param importing} with imported {@param parent} is
+    /// imported. Blocks not in epoch of imported ancestor are checked in order
+    /// of import only.
+    void precheckNextBlocks(const primitives::BlockHash &importing,
+                            const primitives::BlockHash &parent);
+
     /// Removes block {@param block} and all all dependent on it from the queue
     /// @returns number of affected blocks
     size_t discardBlock(const primitives::BlockHash &block);
@@ -264,7 +283,9 @@ namespace kagome::network {
     std::shared_ptr<consensus::grandpa::Environment> grandpa_environment_;
     primitives::events::ChainSubscriptionEnginePtr chain_sub_engine_;
     std::shared_ptr<PoolHandlerReady> main_pool_handler_;
+    std::shared_ptr<PoolHandlerReady> worker_pool_handler_;
     std::shared_ptr<blockchain::BlockStorage> block_storage_;
+    std::shared_ptr<consensus::babe::BabeBlockValidator> babe_block_validator_;
     uint32_t max_parallel_downloads_;
     std::mt19937 random_gen_;
 
@@ -292,6 +313,11 @@ namespace kagome::network {
       primitives::BlockData data;
       /// Peers who know this block
       std::set<libp2p::peer::PeerId> peers;
+      /// When block was enqueued
+      std::chrono::steady_clock::time_point enqueued =
+          std::chrono::steady_clock::now();
+      /// Header is checked ahead of import
+      bool prechecked = false;
     };
 
     // Already known (enqueued) but is not applied yet
@@ -313,6 +339,9 @@ namespace kagome::network {
 
     std::multimap<primitives::BlockInfo, SyncResultHandler> subscriptions_;
 
+    // Number of header checks running on worker pool
+    std::atomic_size_t prechecks_in_progress_ = 0;
+
     std::atomic_bool asking_blocks_portion_in_progress_ = false;
     std::set<libp2p::peer::PeerId> busy_peers_;
     std::unordered_map<primitives::BlockInfo, uint32_t> load_blocks_;
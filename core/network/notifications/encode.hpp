@@ -13,7 +13,22 @@
 #include "common/buffer.hpp"
 
 namespace kagome::network::notifications {
+  /**
+   * Message prefixed with its varint length, ready to be written to stream.
+   * Immutable, so single instance is shared by queues of many peers.
+   */
+  using FramedMessage = std::shared_ptr<const Buffer>;
+
+  /**
+   * Prefix message with its varint length.
+   */
+  FramedMessage frame(BufferView message);
+
   std::shared_ptr<Buffer> encode(const auto &message) {
     return std::make_shared<Buffer>(scale::encode(message).value());
   }
+
+  FramedMessage encodeFramed(const auto &message) {
+    return frame(scale::encode(message).value());
+  }
 }  // namespace kagome::network::notifications
@@ -4,11 +4,16 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <ranges>
+
 #include <libp2p/basic/message_read_writer_uvarint.hpp>
 #include <libp2p/basic/scheduler.hpp>
+#include <libp2p/basic/write_return_size.hpp>
 #include <libp2p/host/host.hpp>
+#include <libp2p/multi/uvarint.hpp>
 
 #include "common/main_thread_pool.hpp"
+#include "metrics/histogram_timer.hpp"
 #include "network/helpers/new_stream.hpp"
 #include "network/notifications/handshake.hpp"
 #include "network/notifications/protocol.hpp"
@@ -20,6 +25,50 @@ namespace kagome::network::notifications {
   constexpr auto kBackoffMin = std::chrono::seconds{5};
   constexpr auto kBackoffMax = std::chrono::seconds{10};
 
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  metrics::CounterHelper metric_bytes_framed{
+      "kagome_notifications_bytes_encoded",
+      "Number of bytes of notification messages encoded and framed",
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  metrics::CounterHelper metric_bytes_sent{
+      "kagome_notifications_bytes_sent",
+      "Number of bytes of notification messages written to peers",
+  };
+
+  constexpr auto kQueueBytes = "kagome_notifications_queue_bytes";
+  constexpr auto kQueueMessages = "kagome_notifications_queue_messages";
+  constexpr auto kDropped = "kagome_notifications_dropped";
+  constexpr auto kReplaced = "kagome_notifications_replaced";
+
+  /// Families of per protocol queue metrics, registered once
+  metrics::Registry &queueMetrics() {
+    static auto registry = [] {
+      auto registry = metrics::createRegistry();
+      registry->registerGaugeFamily(
+          kQueueBytes, "Bytes of messages queued for peers by protocol");
+      registry->registerGaugeFamily(
+          kQueueMessages, "Number of messages queued for peers by protocol");
+      registry->registerCounterFamily(
+          kDropped, "Number of queued messages dropped over byte budget");
+      registry->registerCounterFamily(
+          kReplaced, "Number of queued messages replaced by newer ones");
+      return registry;
+    }();
+    return *registry;
+  }
+
+  FramedMessage frame(BufferView message) {
+    libp2p::multi::UVarint length{message.size()};
+    auto framed = std::make_shared<Buffer>();
+    framed->reserve(length.size() + message.size());
+    framed->put(length.toVector());
+    framed->put(message);
+    metric_bytes_framed->inc(framed->size());
+    return framed;
+  }
+
   // TODO(turuslan): #2359, remove when `YamuxStream::readSome` returns error
   inline bool isClosed(const StreamInfoClose &stream) {
     return stream.stream->isClosed();
@@ -48,21 +97,32 @@ namespace kagome::network::notifications {
   }
 
   PeerOutOpen::PeerOutOpen(StreamInfoClose &&stream)
-      : stream{std::move(stream)}, writing{false} {}
+      : stream{std::move(stream)}, writing{false}, queue_bytes{0} {}
 
   Protocol::Protocol(MainThreadPool &main_thread_pool,
                      std::shared_ptr<Host> host,
                      std::shared_ptr<Scheduler> scheduler,
                      ProtocolsGroups protocols_groups,
                      size_t limit_in,
-                     size_t limit_out)
+                     size_t limit_out,
+                     QueueLimit queue_limit)
       : main_pool_handler_{main_thread_pool.handlerStarted()},
         host_{std::move(host)},
         own_peer_id_{host_->getId()},
         scheduler_{std::move(scheduler)},
         protocols_groups_{std::move(protocols_groups)},
         limit_in_{limit_in},
-        limit_out_{limit_out} {
+        limit_out_{limit_out},
+        queue_limit_{std::move(queue_limit)} {
+    std::map<std::string, std::string> labels{
+        {"protocol", queue_limit_.name},
+    };
+    auto &registry = queueMetrics();
+    metric_queue_bytes_ = registry.registerGaugeMetric(kQueueBytes, labels);
+    metric_queue_messages_ =
+        registry.registerGaugeMetric(kQueueMessages, labels);
+    metric_dropped_ = registry.registerCounterMetric(kDropped, labels);
+    metric_replaced_ = registry.registerCounterMetric(kReplaced, labels);
     for (auto &protocols : protocols_groups_) {
       protocols_.insert(protocols_.end(), protocols.begin(), protocols.end());
     }
@@ -106,11 +166,26 @@ namespace kagome::network::notifications {
   void Protocol::write(const PeerId &peer_id,
                        size_t protocol_group,
                        std::shared_ptr<Buffer> message) {
+    writeFramed(peer_id, protocol_group, frame(*message));
+  }
+
+  void Protocol::write(const PeerId &peer_id, std::shared_ptr<Buffer> message) {
+    if (protocols_groups_.size() != 1) {
+      throw std::logic_error{"write on ambigous protocol"};
+    }
+    write(peer_id, 0, std::move(message));
+  }
+
+  void Protocol::writeFramed(const PeerId &peer_id,
+                             size_t protocol_group,
+                             FramedMessage message,
+                             std::optional<QueueKey> key) {
     REINVOKE(*main_pool_handler_,
-             write,
+             writeFramed,
              peer_id,
              protocol_group,
-             std::move(message));
+             std::move(message),
+             key);
     auto peer = entry(peers_out_, peer_id);
     if (not peer) {
       return;
@@ -122,15 +197,49 @@ namespace kagome::network::notifications {
     if (open->stream.protocol_group != protocol_group) {
       return;
     }
-    open->queue.emplace_back(std::move(message));
+    enqueue(*open, std::move(message), key);
     write(peer_id, false);
   }
 
-  void Protocol::write(const PeerId &peer_id, std::shared_ptr<Buffer> message) {
+  void Protocol::writeFramed(const PeerId &peer_id,
+                             FramedMessage message,
+                             std::optional<QueueKey> key) {
     if (protocols_groups_.size() != 1) {
       throw std::logic_error{"write on ambigous protocol"};
     }
-    write(peer_id, 0, std::move(message));
+    writeFramed(peer_id, 0, std::move(message), key);
+  }
+
+  void Protocol::broadcast(size_t protocol_group,
+                           FramedMessage message,
+                           const PeerFilter &filter,
+                           std::optional<QueueKey> key) {
+    EXPECT_THREAD(*main_pool_handler_);
+    std::vector<PeerId> peers;
+    for (auto &[peer_id, peer] : peers_out_) {
+      auto *open = std::get_if<PeerOutOpen>(&peer);
+      if (not open or open->stream.protocol_group != protocol_group) {
+        continue;
+      }
+      if (not filter(peer_id, protocol_group)) {
+        continue;
+      }
+      enqueue(*open, message, key);
+      peers.emplace_back(peer_id);
+    }
+    // `write` may call `onError`, which changes `peers_out_`
+    for (auto &peer_id : peers) {
+      write(peer_id, false);
+    }
+  }
+
+  void Protocol::broadcast(FramedMessage message,
+                           const PeerFilter &filter,
+                           std::optional<QueueKey> key) {
+    if (protocols_groups_.size() != 1) {
+      throw std::logic_error{"broadcast on ambigous protocol"};
+    }
+    broadcast(0, std::move(message), filter, key);
   }
 
   void Protocol::reserve(const PeerId &peer_id, bool add) {
@@ -311,6 +420,29 @@ namespace kagome::network::notifications {
     }
   }
 
+  void Protocol::enqueue(PeerOutOpen &open,
+                         FramedMessage message,
+                         std::optional<QueueKey> key) {
+    if (key) {
+      auto it = std::ranges::find(open.queue, key, &PeerOutOpen::Queued::key);
+      if (it != open.queue.end()) {
+        open.queue_bytes -= it->message->size();
+        open.queue_bytes += message->size();
+        it->message = std::move(message);
+        metric_replaced_->inc();
+        return;
+      }
+    }
+    open.queue_bytes += message->size();
+    open.queue.emplace_back(PeerOutOpen::Queued{std::move(message), key});
+    // drop oldest messages, but keep newest even if it alone exceeds budget
+    while (open.queue_bytes > queue_limit_.bytes and open.queue.size() > 1) {
+      open.queue_bytes -= open.queue.front().message->size();
+      open.queue.pop_front();
+      metric_dropped_->inc();
+    }
+  }
+
   void Protocol::write(const PeerId &peer_id, bool writer) {
     auto peer = entry(peers_out_, peer_id);
     if (not peer) {
@@ -330,18 +462,21 @@ namespace kagome::network::notifications {
       return;
     }
     open->writing = true;
-    auto message = std::move(open->queue.front());
+    auto message = std::move(open->queue.front().message);
     open->queue.pop_front();
-    auto cb = [WEAK_SELF, peer_id](outcome::result<size_t> r) {
+    open->queue_bytes -= message->size();
+    // keep shared message alive until written
+    auto cb = [WEAK_SELF, peer_id, message](outcome::result<size_t> r) {
       WEAK_LOCK(self);
       if (not r) {
         self->onError(peer_id, true);
         return;
       }
+      metric_bytes_sent->inc(message->size());
       self->write(peer_id, true);
     };
-    // MessageReadWriterUvarint copies message
-    open->stream.framing->write(*message, std::move(cb));
+    // message is already framed, so it is written without copying
+    libp2p::writeReturnSize(open->stream.stream, *message, std::move(cb));
   }
 
   void Protocol::read(const PeerId &peer_id) {
@@ -398,6 +533,7 @@ namespace kagome::network::notifications {
     if (controller_.expired()) {
       return;
     }
+    updateQueueMetrics();
     for (auto it = peers_in_.begin(); it != peers_in_.end();) {
       auto &[peer_id, stream] = *it;
       ++it;
@@ -433,6 +569,19 @@ namespace kagome::network::notifications {
     }
   }
 
+  void Protocol::updateQueueMetrics() {
+    size_t bytes = 0;
+    size_t messages = 0;
+    for (auto &peer : peers_out_ | std::views::values) {
+      if (auto *open = std::get_if<PeerOutOpen>(&peer)) {
+        bytes += open->queue_bytes;
+        messages += open->queue.size();
+      }
+    }
+    metric_queue_bytes_->set(bytes);
+    metric_queue_messages_->set(messages);
+  }
+
   size_t Protocol::peerCount(bool out) {
     size_t count = 0;
     if (not out) {
@@ -490,12 +639,14 @@ namespace kagome::network::notifications {
 
   std::shared_ptr<Protocol> Factory::make(ProtocolsGroups protocols_groups,
                                           size_t limit_in,
-                                          size_t limit_out) const {
+                                          size_t limit_out,
+                                          QueueLimit queue_limit) const {
     return std::make_shared<Protocol>(*main_thread_pool_,
                                       host_,
                                       scheduler_,
                                       std::move(protocols_groups),
                                       limit_in,
-                                      limit_out);
+                                      limit_out,
+                                      std::move(queue_limit));
   }
 }  // namespace kagome::network::notifications
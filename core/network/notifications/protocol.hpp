@@ -16,6 +16,7 @@
 #include <unordered_set>
 
 #include "common/buffer.hpp"
+#include "network/notifications/encode.hpp"
 
 namespace libp2p {
   struct Host;
@@ -34,6 +35,11 @@ namespace kagome::common {
   class MainThreadPool;
 }  // namespace kagome::common
 
+namespace kagome::metrics {
+  class Counter;
+  class Gauge;
+}  // namespace kagome::metrics
+
 namespace kagome::network::notifications {
   using common::MainThreadPool;
   using libp2p::Cancel;
@@ -47,6 +53,24 @@ namespace kagome::network::notifications {
   using libp2p::connection::Stream;
   using ProtocolsGroups = std::vector<StreamProtocols>;
 
+  /**
+   * Identifies message which is replaced by newer one with same key while
+   * still queued, e.g. neighbor packet or view.
+   */
+  using QueueKey = size_t;
+
+  /**
+   * Bounds outgoing messages queued for each peer.
+   * Protocols sharing peer compete for its bandwidth only through these
+   * budgets, so latency sensitive protocols get larger ones.
+   */
+  struct QueueLimit {
+    /// Protocol name in metrics
+    std::string name;
+    /// Max bytes queued for peer, oldest messages are dropped above it
+    size_t bytes;
+  };
+
   /**
    * Contains stream, framing, used protocol.
    */
@@ -81,9 +105,15 @@ namespace kagome::network::notifications {
   struct PeerOutOpen {
     PeerOutOpen(StreamInfoClose &&stream);
 
+    struct Queued {
+      FramedMessage message;
+      std::optional<QueueKey> key;
+    };
+
     StreamInfoClose stream;
     bool writing;
-    std::deque<std::shared_ptr<Buffer>> queue;
+    std::deque<Queued> queue;
+    size_t queue_bytes;
   };
   /**
    * State for backed off outgoing stream.
@@ -136,7 +166,8 @@ namespace kagome::network::notifications {
              std::shared_ptr<Scheduler> scheduler,
              ProtocolsGroups protocols_groups,
              size_t limit_in,
-             size_t limit_out);
+             size_t limit_out,
+             QueueLimit queue_limit);
 
     /**
      * Part of constructor:
@@ -155,6 +186,8 @@ namespace kagome::network::notifications {
      * Used for broadcast.
      */
     void peersOut(const PeersOutCb &cb) const;
+    using PeerFilter =
+        std::function<bool(const PeerId &, size_t protocol_group)>;
     /**
      * Write message with specified protocol to peer.
      * Message is ignored if peer protocol doesn't match.
@@ -167,6 +200,38 @@ namespace kagome::network::notifications {
      * Expects single protocol.
      */
     void write(const PeerId &peer_id, std::shared_ptr<Buffer> message);
+    /**
+     * Write framed message with specified protocol to peer.
+     * Message is ignored if peer protocol doesn't match.
+     * Queued message with same `key` is replaced instead of appending.
+     */
+    void writeFramed(const PeerId &peer_id,
+                     size_t protocol_group,
+                     FramedMessage message,
+                     std::optional<QueueKey> key = std::nullopt);
+    /**
+     * Write framed message to peer.
+     * Expects single protocol.
+     */
+    void writeFramed(const PeerId &peer_id,
+                     FramedMessage message,
+                     std::optional<QueueKey> key = std::nullopt);
+    /**
+     * Write framed message with specified protocol to peers accepted by
+     * `filter`. Message is shared by queues of all peers, so it is encoded
+     * and framed once regardless of peer count.
+     */
+    void broadcast(size_t protocol_group,
+                   FramedMessage message,
+                   const PeerFilter &filter,
+                   std::optional<QueueKey> key = std::nullopt);
+    /**
+     * Write framed message to peers accepted by `filter`.
+     * Expects single protocol.
+     */
+    void broadcast(FramedMessage message,
+                   const PeerFilter &filter,
+                   std::optional<QueueKey> key = std::nullopt);
     /**
      * Add/remove peer to reserved set.
      * Reserved peers are not affected by limits.
@@ -187,6 +252,9 @@ namespace kagome::network::notifications {
                      bool out,
                      Buffer &&handshake,
                      StreamInfoClose &&stream);
+    void enqueue(PeerOutOpen &open,
+                 FramedMessage message,
+                 std::optional<QueueKey> key);
     void write(const PeerId &peer_id, bool writer);
     void read(const PeerId &peer_id);
     void onMessage(const PeerId &peer_id,
@@ -194,6 +262,7 @@ namespace kagome::network::notifications {
                    Buffer &&message);
     void timer();
     void onTimer();
+    void updateQueueMetrics();
     size_t peerCount(bool out);
     bool shouldAccept(const PeerId &peer_id);
 
@@ -204,6 +273,11 @@ namespace kagome::network::notifications {
     ProtocolsGroups protocols_groups_;
     size_t limit_in_;
     size_t limit_out_;
+    QueueLimit queue_limit_;
+    metrics::Gauge *metric_queue_bytes_;
+    metrics::Gauge *metric_queue_messages_;
+    metrics::Counter *metric_dropped_;
+    metrics::Counter *metric_replaced_;
     StreamProtocols protocols_;
     std::weak_ptr<Controller> controller_;
     Cancel timer_;
@@ -227,7 +301,8 @@ namespace kagome::network::notifications {
      */
     std::shared_ptr<Protocol> make(ProtocolsGroups protocols_groups,
                                    size_t limit_in,
-                                   size_t limit_out) const;
+                                   size_t limit_out,
+                                   QueueLimit queue_limit) const;
 
    private:
     std::shared_ptr<MainThreadPool> main_thread_pool_;
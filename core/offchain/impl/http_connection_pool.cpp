@@ -0,0 +1,36 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "offchain/impl/http_connection_pool.hpp"
+
+namespace kagome::offchain {
+
+  HttpConnectionPool::HttpConnectionPool(OcwHttpThreadPool &thread_pool)
+      : io_{thread_pool.io_context()} {}
+
+  std::optional<HttpConnectionPool::Connection> HttpConnectionPool::take(
+      const std::string &origin) {
+    std::unique_lock lock{mutex_};
+    // newest first, it is less likely to be closed by server
+    for (auto it = idle_.rbegin(); it != idle_.rend(); ++it) {
+      if (it->first == origin) {
+        auto connection = std::move(it->second);
+        idle_.erase(std::next(it).base());
+        return connection;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void HttpConnectionPool::put(std::string origin, Connection connection) {
+    std::unique_lock lock{mutex_};
+    if (idle_.size() >= kMaxIdle) {
+      idle_.pop_front();
+    }
+    idle_.emplace_back(std::move(origin), std::move(connection));
+  }
+
+}  // namespace kagome::offchain
@@ -0,0 +1,71 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/ssl/ssl_stream.hpp>
+#include <boost/variant.hpp>
+
+#include "utils/asio_ssl_context_client.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace kagome::offchain {
+
+  /**
+   * Runs io of all offchain http requests.
+   */
+  class OcwHttpThreadPool final : public ThreadPool {
+   public:
+    OcwHttpThreadPool(std::shared_ptr<Watchdog> watchdog)
+        : ThreadPool(std::move(watchdog), "ocw_http", 1, std::nullopt) {}
+  };
+
+  /**
+   * Shared by offchain http requests.
+   * Keeps idle keep-alive connections for reuse by requests to same origin.
+   */
+  class HttpConnectionPool {
+   public:
+    /// Oldest idle connections are closed when limit is reached
+    static constexpr size_t kMaxIdle = 16;
+
+    using TcpStream = boost::beast::tcp_stream;
+    using SslStream = boost::beast::ssl_stream<TcpStream>;
+    using TcpStreamPtr = std::unique_ptr<TcpStream>;
+    using SslStreamPtr = std::unique_ptr<SslStream>;
+    using Stream = boost::variant<TcpStreamPtr, SslStreamPtr>;
+
+    struct Connection {
+      /// referenced by ssl stream, null for plain connection
+      std::shared_ptr<AsioSslContextClient> ssl_ctx;
+      Stream stream;
+    };
+
+    explicit HttpConnectionPool(OcwHttpThreadPool &thread_pool);
+
+    /// Io context of requests, streams are used only on its thread
+    const std::shared_ptr<boost::asio::io_context> &io() const {
+      return io_;
+    }
+
+    /// Takes idle connection to `origin` ("schema://host:port"), if any
+    std::optional<Connection> take(const std::string &origin);
+
+    /// Keeps connection to `origin` for reuse
+    void put(std::string origin, Connection connection);
+
+   private:
+    std::shared_ptr<boost::asio::io_context> io_;
+    std::mutex mutex_;
+    /// oldest first
+    std::list<std::pair<std::string, Connection>> idle_;
+  };
+
+}  // namespace kagome::offchain
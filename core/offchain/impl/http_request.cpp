@@ -12,6 +12,7 @@
 #include <thread>
 
 #include <boost/asio/connect.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/context.hpp>
 #include <boost/asio/ssl/error.hpp>
@@ -20,10 +21,11 @@
 
 namespace kagome::offchain {
 
-  HttpRequest::HttpRequest(RequestId id)
-      : id_(id),
-        resolver_(io_context_),
-        deadline_timer_(io_context_),
+  HttpRequest::HttpRequest(RequestId id,
+                           std::shared_ptr<HttpConnectionPool> connections)
+      : connections_{std::move(connections)},
+        id_(id),
+        resolver_(*connections_->io()),
         log_(log::createLogger("HttpRequest#" + std::to_string(id_),
                                "offchain")) {}
 
@@ -66,16 +68,8 @@ namespace kagome::offchain {
       return false;
     }
 
-    if (uri_.Schema == "https") {
-      secure_ = true;
-      if (not ssl_ctx_) {
-        ssl_ctx_.emplace(uri_.Host);
-      }
-      stream_ = std::make_unique<SslStream>(io_context_, *ssl_ctx_);
-    } else if (uri_.Schema == "http") {
-      secure_ = false;
-      stream_ = std::make_unique<TcpStream>(io_context_);
-    }
+    secure_ = uri_.Schema == "https";
+    origin_ = fmt::format("{}://{}:{}", uri_.Schema, uri_.Host, uri_.Port);
 
     SL_DEBUG(log_, "Initialized for URL: {}", uri_.to_string());
 
@@ -88,9 +82,53 @@ namespace kagome::offchain {
     request_.version(11);  // HTTP/1.1
     request_.set(boost::beast::http::field::host, uri_.Host);
     request_.set(boost::beast::http::field::user_agent, "KagomeOffchainWorker");
-    request_.set(boost::beast::http::field::connection, "Close");
 
+    // connect while request is being composed
+    boost::asio::post(*connections_->io(),
+                      [self{shared_from_this()}] { self->start(); });
+    return true;
+  }
+
+  HttpRequest::TcpStream &HttpRequest::tcpStream() {
+    return secure_ ? boost::beast::get_lowest_layer(
+                         *boost::relaxed_get<SslStreamPtr>(stream_))
+                   : boost::beast::get_lowest_layer(
+                         *boost::relaxed_get<TcpStreamPtr>(stream_));
+  }
+
+  void HttpRequest::start() {
+    if (auto connection = connections_->take(origin_)) {
+      SL_TRACE(log_, "Reuse connection to {}", origin_);
+      ssl_ctx_ = std::move(connection->ssl_ctx);
+      stream_ = std::move(connection->stream);
+      reused_ = true;
+      connected_ = true;
+      sendRequest();
+      return;
+    }
+    reused_ = false;
+    connected_ = false;
+    if (secure_) {
+      if (not ssl_ctx_) {
+        ssl_ctx_ = std::make_shared<AsioSslContextClient>(uri_.Host);
+      }
+      stream_ = std::make_unique<SslStream>(*connections_->io(), *ssl_ctx_);
+    } else {
+      stream_ = std::make_unique<TcpStream>(*connections_->io());
+    }
     resolve();
+  }
+
+  bool HttpRequest::retry(bool sent) {
+    if (not reused_) {
+      return false;
+    }
+    if (sent and request_.method() != boost::beast::http::verb::get) {
+      return false;
+    }
+    SL_TRACE(log_, "Reused connection was closed, retry");
+    buffer_.clear();
+    start();
     return true;
   }
 
@@ -109,35 +147,28 @@ namespace kagome::offchain {
                                     std::string(uri_.Host).c_str())) {
         boost::beast::error_code ec{static_cast<int>(::ERR_get_error()),
                                     boost::asio::error::get_ssl_category()};
-        error_message_ =
-            fmt::format("Can't resolve hostname {}: {}", uri_.Host, ec);
-        SL_ERROR(log_, "{}", error_message_);
-        status_ = ErrorHasOccurred;
+        fail(fmt::format("Can't resolve hostname {}: {}", uri_.Host, ec));
         return;
       }
     }
 
-    auto resolve_handler = [wp{weak_from_this()}](const auto &ec,
-                                                  const auto &it) {
-      if (auto self = wp.lock()) {
-        if (self->status_ != 0) {
-          SL_TRACE(
-              self->log_, "Result of resolving is ignored: {}", self->status_);
-          return;
-        }
-
-        if (!ec) {
-          SL_TRACE(self->log_, "Resolved hostname {}", self->uri_.Host);
-          self->resolver_iterator_ = it.begin();
-          self->connect();
-          return;
-        }
+    auto resolve_handler = [self{shared_from_this()}](const auto &ec,
+                                                      const auto &it) {
+      if (self->status_ != 0) {
+        SL_TRACE(
+            self->log_, "Result of resolving is ignored: {}", self->status_);
+        return;
+      }
 
-        self->error_message_ =
-            fmt::format("Can't resolve hostname {}: {}", self->uri_.Host, ec);
-        SL_ERROR(self->log_, "{}", self->error_message_);
-        self->status_ = ErrorHasOccurred;
+      if (!ec) {
+        SL_TRACE(self->log_, "Resolved hostname {}", self->uri_.Host);
+        self->resolver_iterator_ = it.begin();
+        self->connect();
+        return;
       }
+
+      self->fail(
+          fmt::format("Can't resolve hostname {}: {}", self->uri_.Host, ec));
     };
 
     resolver_.async_resolve(uri_.Host, uri_.Port, std::move(resolve_handler));
@@ -154,41 +185,36 @@ namespace kagome::offchain {
              resolver_iterator_->endpoint().address().to_string(),
              resolver_iterator_->endpoint().port());
 
-    auto &stream = secure_ ? boost::beast::get_lowest_layer(
-                                 *boost::relaxed_get<SslStreamPtr>(stream_))
-                           : boost::beast::get_lowest_layer(
-                                 *boost::relaxed_get<TcpStreamPtr>(stream_));
-
-    auto connect_handler = [wp{weak_from_this()}](const auto &ec,
-                                                  const auto &it) {
-      if (auto self = wp.lock()) {
-        if (self->status_ != 0) {
-          SL_TRACE(
-              self->log_, "Result of connecting is ignored: {}", self->status_);
-          return;
-        }
-
-        if (!ec) {
-          SL_TRACE(self->log_, "Connection established");
-          if (self->secure_) {
-            self->handshake();
-          } else {
-            self->connected_ = true;
-            self->sendRequest();
-          }
-          return;
-        }
+    auto &stream = tcpStream();
+    stream.expires_after(kIoTimeout);
 
-        SL_ERROR(self->log_, "Connection failed: {}", ec);
+    auto connect_handler = [self{shared_from_this()}](const auto &ec,
+                                                      const auto &it) {
+      if (self->status_ != 0) {
+        SL_TRACE(
+            self->log_, "Result of connecting is ignored: {}", self->status_);
+        return;
+      }
 
-        // Try to connect next endpoint if any
-        if (++self->resolver_iterator_ != resolver_iterator{}) {
-          SL_TRACE(self->log_, "Trying next endpoint…");
-          self->connect();
+      if (!ec) {
+        SL_TRACE(self->log_, "Connection established");
+        if (self->secure_) {
+          self->handshake();
         } else {
-          self->error_message_ = fmt::format("Connection failed: {}", ec);
-          self->status_ = ErrorHasOccurred;
+          self->connected_ = true;
+          self->sendRequest();
         }
+        return;
+      }
+
+      SL_ERROR(self->log_, "Connection failed: {}", ec);
+
+      // Try to connect next endpoint if any
+      if (++self->resolver_iterator_ != resolver_iterator{}) {
+        SL_TRACE(self->log_, "Trying next endpoint…");
+        self->connect();
+      } else {
+        self->fail(fmt::format("Connection failed: {}", ec));
       }
     };
 
@@ -204,25 +230,21 @@ namespace kagome::offchain {
 
     auto &stream = *boost::relaxed_get<SslStreamPtr>(stream_);
 
-    auto handshake_handler = [wp{weak_from_this()}](const auto &ec) {
-      if (auto self = wp.lock()) {
-        if (self->status_ != 0) {
-          SL_TRACE(
-              self->log_, "Result of handshake is ignored: {}", self->status_);
-          return;
-        }
-
-        if (!ec) {
-          SL_TRACE(self->log_, "Handshake successful");
-          self->connected_ = true;
-          self->sendRequest();
-          return;
-        }
+    auto handshake_handler = [self{shared_from_this()}](const auto &ec) {
+      if (self->status_ != 0) {
+        SL_TRACE(
+            self->log_, "Result of handshake is ignored: {}", self->status_);
+        return;
+      }
 
-        self->error_message_ = fmt::format("Handshake failed: {}", ec);
-        SL_ERROR(self->log_, "{}", self->error_message_);
-        self->status_ = ErrorHasOccurred;
+      if (!ec) {
+        SL_TRACE(self->log_, "Handshake successful");
+        self->connected_ = true;
+        self->sendRequest();
+        return;
       }
+
+      self->fail(fmt::format("Handshake failed: {}", ec));
     };
 
     stream.async_handshake(boost::asio::ssl::stream_base::client,
@@ -251,26 +273,26 @@ namespace kagome::offchain {
     auto serializer = std::make_shared<boost::beast::http::request_serializer<
         boost::beast::http::string_body>>(request_);
 
-    auto write_handler = [wp{weak_from_this()}, serializer](const auto &ec,
-                                                            auto written) {
-      if (auto self = wp.lock()) {
-        if (self->status_ != 0) {
-          SL_TRACE(self->log_,
-                   "Result of request sending is ignored: {}",
-                   self->status_);
-          return;
-        }
+    tcpStream().expires_after(kIoTimeout);
+    auto write_handler = [self{shared_from_this()}, serializer](
+                             const auto &ec, auto written) {
+      if (self->status_ != 0) {
+        SL_TRACE(self->log_,
+                 "Result of request sending is ignored: {}",
+                 self->status_);
+        return;
+      }
 
-        if (!ec) {
-          SL_TRACE(self->log_, "Request has sent successful");
-          self->recvResponse();
-          return;
-        }
+      if (!ec) {
+        SL_TRACE(self->log_, "Request has sent successful");
+        self->recvResponse();
+        return;
+      }
 
-        self->error_message_ = fmt::format("Request send was fail: {}", ec);
-        SL_ERROR(self->log_, "{}", self->error_message_);
-        self->status_ = ErrorHasOccurred;
+      if (self->retry(written != 0)) {
+        return;
       }
+      self->fail(fmt::format("Request send was fail: {}", ec));
     };
 
     // Send the HTTP request to the remote host
@@ -292,36 +314,37 @@ namespace kagome::offchain {
 
     SL_TRACE(log_, "Read response");
 
-    auto read_handler = [wp{weak_from_this()}](const auto &ec, auto received) {
-      if (auto self = wp.lock()) {
-        if (self->status_ != 0) {
-          SL_TRACE(self->log_,
-                   "Result of response receiving is ignored: {}",
-                   self->status_);
-          return;
-        }
+    parser_.emplace();
+    tcpStream().expires_after(kIoTimeout);
+    auto read_handler = [self{shared_from_this()}](const auto &ec,
+                                                   auto received) {
+      if (self->status_ != 0) {
+        SL_TRACE(self->log_,
+                 "Result of response receiving is ignored: {}",
+                 self->status_);
+        return;
+      }
 
-        if (!ec) {
-          SL_TRACE(self->log_, "Response has received successful", received);
-          self->done();
-          return;
-        }
+      if (!ec) {
+        SL_TRACE(self->log_, "Response has received successful", received);
+        self->done();
+        return;
+      }
 
-        self->error_message_ =
-            fmt::format("Response reception has failed: {}", ec);
-        SL_ERROR(self->log_, "{}", self->error_message_);
-        self->status_ = ErrorHasOccurred;
+      if (self->retry(true)) {
+        return;
       }
+      self->fail(fmt::format("Response reception has failed: {}", ec));
     };
 
     if (secure_) {
       auto &stream = *boost::relaxed_get<SslStreamPtr>(stream_);
       boost::beast::http::async_read(
-          stream, buffer_, parser_, std::move(read_handler));
+          stream, buffer_, *parser_, std::move(read_handler));
     } else {
       auto &stream = *boost::relaxed_get<TcpStreamPtr>(stream_);
       boost::beast::http::async_read(
-          stream, buffer_, parser_, std::move(read_handler));
+          stream, buffer_, *parser_, std::move(read_handler));
     }
   }
 
@@ -330,21 +353,34 @@ namespace kagome::offchain {
       return;
     }
 
-    if (secure_) {
-      auto &stream = *boost::relaxed_get<SslStreamPtr>(stream_);
-      boost::system::error_code ec;
-      boost::beast::get_lowest_layer(stream).socket().shutdown(
-          boost::asio::ip::tcp::socket::shutdown_both, ec);
+    response_ = parser_->release();
+    parser_.reset();
+
+    tcpStream().expires_never();
+    if (response_.keep_alive()) {
+      connections_->put(origin_, {ssl_ctx_, std::move(stream_)});
     } else {
-      auto &stream = *boost::relaxed_get<TcpStreamPtr>(stream_);
       boost::system::error_code ec;
-      boost::beast::get_lowest_layer(stream).socket().shutdown(
+      tcpStream().socket().shutdown(
           boost::asio::ip::tcp::socket::shutdown_both, ec);
     }
 
-    response_ = parser_.release();
-
+    std::unique_lock lock{mutex_};
     status_ = response_.result_int();
+    cv_.notify_all();
+  }
+
+  void HttpRequest::error(std::string message) {
+    std::unique_lock lock{mutex_};
+    error_message_ = std::move(message);
+  }
+
+  void HttpRequest::fail(std::string message) {
+    SL_ERROR(log_, "{}", message);
+    std::unique_lock lock{mutex_};
+    error_message_ = std::move(message);
+    status_ = ErrorHasOccurred;
+    cv_.notify_all();
   }
 
   RequestId HttpRequest::id() const {
@@ -352,14 +388,27 @@ namespace kagome::offchain {
   }
 
   HttpStatus HttpRequest::status() const {
+    std::unique_lock lock{mutex_};
+    return status_;
+  }
+
+  HttpStatus HttpRequest::wait(
+      std::optional<std::chrono::steady_clock::time_point> deadline) const {
+    std::unique_lock lock{mutex_};
+    auto completed = [&] { return status_ != 0; };
+    if (deadline) {
+      cv_.wait_until(lock, *deadline, completed);
+    } else {
+      cv_.wait(lock, completed);
+    }
     return status_;
   }
 
   Result<Success, Failure> HttpRequest::addRequestHeader(
       std::string_view name, std::string_view value) {
     if (not adding_headers_is_allowed_) {
-      error_message_ = "Trying to add header into ready request";
-      SL_ERROR(log_, "{}", error_message_);
+      error("Trying to add header into ready request");
+      SL_ERROR(log_, "Trying to add header into ready request");
       return Failure();
     }
 
@@ -370,10 +419,11 @@ namespace kagome::offchain {
 
   Result<Success, HttpError> HttpRequest::writeRequestBody(
       const common::Buffer &chunk,
-      std::optional<std::chrono::milliseconds> deadline_opt) {
+      // request is sent in background, nothing to wait for
+      std::optional<std::chrono::milliseconds>) {
     if (request_has_sent_) {
-      error_message_ = "Trying to write body into ready request";
-      SL_ERROR(log_, "{}", error_message_);
+      error("Trying to write body into ready request");
+      SL_ERROR(log_, "Trying to write body into ready request");
       return HttpError::IoError;
     }
 
@@ -383,19 +433,10 @@ namespace kagome::offchain {
 
     if (chunk.empty()) {
       request_has_sent_ = true;
-      request_is_ready_ = true;
-      sendRequest();
-      if (deadline_opt.has_value()) {
-        auto &deadline = deadline_opt.value();
-        io_context_.run_for(deadline);
-        if (status_ == 0) {
-          error_message_ = "Deadline has reached";
-          status_ = DeadlineHasReached;
-        }
-      } else {
-        io_context_.run();
-      }
-
+      boost::asio::post(*connections_->io(), [self{shared_from_this()}] {
+        self->request_is_ready_ = true;
+        self->sendRequest();
+      });
     } else {
       request_.body().append(
           // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -409,6 +450,9 @@ namespace kagome::offchain {
   std::vector<std::pair<std::string, std::string>>
   HttpRequest::getResponseHeaders() const {
     std::vector<std::pair<std::string, std::string>> result;
+    if (status() == 0) {
+      return result;
+    }
     for (auto &header : response_) {
       result.emplace_back(std::pair(header.name_string(), header.value()));
     }
@@ -419,15 +463,19 @@ namespace kagome::offchain {
   Result<uint32_t, HttpError> HttpRequest::readResponseBody(
       common::Buffer &chunk,
       std::optional<std::chrono::milliseconds> deadline) {
-    switch (status_) {
-      case InvalidIdentifier:
-        error_message_ = "Invalid identifier";
-        return HttpError::InvalidId;
+    std::optional<std::chrono::steady_clock::time_point> until;
+    if (deadline) {
+      until = std::chrono::steady_clock::now() + *deadline;
+    }
+    switch (wait(until)) {
+      case 0:
+        error("Deadline has reached");
+        return HttpError::Timeout;
       case DeadlineHasReached:
-        error_message_ = "Deadline has reached";
+        error("Deadline has reached");
         return HttpError::Timeout;
       case ErrorHasOccurred:
-        error_message_ = "IO error happened";
+        error("IO error happened");
         return HttpError::IoError;
     }
 
@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/context.hpp>
@@ -17,27 +20,46 @@
 
 #include "common/uri.hpp"
 #include "log/logger.hpp"
+#include "offchain/impl/http_connection_pool.hpp"
 #include "offchain/types.hpp"
 #include "utils/asio_ssl_context_client.hpp"
 
 namespace kagome::offchain {
 
+  /**
+   * Offchain http request. Io runs on thread of shared connection pool,
+   * offchain worker waits for completion.
+   */
   class HttpRequest final : public std::enable_shared_from_this<HttpRequest> {
    public:
+    /// Limits io of request, which nobody may wait for
+    static constexpr auto kIoTimeout = std::chrono::seconds(30);
+
     HttpRequest(HttpRequest &&) = delete;
     HttpRequest(const HttpRequest &) = delete;
 
-    HttpRequest(RequestId id);
+    HttpRequest(RequestId id, std::shared_ptr<HttpConnectionPool> connections);
 
     RequestId id() const;
 
     HttpStatus status() const;
 
+    /**
+     * Waits until request is completed or `deadline`.
+     * @returns status, zero if request is not completed yet
+     */
+    HttpStatus wait(
+        std::optional<std::chrono::steady_clock::time_point> deadline) const;
+
     bool init(HttpMethod method, std::string_view uri, common::Buffer meta);
 
     Result<Success, Failure> addRequestHeader(std::string_view name,
                                               std::string_view value);
 
+    /**
+     * Appends body chunk, empty chunk finalizes and sends request.
+     * Doesn't wait for response.
+     */
     Result<Success, HttpError> writeRequestBody(
         const common::Buffer &chunk,
         std::optional<std::chrono::milliseconds> deadline_opt);
@@ -49,42 +71,59 @@ namespace kagome::offchain {
         std::optional<std::chrono::milliseconds> deadline);
 
     std::string errorMessage() const {
+      std::unique_lock lock{mutex_};
       return error_message_;
     }
 
    private:
+    using TcpStream = HttpConnectionPool::TcpStream;
+    using SslStream = HttpConnectionPool::SslStream;
+    using TcpStreamPtr = HttpConnectionPool::TcpStreamPtr;
+    using SslStreamPtr = HttpConnectionPool::SslStreamPtr;
+
+    TcpStream &tcpStream();
+    void start();
     void resolve();
     void connect();
     void handshake();
     void sendRequest();
     void recvResponse();
+    /**
+     * Retries with new connection, if reused one was closed by server.
+     * Request which was (partially) sent is retried only if it's idempotent,
+     * because server may have processed it already.
+     */
+    bool retry(bool sent);
     void done();
+    void error(std::string message);
+    void fail(std::string message);
 
-    boost::asio::io_context io_context_;
+    std::shared_ptr<HttpConnectionPool> connections_;
     int16_t id_;
 
     boost::asio::ip::tcp::resolver resolver_;
-    std::optional<AsioSslContextClient> ssl_ctx_;
+    std::shared_ptr<AsioSslContextClient> ssl_ctx_;
 
-    using TcpStream = boost::beast::tcp_stream;
-    using SslStream = boost::beast::ssl_stream<TcpStream>;
-    using TcpStreamPtr = std::unique_ptr<TcpStream>;
-    using SslStreamPtr = std::unique_ptr<SslStream>;
-    boost::variant<TcpStreamPtr, SslStreamPtr> stream_;
+    HttpConnectionPool::Stream stream_;
 
     common::Uri uri_;
+    std::string origin_;
     bool adding_headers_is_allowed_ = true;
     bool request_has_sent_ = false;
     bool secure_ = false;
+    bool reused_ = false;
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    /// written on io thread under `mutex_`
     uint16_t status_ = 0;
     std::string error_message_;
     boost::beast::flat_buffer buffer_;
-    boost::asio::steady_timer deadline_timer_;
     using resolver_iterator =
         boost::asio::ip::tcp::resolver::results_type::const_iterator;
     resolver_iterator resolver_iterator_;
     boost::beast::http::request<boost::beast::http::string_body> request_;
-    boost::beast::http::response_parser<boost::beast::http::string_body>
+    std::optional<
+        boost::beast::http::response_parser<boost::beast::http::string_body>>
         parser_;
     boost::beast::http::response<boost::beast::http::string_body> response_;
     bool request_is_ready_ = false;
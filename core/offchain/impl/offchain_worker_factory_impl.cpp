@@ -19,7 +19,8 @@ namespace kagome::offchain {
       std::shared_ptr<api::AuthorApi> author_api,
       const network::OwnPeerInfo &current_peer_info,
       std::shared_ptr<offchain::OffchainPersistentStorage> persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<HttpConnectionPool> http_connections)
       : app_config_(app_config),
         clock_(std::move(clock)),
         storage_(std::move(storage)),
@@ -27,13 +28,15 @@ namespace kagome::offchain {
         author_api_(std::move(author_api)),
         current_peer_info_(current_peer_info),
         persistent_storage_(std::move(persistent_storage)),
-        offchain_worker_pool_(std::move(offchain_worker_pool)) {
+        offchain_worker_pool_(std::move(offchain_worker_pool)),
+        http_connections_(std::move(http_connections)) {
     BOOST_ASSERT(clock_);
     BOOST_ASSERT(storage_);
     BOOST_ASSERT(random_generator_);
     BOOST_ASSERT(author_api_);
     BOOST_ASSERT(persistent_storage_);
     BOOST_ASSERT(offchain_worker_pool_);
+    BOOST_ASSERT(http_connections_);
   }
 
   std::shared_ptr<OffchainWorker> OffchainWorkerFactoryImpl::make() {
@@ -44,7 +47,8 @@ namespace kagome::offchain {
                                                 author_api_,
                                                 current_peer_info_,
                                                 persistent_storage_,
-                                                offchain_worker_pool_);
+                                                offchain_worker_pool_,
+                                                http_connections_);
   }
 
 }  // namespace kagome::offchain
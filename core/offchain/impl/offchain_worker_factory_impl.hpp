@@ -30,6 +30,7 @@ namespace kagome::runtime {
 }
 
 namespace kagome::offchain {
+  class HttpConnectionPool;
   class OffchainWorkerPool;
   class OffchainWorkerFactoryImpl final : public OffchainWorkerFactory {
    public:
@@ -41,7 +42,8 @@ namespace kagome::offchain {
         std::shared_ptr<api::AuthorApi> author_api,
         const network::OwnPeerInfo &current_peer_info,
         std::shared_ptr<offchain::OffchainPersistentStorage> persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<HttpConnectionPool> http_connections);
 
     std::shared_ptr<OffchainWorker> make() override;
 
@@ -54,6 +56,7 @@ namespace kagome::offchain {
     const network::OwnPeerInfo &current_peer_info_;
     std::shared_ptr<offchain::OffchainPersistentStorage> persistent_storage_;
     std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool_;
+    std::shared_ptr<HttpConnectionPool> http_connections_;
   };
 
 }  // namespace kagome::offchain
@@ -32,7 +32,8 @@ namespace kagome::offchain {
       std::shared_ptr<api::AuthorApi> author_api,
       const network::OwnPeerInfo &current_peer_info,
       std::shared_ptr<OffchainPersistentStorage> persistent_storage,
-      std::shared_ptr<OffchainWorkerPool> ocw_pool)
+      std::shared_ptr<OffchainWorkerPool> ocw_pool,
+      std::shared_ptr<HttpConnectionPool> http_connections)
       : app_config_(app_config),
         clock_(std::move(clock)),
         random_generator_(std::move(random_generator)),
@@ -40,6 +41,7 @@ namespace kagome::offchain {
         current_peer_info_(current_peer_info),
         persistent_storage_(std::move(persistent_storage)),
         ocw_pool_(std::move(ocw_pool)),
+        http_connections_(std::move(http_connections)),
         log_(log::createLogger(
             "OffchainWorker#" + std::to_string(++ocw_counter_), "offchain")) {
     BOOST_ASSERT(clock_);
@@ -48,6 +50,7 @@ namespace kagome::offchain {
     BOOST_ASSERT(author_api_);
     BOOST_ASSERT(persistent_storage_);
     BOOST_ASSERT(ocw_pool_);
+    BOOST_ASSERT(http_connections_);
 
     local_storage_ =
         std::make_shared<OffchainLocalStorageImpl>(std::move(storage));
@@ -192,7 +195,8 @@ namespace kagome::offchain {
       HttpMethod method, std::string_view uri, common::Buffer meta) {
     auto request_id = ++request_id_;
 
-    auto request = std::make_shared<HttpRequest>(request_id);
+    auto request =
+        std::make_shared<HttpRequest>(request_id, http_connections_);
 
     if (not request->init(method, uri, std::move(meta))) {
       return Failure();
@@ -245,6 +249,14 @@ namespace kagome::offchain {
     std::vector<HttpStatus> result;
     result.reserve(ids.size());
 
+    std::optional<std::chrono::steady_clock::time_point> until;
+    if (deadline.has_value()) {
+      until = std::chrono::steady_clock::now()
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  clock_->zero() + std::chrono::milliseconds(deadline.value())
+                  - clock_->now());
+    }
+
     for (auto id : ids) {
       auto it = active_http_requests_.find(id);
       if (it == active_http_requests_.end()) {
@@ -253,15 +265,8 @@ namespace kagome::offchain {
       }
       auto &request = it->second;
 
-      HttpStatus status;  // NOLINT(cppcoreguidelines-init-variables)
-      while ((status = request->status()) == 0) {
-        if (deadline.has_value()
-            and (clock_->zero() + std::chrono::milliseconds(deadline.value()))
-                    < clock_->now()) {
-          break;
-        }
-        std::this_thread::sleep_for(latency_of_waiting);
-      }
+      // requests run concurrently, so waiting for each in turn is enough
+      auto status = request->wait(until);
 
       result.push_back(status ? status : DeadlineHasReached);
     }
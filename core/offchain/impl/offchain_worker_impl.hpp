@@ -39,10 +39,6 @@ namespace kagome::offchain {
       : public OffchainWorker,
         public std::enable_shared_from_this<OffchainWorkerImpl> {
    public:
-    // Duration of sleeping in loop of waiting.
-    // This value because all deadline quantized with milliseconds
-    static constexpr auto latency_of_waiting = 1ms;
-
     OffchainWorkerImpl(
         const application::AppConfiguration &app_config,
         std::shared_ptr<clock::SystemClock> clock,
@@ -51,7 +47,8 @@ namespace kagome::offchain {
         std::shared_ptr<api::AuthorApi> author_api,
         const network::OwnPeerInfo &current_peer_info,
         std::shared_ptr<OffchainPersistentStorage> persistent_storage,
-        std::shared_ptr<OffchainWorkerPool> ocw_pool);
+        std::shared_ptr<OffchainWorkerPool> ocw_pool,
+        std::shared_ptr<HttpConnectionPool> http_connections);
 
     void run(std::function<void()> &&func, std::string label) override;
 
@@ -121,6 +118,7 @@ namespace kagome::offchain {
     std::shared_ptr<offchain::OffchainPersistentStorage> persistent_storage_;
     std::shared_ptr<offchain::OffchainLocalStorage> local_storage_;
     std::shared_ptr<OffchainWorkerPool> ocw_pool_;
+    std::shared_ptr<HttpConnectionPool> http_connections_;
     log::Logger log_;
 
     static size_t ocw_counter_;
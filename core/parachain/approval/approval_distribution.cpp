@@ -599,6 +599,11 @@ namespace kagome::parachain {
         chain_sub_{std::move(chain_sub_engine)},
         parachain_processor_(std::move(parachain_processor)),
         crypto_provider_(std::move(crypto_provider)),
+        approval_verifier_{std::make_shared<crypto::Sr25519BatchVerifier>(
+            crypto_provider_,
+            approval_thread_pool.io_context(),
+            worker_pool_handler_,
+            crypto::Sr25519BatchVerifier::Config{})},
         pm_(std::move(pm)),
         router_(std::move(router)),
         babe_config_repo_(std::move(babe_config_repo)),
@@ -618,6 +623,7 @@ namespace kagome::parachain {
     BOOST_ASSERT(hasher_);
     BOOST_ASSERT(parachain_processor_);
     BOOST_ASSERT(crypto_provider_);
+    BOOST_ASSERT(approval_verifier_);
     BOOST_ASSERT(pm_);
     BOOST_ASSERT(router_);
     BOOST_ASSERT(babe_config_repo_);
@@ -1536,7 +1542,7 @@ namespace kagome::parachain {
                   },
                   [&](const network::vstaging::IndirectSignedApprovalVoteV2
                           &approval) {
-                    self->import_and_circulate_approval(item.first, approval);
+                    self->verify_and_import_approval(item.first, approval);
                   });
             }
             it = self->pending_known_.erase(it);
@@ -2105,7 +2111,7 @@ namespace kagome::parachain {
                    "Assignment accepted. (peer id={}, block hash={})",
                    source->get(),
                    block_hash);
-          entry.knowledge.known_messages[message_subject] = message_kind;
+          entry.knowledge.insert(message_subject, message_kind);
           if (auto it = entry.known_by.find(peer_id);
               it != entry.known_by.end()) {
             it->second.received.insert(message_subject, message_kind);
@@ -2204,6 +2210,76 @@ namespace kagome::parachain {
     }
   }
 
+  bool ApprovalDistribution::precheck_remote_approval(
+      const libp2p::peer::PeerId &peer_id,
+      const approval::IndirectSignedApprovalVoteV2 &vote) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    const auto &block_hash = vote.payload.payload.block_hash;
+    auto opt_entry = storedDistribBlockEntries().get(block_hash);
+    if (!opt_entry) {
+      logger_->info(
+          "Unexpected approval. (peer id={}, block hash={}, validator "
+          "index={})",
+          peer_id,
+          block_hash,
+          vote.payload.ix);
+      return false;
+    }
+    auto &entry = opt_entry->get();
+    auto message_subject{std::make_tuple(
+        block_hash, vote.payload.payload.candidate_indices, vote.payload.ix)};
+    auto message_kind{approval::MessageKind::Approval};
+
+    if (!entry.knowledge.contains(message_subject,
+                                  approval::MessageKind::Assignment)) {
+      SL_TRACE(logger_,
+               "Unknown approval assignment. (peer id={}, block hash={}, "
+               "validator={})",
+               peer_id,
+               std::get<0>(message_subject),
+               std::get<2>(message_subject));
+      return false;
+    }
+
+    // check if our knowledge of the peer already contains this approval
+    if (auto it = entry.known_by.find(peer_id); it != entry.known_by.end()) {
+      if (auto &peer_knowledge = it->second;
+          peer_knowledge.contains(message_subject, message_kind)) {
+        if (!peer_knowledge.received.insert(message_subject, message_kind)) {
+          SL_TRACE(logger_,
+                   "Duplicate approval. (peer id={}, block_hash={}, "
+                   "validator index={})",
+                   peer_id,
+                   std::get<0>(message_subject),
+                   std::get<2>(message_subject));
+        }
+        return false;
+      }
+    } else {
+      SL_TRACE(logger_,
+               "Approval from a peer is out of view. (peer id={}, "
+               "block_hash={}, validator index={})",
+               peer_id,
+               std::get<0>(message_subject),
+               std::get<2>(message_subject));
+    }
+
+    /// if the approval is known to be valid, reward the peer
+    if (entry.knowledge.contains(message_subject, message_kind)) {
+      SL_TRACE(logger_,
+               "Known approval. (peer id={}, block hash={}, validator={})",
+               peer_id,
+               std::get<0>(message_subject),
+               std::get<2>(message_subject));
+
+      if (auto it = entry.known_by.find(peer_id); it != entry.known_by.end()) {
+        it->second.received.insert(message_subject, message_kind);
+      }
+      return false;
+    }
+    return true;
+  }
+
   void ApprovalDistribution::import_and_circulate_approval(
       const MessageSource &source,
       const approval::IndirectSignedApprovalVoteV2 &vote) {
@@ -2236,52 +2312,7 @@ namespace kagome::parachain {
 
     if (source) {
       const auto &peer_id = source->get();
-      if (!entry.knowledge.contains(message_subject,
-                                    approval::MessageKind::Assignment)) {
-        SL_TRACE(logger_,
-                 "Unknown approval assignment. (peer id={}, block hash={}, "
-                 "validator={})",
-                 peer_id,
-                 std::get<0>(message_subject),
-                 std::get<2>(message_subject));
-        return;
-      }
-
-      // check if our knowledge of the peer already contains this approval
-      if (auto it = entry.known_by.find(peer_id); it != entry.known_by.end()) {
-        if (auto &peer_knowledge = it->second;
-            peer_knowledge.contains(message_subject, message_kind)) {
-          if (!peer_knowledge.received.insert(message_subject, message_kind)) {
-            SL_TRACE(logger_,
-                     "Duplicate approval. (peer id={}, block_hash={}, "
-                     "validator index={})",
-                     peer_id,
-                     std::get<0>(message_subject),
-                     std::get<2>(message_subject));
-          }
-          return;
-        }
-      } else {
-        SL_TRACE(logger_,
-                 "Approval from a peer is out of view. (peer id={}, "
-                 "block_hash={}, validator index={})",
-                 peer_id,
-                 std::get<0>(message_subject),
-                 std::get<2>(message_subject));
-      }
-
-      /// if the approval is known to be valid, reward the peer
-      if (entry.knowledge.contains(message_subject, message_kind)) {
-        SL_TRACE(logger_,
-                 "Known approval. (peer id={}, block hash={}, validator={})",
-                 peer_id,
-                 std::get<0>(message_subject),
-                 std::get<2>(message_subject));
-
-        if (auto it = entry.known_by.find(peer_id);
-            it != entry.known_by.end()) {
-          it->second.received.insert(message_subject, message_kind);
-        }
+      if (!precheck_remote_approval(peer_id, vote)) {
         return;
       }
 
@@ -2354,6 +2385,92 @@ namespace kagome::parachain {
     }
   }
 
+  void ApprovalDistribution::verify_and_import_approval(
+      const libp2p::peer::PeerId &peer_id,
+      const approval::IndirectSignedApprovalVoteV2 &vote) {
+    BOOST_ASSERT(approval_thread_handler_->isInCurrentThread());
+    // drop approval before expensive signature check
+    if (!precheck_remote_approval(peer_id, vote)) {
+      return;
+    }
+    const auto &block_hash = vote.payload.payload.block_hash;
+    auto opt_block_entry = storedBlockEntries().get(block_hash);
+    if (!opt_block_entry) {
+      SL_TRACE(logger_,
+               "Approval for unknown block. (peer id={}, block hash={})",
+               peer_id,
+               block_hash);
+      return;
+    }
+    const auto &block_entry = opt_block_entry->get();
+
+    std::vector<CandidateHash> candidate_hashes;
+    auto r = approval::iter_ones(
+        vote.payload.payload.candidate_indices,
+        [&](const auto candidate_index) -> outcome::result<void> {
+          if (candidate_index >= block_entry.candidates.size()) {
+            return ApprovalDistributionError::CANDIDATE_INDEX_OUT_OF_BOUNDS;
+          }
+          candidate_hashes.emplace_back(
+              block_entry.candidates[candidate_index].second);
+          return outcome::success();
+        });
+    if (r.has_error() or candidate_hashes.empty()) {
+      SL_TRACE(logger_,
+               "Approval with wrong candidate indices. (peer id={}, block "
+               "hash={}, validator index={})",
+               peer_id,
+               block_hash,
+               vote.payload.ix);
+      return;
+    }
+
+    auto session_info_res =
+        parachain_host_->session_info(block_hash, block_entry.session);
+    if (session_info_res.has_error() or !session_info_res.value()
+        or vote.payload.ix >= session_info_res.value()->validators.size()) {
+      SL_TRACE(logger_,
+               "No validator key for approval. (block hash={}, session={}, "
+               "validator index={})",
+               block_hash,
+               block_entry.session,
+               vote.payload.ix);
+      return;
+    }
+    const auto &pubkey =
+        session_info_res.value()->validators[vote.payload.ix];
+
+    // single candidate payload is compatible with `ApprovalVote`
+    static constexpr std::array<uint8_t, 4ull> kMagic{'A', 'P', 'P', 'R'};
+    auto payload =
+        candidate_hashes.size() == 1
+            ? scale::encode(std::make_tuple(
+                  kMagic, candidate_hashes.front(), block_entry.session))
+            : scale::encode(std::make_tuple(
+                  kMagic, candidate_hashes, block_entry.session));
+
+    approval_verifier_->push(
+        vote.signature,
+        common::Buffer{std::move(payload.value())},
+        pubkey,
+        [weak{weak_from_this()}, peer_id, vote](bool valid) {
+          auto self = weak.lock();
+          if (!self) {
+            return;
+          }
+          if (!valid) {
+            SL_WARN(self->logger_,
+                    "Invalid approval signature. (peer id={}, block hash={}, "
+                    "validator index={})",
+                    peer_id,
+                    vote.payload.payload.block_hash,
+                    vote.payload.ix);
+            return;
+          }
+          self->import_and_circulate_approval(peer_id, vote);
+        });
+  }
+
   network::vstaging::Approvals ApprovalDistribution::sanitize_v1_approvals(
       const network::Approvals &approvals) {
     network::vstaging::Approvals sanitized_approvals;
@@ -2559,7 +2676,7 @@ namespace kagome::parachain {
               continue;
             }
 
-            import_and_circulate_approval(peer_id, approval_vote);
+            verify_and_import_approval(peer_id, approval_vote);
           }
         },
         [&](const auto &) { UNREACHABLE; });
@@ -3346,8 +3463,7 @@ namespace kagome::parachain {
           const auto [assignment_knowledge, message_kind] =
               approval_entry.create_assignment_knowledge(block);
 
-          if (!peer_knowledge.contains(assignment_knowledge, message_kind)) {
-            peer_knowledge.sent.insert(assignment_knowledge, message_kind);
+          if (peer_knowledge.markSent(assignment_knowledge, message_kind)) {
             assignments_to_send.emplace_back(network::vstaging::Assignment{
                 .indirect_assignment_cert = assignment_message.first,
                 .candidate_bitfield = assignment_message.second,
@@ -3359,11 +3475,9 @@ namespace kagome::parachain {
                 approval::PeerKnowledge::generate_approval_key(
                     approval_message);
 
-            if (!peer_knowledge.contains(approval_knowledge.first,
-                                         approval_knowledge.second)) {
+            if (peer_knowledge.markSent(approval_knowledge.first,
+                                        approval_knowledge.second)) {
               approvals_to_send.emplace_back(approval_message);
-              peer_knowledge.sent.insert(approval_knowledge.first,
-                                         approval_knowledge.second);
             }
           }
         }
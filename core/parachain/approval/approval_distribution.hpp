@@ -22,6 +22,7 @@
 #include "consensus/timeline/types.hpp"
 #include "crypto/key_store/key_file_storage.hpp"
 #include "crypto/key_store/session_keys.hpp"
+#include "crypto/sr25519/sr25519_batch_verifier.hpp"
 #include "crypto/type_hasher.hpp"
 #include "dispute_coordinator/dispute_coordinator.hpp"
 #include "injector/lazy.hpp"
@@ -669,6 +670,18 @@ namespace kagome::parachain {
         const MessageSource &source,
         const approval::IndirectSignedApprovalVoteV2 &vote);
 
+    /// Cheap checks of remote approval, done before signature check.
+    /// @return true if approval is new and must be imported
+    bool precheck_remote_approval(
+        const libp2p::peer::PeerId &peer_id,
+        const approval::IndirectSignedApprovalVoteV2 &vote);
+
+    /// Verifies signature of remote approval in batch with others,
+    /// imports and circulates it if signature is valid.
+    void verify_and_import_approval(
+        const libp2p::peer::PeerId &peer_id,
+        const approval::IndirectSignedApprovalVoteV2 &vote);
+
     // Returns the claimed core bitfield from the assignment cert, the candidate
     // hash and a
     // `BlockEntry`. Can fail only for VRF Delay assignments for which we cannot
@@ -878,6 +891,7 @@ namespace kagome::parachain {
 
     std::shared_ptr<ParachainProcessorImpl> parachain_processor_;
     std::shared_ptr<crypto::Sr25519Provider> crypto_provider_;
+    std::shared_ptr<crypto::Sr25519BatchVerifier> approval_verifier_;
     std::shared_ptr<network::PeerManager> pm_;
     std::shared_ptr<network::Router> router_;
     std::shared_ptr<consensus::babe::BabeConfigRepository> babe_config_repo_;
@@ -6,9 +6,14 @@
 
 #pragma once
 
+#include <limits>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "common/visitor.hpp"
+#include "consensus/constants.hpp"
 #include "consensus/timeline/types.hpp"
 #include "outcome/outcome.hpp"
 #include "parachain/approval/approval.hpp"
@@ -18,8 +23,7 @@
 template <>
 struct std::hash<scale::BitVec> {
   auto operator()(const scale::BitVec &v) const {
-    auto s = scale::encode(v).value();
-    return boost::hash_range(s.begin(), s.end());
+    return std::hash<std::vector<bool>>{}(v.bits);
   }
 };
 
@@ -28,50 +32,108 @@ namespace kagome::parachain::approval {
   enum struct MessageKind { Assignment, Approval };
   using MessageSubject = std::tuple<Hash, scale::BitVec, ValidatorIndex>;
 
-  struct MessageSubjectHash {
-    auto operator()(const MessageSubject &obj) const {
-      size_t value{0ull};
-      boost::hash_range(
-          value, std::get<0>(obj).begin(), std::get<0>(obj).end());
-      boost::hash_range(
-          value, std::get<1>(obj).bits.begin(), std::get<1>(obj).bits.end());
-      boost::hash_combine(value, std::get<2>(obj));
-      return value;
-    }
-  };
-
+  /**
+   * Messages known about one block, block hash of subject is implied by the
+   * owning block entry.
+   * Subjects are kept in flat arena and chained per validator index, so lookup
+   * is an index plus scan of few (usually one) claimed candidates bitfields of
+   * that validator.
+   * Heads of validator indices over `kMaxValidatorsNumber` are kept in map, so
+   * bogus index from peer doesn't allocate huge array.
+   */
   struct Knowledge {
     // When there is no entry, this means the message is unknown
     // When there is an entry with `MessageKind::Assignment`, the assignment is
     // known. When there is an entry with `MessageKind::Approval`, the
     // assignment and approval are known.
-    std::unordered_map<MessageSubject, MessageKind, MessageSubjectHash>
-        known_messages{};
-
     bool contains(const MessageSubject &message,
                   const MessageKind &kind) const {
-      auto it = known_messages.find(message);
-      if (it == known_messages.end()) {
+      auto known = find(std::get<2>(message), std::get<1>(message));
+      if (known == nullptr) {
         return false;
       }
       if (MessageKind::Assignment == kind) {
         return true;
       }
-      return MessageKind::Approval == it->second;
+      return MessageKind::Approval == known->kind;
     }
 
     bool insert(const MessageSubject &message, const MessageKind &kind) {
-      const auto &[it, inserted] = known_messages.emplace(message, kind);
-      if (inserted) {
-        return true;
+      const auto validator = std::get<2>(message);
+      const auto &candidates = std::get<1>(message);
+      if (auto known = find(validator, candidates); known != nullptr) {
+        if (MessageKind::Assignment == known->kind
+            && MessageKind::Approval == kind) {
+          known->kind = MessageKind::Approval;
+          return true;
+        }
+        return false;
       }
-      if (MessageKind::Assignment == it->second
-          && MessageKind::Approval == kind) {
-        it->second = MessageKind::Approval;
-        return true;
+      known_.emplace_back(Known{
+          .candidates = candidates,
+          .kind = kind,
+          .next = head(validator),
+      });
+      setHead(validator, known_.size() - 1);
+      return true;
+    }
+
+    /// Number of known subjects
+    size_t size() const {
+      return known_.size();
+    }
+
+   private:
+    static constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+    struct Known {
+      scale::BitVec candidates;
+      MessageKind kind;
+      /// next subject of same validator
+      uint32_t next;
+    };
+
+    uint32_t head(ValidatorIndex validator) const {
+      if (validator < heads_.size()) {
+        return heads_[validator];
+      }
+      if (validator < consensus::kMaxValidatorsNumber) {
+        return kNone;
       }
-      return false;
+      auto it = far_heads_.find(validator);
+      return it != far_heads_.end() ? it->second : kNone;
     }
+
+    void setHead(ValidatorIndex validator, uint32_t i) {
+      if (validator >= consensus::kMaxValidatorsNumber) {
+        far_heads_[validator] = i;
+        return;
+      }
+      if (heads_.size() <= validator) {
+        heads_.resize(validator + 1, kNone);
+      }
+      heads_[validator] = i;
+    }
+
+    const Known *find(ValidatorIndex validator,
+                      const scale::BitVec &candidates) const {
+      for (auto i = head(validator); i != kNone; i = known_[i].next) {
+        if (known_[i].candidates.bits == candidates.bits) {
+          return &known_[i];
+        }
+      }
+      return nullptr;
+    }
+
+    Known *find(ValidatorIndex validator, const scale::BitVec &candidates) {
+      return const_cast<Known *>(
+          std::as_const(*this).find(validator, candidates));
+    }
+
+    /// first subject of each validator
+    std::vector<uint32_t> heads_;
+    std::unordered_map<ValidatorIndex, uint32_t> far_heads_;
+    std::vector<Known> known_;
   };
 
   struct PeerKnowledge {
@@ -85,6 +147,17 @@ namespace kagome::parachain::approval {
       return sent.contains(message, kind) || received.contains(message, kind);
     }
 
+    /**
+     * Marks message as sent, unless peer already knows it.
+     * @return true if message should be sent to peer
+     */
+    bool markSent(const MessageSubject &message, const MessageKind &kind) {
+      if (received.contains(message, kind)) {
+        return false;
+      }
+      return sent.insert(message, kind);
+    }
+
     // Generate the knowledge keys for querying if an approval is known by peer.
     static std::pair<MessageSubject, MessageKind> generate_approval_key(
         const IndirectSignedApprovalVoteV2 &approval) {
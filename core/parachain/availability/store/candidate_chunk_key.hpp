@@ -31,6 +31,12 @@ namespace kagome {
       return key;
     }
 
+    /// Key of candidate's persisted `AvailableData`.
+    /// Shares prefix with candidate chunks, so range removal covers both.
+    static HashKey encode_data(const parachain::CandidateHash &candidate_hash) {
+      return encode_hash(candidate_hash);
+    }
+
     static HashKey encode_hash(const parachain::CandidateHash &candidate_hash) {
       HashKey key;
       std::copy_n(candidate_hash.data(), kCandidateHashSize, key.data());
@@ -6,24 +6,65 @@
 
 #include "parachain/availability/store/store_impl.hpp"
 #include "candidate_chunk_key.hpp"
+#include "metrics/histogram_timer.hpp"
 
 constexpr uint64_t KEEP_CANDIDATES_TIMEOUT = 1 * 60;
+/// Persisted data is kept long enough to serve approvals and disputes
+constexpr uint64_t KEEP_PERSISTED_TIMEOUT = 25 * 60 * 60;
+
+/// Write-behind queue is committed when it exceeds any of these limits
+constexpr size_t kMaxPendingWrites = 1024;
+constexpr size_t kMaxPendingBytes = 16 * 1024 * 1024;
+constexpr uint64_t kMaxPendingAge = 1;
 
 namespace kagome::parachain {
+  static const metrics::GaugeHelper metric_hot_bytes{
+      "kagome_parachain_av_store_hot_bytes",
+      "Bytes of availability data kept in memory",
+  };
+  static const metrics::GaugeHelper metric_cold_bytes{
+      "kagome_parachain_av_store_cold_bytes",
+      "Bytes of availability data written to database and not yet pruned",
+  };
+  static const metrics::GaugeHelper metric_pending_bytes{
+      "kagome_parachain_av_store_pending_bytes",
+      "Bytes of availability data waiting for write-behind",
+  };
+  static const metrics::CounterHelper metric_evicted{
+      "kagome_parachain_av_store_evicted_candidates",
+      "Number of candidates evicted from availability store memory",
+  };
+  static const metrics::CounterHelper metric_db_writes{
+      "kagome_parachain_av_store_db_writes",
+      "Number of entries written to availability database",
+  };
+  static const metrics::CounterHelper metric_db_batches{
+      "kagome_parachain_av_store_db_batches",
+      "Number of availability database write batches, "
+      "writes per batch is write amplification reduction",
+  };
+
   AvailabilityStoreImpl::AvailabilityStoreImpl(
       std::shared_ptr<application::AppStateManager> app_state_manager,
+      const application::AppConfiguration &app_config,
       clock::SteadyClock &steady_clock,
+      std::shared_ptr<libp2p::basic::Scheduler> scheduler,
       std::shared_ptr<storage::SpacedStorage> storage,
       primitives::events::ChainSubscriptionEnginePtr chain_sub_engine)
       : steady_clock_{steady_clock},
+        scheduler_{std::move(scheduler)},
         storage_{std::move(storage)},
-        chain_sub_{std::move(chain_sub_engine)} {
+        chain_sub_{std::move(chain_sub_engine)},
+        hot_budget_{size_t{app_config.availabilityStoreMemoryLimit()} * 1024
+                    * 1024} {
+    BOOST_ASSERT(scheduler_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
 
     app_state_manager->takeControl(*this);
   }
 
   bool AvailabilityStoreImpl::start() {
+    state_.exclusiveAccess([&](auto &state) { load_persisted_no_lock(state); });
     chain_sub_.onDeactivate(
         [weak{weak_from_this()}](
             const primitives::events::RemoveAfterFinalizationParams &params) {
@@ -43,6 +84,10 @@ namespace kagome::parachain {
     return true;
   }
 
+  void AvailabilityStoreImpl::stop() {
+    state_.exclusiveAccess([&](auto &state) { flush_no_lock(state); });
+  }
+
   bool AvailabilityStoreImpl::hasChunk(const CandidateHash &candidate_hash,
                                        ValidatorIndex index) const {
     const auto has_chunk = state_.sharedAccess([&](const auto &state) {
@@ -61,31 +106,33 @@ namespace kagome::parachain {
                   "Failed to get AvaliabilityStorage space in hasChunk");
       return false;
     }
-    auto chunk_from_db =
-        space->get(CandidateChunkKey::encode(candidate_hash, index));
-    return chunk_from_db.has_value();
+    auto chunk_in_db =
+        space->contains(CandidateChunkKey::encode(candidate_hash, index));
+    return chunk_in_db.has_value() and chunk_in_db.value();
   }
 
   bool AvailabilityStoreImpl::hasPov(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
+    const auto has_pov = state_.sharedAccess([&](const auto &state) {
       auto it = state.per_candidate_.find(candidate_hash);
       if (it == state.per_candidate_.end()) {
         return false;
       }
       return it->second.pov.has_value();
     });
+    return has_pov or getPersistedData(candidate_hash).has_value();
   }
 
   bool AvailabilityStoreImpl::hasData(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess([&](const auto &state) {
+    const auto has_data = state_.sharedAccess([&](const auto &state) {
       auto it = state.per_candidate_.find(candidate_hash);
       if (it == state.per_candidate_.end()) {
         return false;
       }
       return it->second.data.has_value();
     });
+    return has_data or getPersistedData(candidate_hash).has_value();
   }
 
   std::optional<AvailabilityStore::ErasureChunk>
@@ -132,7 +179,7 @@ namespace kagome::parachain {
 
   std::optional<AvailabilityStore::ParachainBlock>
   AvailabilityStoreImpl::getPov(const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess(
+    auto pov = state_.sharedAccess(
         [&](const auto &state)
             -> std::optional<AvailabilityStore::ParachainBlock> {
           auto it = state.per_candidate_.find(candidate_hash);
@@ -141,12 +188,19 @@ namespace kagome::parachain {
           }
           return it->second.pov;
         });
+    if (pov) {
+      return pov;
+    }
+    if (auto data = getPersistedData(candidate_hash)) {
+      return std::move(data->pov);
+    }
+    return std::nullopt;
   }
 
   std::optional<AvailabilityStore::AvailableData>
   AvailabilityStoreImpl::getPovAndData(
       const CandidateHash &candidate_hash) const {
-    return state_.sharedAccess(
+    auto data = state_.sharedAccess(
         [&](const auto &state)
             -> std::optional<AvailabilityStore::AvailableData> {
           auto it = state.per_candidate_.find(candidate_hash);
@@ -158,23 +212,73 @@ namespace kagome::parachain {
           }
           return AvailableData{*it->second.pov, *it->second.data};
         });
+    if (data) {
+      return data;
+    }
+    return getPersistedData(candidate_hash);
+  }
+
+  std::optional<AvailabilityStore::AvailableData>
+  AvailabilityStoreImpl::getPersistedData(
+      const CandidateHash &candidate_hash) const {
+    auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
+    if (not space) {
+      SL_ERROR(logger, "Failed to get space for candidate {}", candidate_hash);
+      return std::nullopt;
+    }
+    auto data_from_db =
+        space->tryGet(CandidateChunkKey::encode_data(candidate_hash));
+    if (not data_from_db) {
+      SL_ERROR(logger,
+               "Failed to get data of candidate {} error {}",
+               candidate_hash,
+               data_from_db.error());
+      return std::nullopt;
+    }
+    if (not data_from_db.value()) {
+      return std::nullopt;
+    }
+    auto decoded_data = scale::decode<AvailableData>(*data_from_db.value());
+    if (not decoded_data) {
+      SL_ERROR(logger,
+               "Failed to decode data of candidate {} error {}",
+               candidate_hash,
+               decoded_data.error());
+      return std::nullopt;
+    }
+    return std::move(decoded_data.value());
   }
 
   std::vector<AvailabilityStore::ErasureChunk> AvailabilityStoreImpl::getChunks(
       const CandidateHash &candidate_hash) const {
-    auto chunks = state_.sharedAccess([&](const auto &state) {
-      std::vector<AvailabilityStore::ErasureChunk> chunks;
+    std::unordered_map<ValidatorIndex, ErasureChunk> hot;
+    // `storeData` puts all chunks into memory, while candidate recreated by
+    // `putChunk` after eviction has only some of them
+    auto complete = state_.sharedAccess([&](const auto &state) {
       auto it = state.per_candidate_.find(candidate_hash);
-      if (it != state.per_candidate_.end()) {
-        for (auto &p : it->second.chunks) {
-          chunks.emplace_back(p.second);
-        }
+      if (it == state.per_candidate_.end()) {
+        return false;
       }
-      return chunks;
+      hot = it->second.chunks;
+      return it->second.pov.has_value();
     });
-    if (not chunks.empty()) {
-      return chunks;
+    std::vector<ErasureChunk> chunks;
+    if (not complete) {
+      chunks = getPersistedChunks(candidate_hash);
+      std::erase_if(chunks, [&](const ErasureChunk &chunk) {
+        return hot.contains(chunk.index);
+      });
     }
+    for (auto &p : hot) {
+      chunks.emplace_back(std::move(p.second));
+    }
+    return chunks;
+  }
+
+  std::vector<AvailabilityStore::ErasureChunk>
+  AvailabilityStoreImpl::getPersistedChunks(
+      const CandidateHash &candidate_hash) const {
+    std::vector<ErasureChunk> chunks;
     auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
     if (not space) {
       SL_CRITICAL(logger,
@@ -208,6 +312,13 @@ namespace kagome::parachain {
          and std::equal(seek_key.begin(), seek_key.end(), key_value.begin());
     };
     while (cursor->isValid() and check_key(cursor->key())) {
+      // skip persisted available data, it shares the prefix
+      if (cursor->key()->size() != CandidateChunkKey::Key::size()) {
+        if (not cursor->next()) {
+          break;
+        }
+        continue;
+      }
       const auto cursor_opt_value = cursor->value();
       if (cursor_opt_value) {
         auto decoded_res =
@@ -238,9 +349,13 @@ namespace kagome::parachain {
       SL_TRACE(logger,
                "[Availability store statistics]:"
                "\n\t-> state.candidates={}"
-               "\n\t-> state.per_candidate={}",
+               "\n\t-> state.per_candidate={}"
+               "\n\t-> state.hot_bytes={}"
+               "\n\t-> state.pending_writes={}",
                state.candidates_.size(),
-               state.per_candidate_.size());
+               state.per_candidate_.size(),
+               state.hot_bytes_,
+               state.pending_writes_.size());
     });
   }
 
@@ -252,6 +367,191 @@ namespace kagome::parachain {
       remove_no_lock(state, state.candidates_living_keeper_[0].second);
       state.candidates_living_keeper_.pop_front();
     }
+    prune_persisted_no_lock(state);
+  }
+
+  void AvailabilityStoreImpl::prune_persisted_no_lock(State &state) {
+    const auto now = steady_clock_.nowUint64();
+    if (state.persisted_living_keeper_.empty()
+        or state.persisted_living_keeper_.front().first
+                   + KEEP_PERSISTED_TIMEOUT
+               >= now) {
+      return;
+    }
+    // pending writes must not resurrect removed entries
+    flush_no_lock(state);
+    while (not state.persisted_living_keeper_.empty()
+           and state.persisted_living_keeper_.front().first
+                       + KEEP_PERSISTED_TIMEOUT
+                   < now) {
+      for (const auto &candidate_hash :
+           state.persisted_living_keeper_.front().second) {
+        if (state.per_candidate_.count(candidate_hash) == 0) {
+          remove_persisted_no_lock(candidate_hash);
+        }
+      }
+      state.persisted_living_keeper_.pop_front();
+    }
+  }
+
+  void AvailabilityStoreImpl::load_persisted_no_lock(State &state) {
+    auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
+    if (not space) {
+      SL_ERROR(logger, "Failed to get AvaliabilityStorage space");
+      return;
+    }
+    // time of persisting is not stored, so restart time is used
+    std::unordered_set<CandidateHash> candidates;
+    size_t bytes = 0;
+    auto cursor = space->cursor();
+    auto seek_res = cursor->seekFirst();
+    if (not seek_res) {
+      SL_ERROR(logger,
+               "Failed to seek AvaliabilityStorage error: {}",
+               seek_res.error());
+      return;
+    }
+    while (cursor->isValid()) {
+      auto key = cursor->key();
+      if (key and key->size() >= CandidateChunkKey::kCandidateHashSize) {
+        CandidateHash candidate_hash;
+        std::copy_n(key->data(),
+                    CandidateChunkKey::kCandidateHashSize,
+                    candidate_hash.data());
+        candidates.emplace(candidate_hash);
+      }
+      if (auto value = cursor->value()) {
+        bytes += value->size();
+      }
+      if (not cursor->next()) {
+        break;
+      }
+    }
+    SL_VERBOSE(logger,
+               "Loaded {} persisted candidates, {} bytes",
+               candidates.size(),
+               bytes);
+    metric_cold_bytes->set(bytes);
+    if (not candidates.empty()) {
+      state.persisted_living_keeper_.emplace_back(steady_clock_.nowUint64(),
+                                                  std::move(candidates));
+    }
+  }
+
+  void AvailabilityStoreImpl::account_hot_no_lock(
+      State &state,
+      const CandidateHash &candidate_hash,
+      PerCandidate &candidate_data,
+      size_t bytes) {
+    if (not candidate_data.hot_position) {
+      candidate_data.hot_position =
+          state.hot_order_.emplace(state.hot_order_.end(), candidate_hash);
+    }
+    candidate_data.bytes += bytes;
+    state.hot_bytes_ += bytes;
+  }
+
+  void AvailabilityStoreImpl::erase_hot_no_lock(
+      State &state,
+      std::unordered_map<CandidateHash, PerCandidate>::iterator it) {
+    // candidate must be readable from database after it leaves memory
+    flush_no_lock(state);
+    if (it->second.hot_position) {
+      state.hot_order_.erase(*it->second.hot_position);
+    }
+    state.hot_bytes_ -= it->second.bytes;
+    state.per_candidate_.erase(it);
+  }
+
+  void AvailabilityStoreImpl::evict_no_lock(State &state) {
+    if (state.hot_bytes_ <= hot_budget_) {
+      metric_hot_bytes->set(state.hot_bytes_);
+      return;
+    }
+    while (state.hot_bytes_ > hot_budget_ and not state.hot_order_.empty()) {
+      auto candidate_hash = state.hot_order_.front();
+      auto it = state.per_candidate_.find(candidate_hash);
+      BOOST_ASSERT(it != state.per_candidate_.end());
+      erase_hot_no_lock(state, it);
+      metric_evicted->inc();
+      SL_TRACE(logger, "Candidate {} evicted from memory", candidate_hash);
+    }
+    metric_hot_bytes->set(state.hot_bytes_);
+  }
+
+  void AvailabilityStoreImpl::enqueue_write_no_lock(State &state,
+                                                    common::Buffer key,
+                                                    common::Buffer value) {
+    if (state.pending_writes_.empty()) {
+      state.pending_since_ = steady_clock_.nowUint64();
+    }
+    state.pending_bytes_ += key.size() + value.size();
+    state.pending_writes_.emplace_back(
+        PendingWrite{std::move(key), std::move(value)});
+    if (state.flush_scheduled_) {
+      return;
+    }
+    // quiet node gets no more writes, which would check age of queue
+    state.flush_scheduled_ = true;
+    scheduler_->schedule(
+        [weak{weak_from_this()}] {
+          auto self = weak.lock();
+          if (not self) {
+            return;
+          }
+          self->state_.exclusiveAccess([&](auto &state) {
+            state.flush_scheduled_ = false;
+            self->flush_no_lock(state);
+          });
+        },
+        std::chrono::seconds{kMaxPendingAge});
+  }
+
+  void AvailabilityStoreImpl::maybe_flush_no_lock(State &state) {
+    if (state.pending_writes_.size() >= kMaxPendingWrites
+        or state.pending_bytes_ >= kMaxPendingBytes
+        or state.pending_since_ + kMaxPendingAge < steady_clock_.nowUint64()) {
+      flush_no_lock(state);
+    }
+    metric_pending_bytes->set(state.pending_bytes_);
+  }
+
+  void AvailabilityStoreImpl::flush_no_lock(State &state) {
+    if (state.pending_writes_.empty()) {
+      return;
+    }
+    auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
+    if (not space) {
+      SL_ERROR(logger, "Failed to get AvaliabilityStorage space");
+      return;
+    }
+    auto batch = space->batch();
+    size_t value_bytes = 0;
+    for (auto &write : state.pending_writes_) {
+      value_bytes += write.value.size();
+      if (auto res = batch->put(write.key, std::move(write.value)); not res) {
+        SL_ERROR(logger,
+                 "Failed to put {} into batch error {}",
+                 write.key.toHex(),
+                 res.error());
+      }
+    }
+    if (auto res = batch->commit(); not res) {
+      SL_ERROR(logger,
+               "Failed to commit {} availability entries error {}",
+               state.pending_writes_.size(),
+               res.error());
+    } else {
+      SL_TRACE(logger,
+               "Committed {} availability entries",
+               state.pending_writes_.size());
+      metric_db_writes->inc(state.pending_writes_.size());
+      metric_db_batches->inc();
+      metric_cold_bytes->inc(value_bytes);
+    }
+    state.pending_writes_.clear();
+    state.pending_bytes_ = 0;
+    metric_pending_bytes->set(0);
   }
 
   void AvailabilityStoreImpl::storeData(const network::RelayHash &relay_parent,
@@ -265,6 +565,7 @@ namespace kagome::parachain {
       prune_candidates_no_lock(state);
       state.candidates_[relay_parent].insert(candidate_hash);
       auto &candidate_data = state.per_candidate_[candidate_hash];
+      size_t bytes = 0;
       for (auto &&chunk : std::move(chunks)) {
         auto encoded_chunk = scale::encode(chunk);
         const auto chunk_index = chunk.index;
@@ -275,31 +576,33 @@ namespace kagome::parachain {
                    encoded_chunk.error());
           continue;
         }
-        auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
-        if (not space) {
-          SL_ERROR(logger, "Failed to get space");
-          continue;
-        }
-        if (auto res = space->put(
-                CandidateChunkKey::encode(candidate_hash, chunk_index),
-                std::move(encoded_chunk.value()));
-            not res) {
-          SL_ERROR(logger,
-                   "Failed to put chunk candidate {} index {} error {}",
-                   candidate_hash,
-                   chunk_index,
-                   res.error());
-        } else {
-          SL_TRACE(logger,
-                   "Chunk {}:{} is saved by storeData()",
-                   candidate_hash,
-                   chunk.index);
-        }
+        bytes += encoded_chunk.value().size();
+        enqueue_write_no_lock(
+            state,
+            common::Buffer{CandidateChunkKey::encode(candidate_hash,
+                                                     chunk_index)},
+            common::Buffer{std::move(encoded_chunk.value())});
       }
       candidate_data.pov = pov;
       candidate_data.data = data;
+      if (auto encoded_data = scale::encode(AvailableData{pov, data});
+          encoded_data) {
+        bytes += encoded_data.value().size();
+        enqueue_write_no_lock(
+            state,
+            common::Buffer{CandidateChunkKey::encode_data(candidate_hash)},
+            common::Buffer{std::move(encoded_data.value())});
+      } else {
+        SL_ERROR(logger,
+                 "Failed to encode data of candidate {}, error: {}",
+                 candidate_hash,
+                 encoded_data.error());
+      }
+      account_hot_no_lock(state, candidate_hash, candidate_data, bytes);
       state.candidates_living_keeper_.emplace_back(steady_clock_.nowUint64(),
                                                    relay_parent);
+      maybe_flush_no_lock(state);
+      evict_no_lock(state);
     });
   }
 
@@ -309,42 +612,86 @@ namespace kagome::parachain {
     SL_TRACE(logger, "Attempt to put chunk {}:{}", candidate_hash, chunk.index);
 
     auto encoded_chunk = scale::encode(chunk);
+    if (not encoded_chunk) {
+      SL_ERROR(
+          logger, "Failed to encode chunk, error: {}", encoded_chunk.error());
+    }
     const auto chunk_index = chunk.index;
     state_.exclusiveAccess([&](auto &state) {
       prune_candidates_no_lock(state);
       state.candidates_[relay_parent].insert(candidate_hash);
-      state.per_candidate_[candidate_hash].chunks[chunk.index] =
-          std::move(chunk);
+      auto &candidate_data = state.per_candidate_[candidate_hash];
+      candidate_data.chunks[chunk_index] = std::move(chunk);
       state.candidates_living_keeper_.emplace_back(steady_clock_.nowUint64(),
                                                    relay_parent);
+      account_hot_no_lock(
+          state,
+          candidate_hash,
+          candidate_data,
+          encoded_chunk ? encoded_chunk.value().size() : size_t{0});
+      if (not encoded_chunk) {
+        return;
+      }
+      enqueue_write_no_lock(
+          state,
+          common::Buffer{CandidateChunkKey::encode(candidate_hash,
+                                                   chunk_index)},
+          common::Buffer{std::move(encoded_chunk.value())});
+      maybe_flush_no_lock(state);
+      evict_no_lock(state);
     });
-    if (not encoded_chunk) {
-      SL_ERROR(
-          logger, "Failed to encode chunk, error: {}", encoded_chunk.error());
-      return;
-    }
 
+    SL_TRACE(logger,
+             "Chunk {}:{} is saved by putChunk()",
+             candidate_hash,
+             chunk_index);
+  }
+
+  void AvailabilityStoreImpl::remove_persisted_no_lock(
+      const CandidateHash &candidate_hash) {
     auto space = storage_->getSpace(storage::Space::kAvaliabilityStorage);
     if (not space) {
       SL_ERROR(logger, "Failed to get AvaliabilityStorage space");
       return;
     }
-
-    if (auto res =
-            space->put(CandidateChunkKey::encode(candidate_hash, chunk_index),
-                       std::move(encoded_chunk.value()));
-        not res) {
+    auto cursor = space->cursor();
+    const auto prefix = CandidateChunkKey::encode_hash(candidate_hash);
+    auto seek_res = cursor->seek(prefix);
+    if (not seek_res) {
+      SL_ERROR(logger,
+               "Failed to seek for candidate {} error: {}",
+               candidate_hash,
+               seek_res.error());
+      return;
+    }
+    auto batch = space->batch();
+    size_t removed_bytes = 0;
+    while (cursor->isValid()) {
+      auto key = cursor->key();
+      if (not key or not startsWith(*key, prefix)) {
+        break;
+      }
+      if (auto value = cursor->value()) {
+        removed_bytes += value->size();
+      }
+      if (auto res = batch->remove(*key); not res) {
+        SL_ERROR(logger,
+                 "Failed to remove {} error {}",
+                 key->toHex(),
+                 res.error());
+      }
+      if (not cursor->next()) {
+        break;
+      }
+    }
+    if (auto res = batch->commit(); not res) {
       SL_ERROR(logger,
-               "Failed to put chunk candidate {} index {} error {}",
+               "Failed to remove persisted candidate {} error {}",
                candidate_hash,
-               chunk_index,
                res.error());
+      return;
     }
-
-    SL_TRACE(logger,
-             "Chunk {}:{} is saved by putChunk()",
-             candidate_hash,
-             chunk.index);
+    metric_cold_bytes->dec(removed_bytes);
   }
 
   void AvailabilityStoreImpl::remove_no_lock(
@@ -352,9 +699,15 @@ namespace kagome::parachain {
     if (auto it = state.candidates_.find(relay_parent);
         it != state.candidates_.end()) {
       for (const auto &l : it->second) {
-        state.per_candidate_.erase(l);
+        if (auto it2 = state.per_candidate_.find(l);
+            it2 != state.per_candidate_.end()) {
+          erase_hot_no_lock(state, it2);
+        }
       }
+      state.persisted_living_keeper_.emplace_back(steady_clock_.nowUint64(),
+                                                  std::move(it->second));
       state.candidates_.erase(it);
+      metric_hot_bytes->set(state.hot_bytes_);
     }
   }
 
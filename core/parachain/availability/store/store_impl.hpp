@@ -8,8 +8,14 @@
 
 #include "parachain/availability/store/store.hpp"
 
+#include <deque>
+#include <list>
 #include <unordered_map>
 #include <unordered_set>
+
+#include <libp2p/basic/scheduler.hpp>
+
+#include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
 #include "log/logger.hpp"
 #include "primitives/event_types.hpp"
@@ -17,18 +23,30 @@
 #include "utils/safe_object.hpp"
 
 namespace kagome::parachain {
+  /**
+   * Two-tier availability store.
+   * Hot tier keeps recently stored chunks, PoVs and PVDs in memory bounded by
+   * configured byte budget. Every stored item is also queued for write-behind
+   * into database (cold tier), pending writes are committed as one batch,
+   * at latest `kMaxPendingAge` after first of them was queued.
+   * Pending writes are committed before any candidate leaves hot tier, so
+   * candidates removed from memory are served from database.
+   */
   class AvailabilityStoreImpl
       : public AvailabilityStore,
         public std::enable_shared_from_this<AvailabilityStoreImpl> {
    public:
     AvailabilityStoreImpl(
         std::shared_ptr<application::AppStateManager> app_state_manager,
+        const application::AppConfiguration &app_config,
         clock::SteadyClock &steady_clock,
+        std::shared_ptr<libp2p::basic::Scheduler> scheduler,
         std::shared_ptr<storage::SpacedStorage> storage,
         primitives::events::ChainSubscriptionEnginePtr chain_sub_engine);
     ~AvailabilityStoreImpl() override = default;
 
     bool start();
+    void stop();
 
     bool hasChunk(const CandidateHash &candidate_hash,
                   ValidatorIndex index) const override;
@@ -58,6 +76,15 @@ namespace kagome::parachain {
       std::unordered_map<ValidatorIndex, ErasureChunk> chunks{};
       std::optional<ParachainBlock> pov{};
       std::optional<PersistedValidationData> data{};
+      /// bytes accounted to hot tier budget
+      size_t bytes = 0;
+      /// position in `State::hot_order_`
+      std::optional<std::list<CandidateHash>::iterator> hot_position{};
+    };
+
+    struct PendingWrite {
+      common::Buffer key;
+      common::Buffer value;
     };
 
     struct State {
@@ -66,15 +93,61 @@ namespace kagome::parachain {
           candidates_{};
       std::deque<std::pair<uint64_t, network::RelayHash>>
           candidates_living_keeper_;
+      /// candidates removed from memory, whose persisted data is pruned later
+      std::deque<std::pair<uint64_t, std::unordered_set<CandidateHash>>>
+          persisted_living_keeper_;
+      /// candidates in order of insertion into hot tier, used for eviction.
+      /// Contains exactly candidates of `per_candidate_`.
+      std::list<CandidateHash> hot_order_;
+      size_t hot_bytes_ = 0;
+      /// write-behind queue
+      std::vector<PendingWrite> pending_writes_;
+      size_t pending_bytes_ = 0;
+      uint64_t pending_since_ = 0;
+      /// flush of pending writes is scheduled
+      bool flush_scheduled_ = false;
     };
 
     void prune_candidates_no_lock(State &state);
     void remove_no_lock(State &state, const network::RelayHash &relay_parent);
 
+    /// Accounts `bytes` of candidate to hot tier
+    void account_hot_no_lock(State &state,
+                             const CandidateHash &candidate_hash,
+                             PerCandidate &candidate_data,
+                             size_t bytes);
+    /// Removes candidate from hot tier, flushing pending writes first
+    void erase_hot_no_lock(
+        State &state,
+        std::unordered_map<CandidateHash, PerCandidate>::iterator it);
+    /// Evicts oldest candidates until hot tier fits into budget
+    void evict_no_lock(State &state);
+    /// Queues write, schedules flush of queue if it is not scheduled yet
+    void enqueue_write_no_lock(State &state,
+                               common::Buffer key,
+                               common::Buffer value);
+    /// Flushes write-behind queue if it is too big or too old
+    void maybe_flush_no_lock(State &state);
+    /// Commits write-behind queue as single batch
+    void flush_no_lock(State &state);
+    /// Removes persisted data of candidates which outlived timeout
+    void prune_persisted_no_lock(State &state);
+    /// Removes all persisted entries of candidate with one batch
+    void remove_persisted_no_lock(const CandidateHash &candidate_hash);
+    /// Schedules pruning of candidates persisted before restart
+    void load_persisted_no_lock(State &state);
+
+    std::optional<AvailableData> getPersistedData(
+        const CandidateHash &candidate_hash) const;
+    std::vector<ErasureChunk> getPersistedChunks(
+        const CandidateHash &candidate_hash) const;
+
     log::Logger logger = log::createLogger("AvailabilityStore", "parachain");
     clock::SteadyClock &steady_clock_;
+    std::shared_ptr<libp2p::basic::Scheduler> scheduler_;
     std::shared_ptr<storage::SpacedStorage> storage_;
     primitives::events::ChainSub chain_sub_;
+    const size_t hot_budget_;
     SafeObject<State> state_{};
   };
 }  // namespace kagome::parachain
@@ -112,7 +112,9 @@ namespace kagome::parachain {
               injector.template create<std::shared_ptr<crypto::Hasher>>(),
               injector.template create<std::shared_ptr<crypto::KeyStore>>(),
               injector.template create<std::shared_ptr<offchain::OffchainPersistentStorage>>(),
-              injector.template create<std::shared_ptr<offchain::OffchainWorkerPool>>()
+              injector.template create<std::shared_ptr<offchain::OffchainWorkerPool>>(),
+              // worker process verifies batched signatures on its own thread
+              nullptr
           );
         }),
 
@@ -9,7 +9,7 @@
 #include "application/app_configuration.hpp"
 #include "metrics/histogram_timer.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
-#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "runtime/common/uncompressed_code_cache.hpp"
 
 namespace kagome::parachain {
   namespace {
@@ -47,12 +47,15 @@ namespace kagome::parachain {
 
   PvfPool::PvfPool(const application::AppConfiguration &app_config,
                    std::shared_ptr<runtime::ModuleFactory> module_factory,
-                   std::shared_ptr<runtime::WasmInstrumenter> instrument)
+                   std::shared_ptr<runtime::WasmInstrumenter> instrument,
+                   std::shared_ptr<runtime::RuntimeArtifactStore> artifacts,
+                   std::shared_ptr<runtime::UncompressedCodeCache> code_cache)
       : pool_{std::make_shared<runtime::RuntimeInstancesPoolImpl>(
-          app_config,
           std::move(module_factory),
           std::move(instrument),
-          app_config.parachainRuntimeInstanceCacheSize())} {}
+          std::move(artifacts),
+          app_config.parachainRuntimeInstanceCacheSize())},
+        code_cache_{std::move(code_cache)} {}
 
   outcome::result<void> PvfPool::precompile(
       const Hash256 &code_hash,
@@ -62,10 +65,10 @@ namespace kagome::parachain {
     return pool_->precompile(
         code_hash,
         [&]() mutable -> runtime::RuntimeCodeProvider::Result {
-          OUTCOME_TRY(code, runtime::uncompressCodeIfNeeded(code_zstd));
+          OUTCOME_TRY(code, code_cache_->get(code_hash, code_zstd));
           // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-          metric_code_size.observe(code.size());
-          return std::make_shared<Buffer>(code);
+          metric_code_size.observe(code->size());
+          return std::move(code);
         },
         config);
   }
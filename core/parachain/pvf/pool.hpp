@@ -20,18 +20,24 @@ namespace kagome::runtime {
   class WasmInstrumenter;
   class ModuleFactory;
   class Module;
+  class RuntimeArtifactStore;
   class RuntimeInstancesPoolImpl;
+  class UncompressedCodeCache;
 }  // namespace kagome::runtime
 
 namespace kagome::parachain {
   /**
    * Reused by `PvfPrecheck` and `PvfImpl` to measure pvf compile time metric.
+   * Shares artifact store (and loaded modules) and uncompressed code with
+   * relay runtime.
    */
   class PvfPool {
    public:
     PvfPool(const application::AppConfiguration &app_config,
             std::shared_ptr<runtime::ModuleFactory> module_factory,
-            std::shared_ptr<runtime::WasmInstrumenter> instrument);
+            std::shared_ptr<runtime::WasmInstrumenter> instrument,
+            std::shared_ptr<runtime::RuntimeArtifactStore> artifacts,
+            std::shared_ptr<runtime::UncompressedCodeCache> code_cache);
 
     std::optional<std::shared_ptr<const runtime::Module>> getModule(
         const Hash256 &code_hash,
@@ -44,6 +50,7 @@ namespace kagome::parachain {
     /**
      * Measures `kagome_parachain_candidate_validation_code_size` and
      * `kagome_pvf_preparation_time` metrics.
+     * Code is uncompressed only if module is not compiled yet.
      */
     outcome::result<void> precompile(
         const Hash256 &code_hash,
@@ -52,5 +59,6 @@ namespace kagome::parachain {
 
    private:
     std::shared_ptr<runtime::RuntimeInstancesPoolImpl> pool_;
+    std::shared_ptr<runtime::UncompressedCodeCache> code_cache_;
   };
 }  // namespace kagome::parachain
@@ -114,6 +114,7 @@ namespace kagome::parachain::statement_distribution {
       std::shared_ptr<NetworkBridge> _network_bridge,
       std::shared_ptr<network::Router> _router,
       common::MainThreadPool &main_thread_pool,
+      common::WorkerThreadPool &worker_thread_pool,
       std::shared_ptr<crypto::Hasher> _hasher,
       std::shared_ptr<crypto::Sr25519Provider> _crypto_provider,
       std::shared_ptr<network::PeerView> _peer_view,
@@ -141,6 +142,11 @@ namespace kagome::parachain::statement_distribution {
         prospective_parachains(_prospective_parachains),
         parachain_host(_parachain_host),
         crypto_provider(std::move(_crypto_provider)),
+        signature_verifier(std::make_shared<crypto::Sr25519BatchVerifier>(
+            crypto_provider,
+            statements_distribution_thread_pool.io_context(),
+            worker_thread_pool.handler(*app_state_manager),
+            crypto::Sr25519BatchVerifier::Config{})),
         peer_view(_peer_view),
         block_tree(_block_tree),
         slots_util(_slots_util),
@@ -164,6 +170,7 @@ namespace kagome::parachain::statement_distribution {
     BOOST_ASSERT(prospective_parachains);
     BOOST_ASSERT(parachain_host);
     BOOST_ASSERT(crypto_provider);
+    BOOST_ASSERT(signature_verifier);
     BOOST_ASSERT(peer_view);
     BOOST_ASSERT(block_tree);
     BOOST_ASSERT(babe_config_repo);
@@ -1997,8 +2004,6 @@ namespace kagome::parachain::statement_distribution {
       SL_ERROR(logger, "Reject outgoing error.");
       return Error::CLUSTER_TRACKER_ERROR;
     }
-    OUTCOME_TRY(check_statement_signature(
-        session, session_info.validators, relay_parent, statement));
 
     cluster_tracker.note_received(
         cluster_sender_index,
@@ -2011,70 +2016,39 @@ namespace kagome::parachain::statement_distribution {
     return std::nullopt;
   }
 
-  void StatementDistribution::handle_incoming_statement(
+  std::optional<StatementDistribution::IncomingStatementSender>
+  StatementDistribution::check_incoming_statement(
       const libp2p::peer::PeerId &peer_id,
-      const network::vstaging::StatementDistributionMessageStatement &stm) {
-    REINVOKE(*statements_distribution_thread_handler,
-             handle_incoming_statement,
-             peer_id,
-             stm);
-
-    visit_in_place(
-        getPayload(stm.compact).inner_value,
-        [&](const network::vstaging::SecondedCandidateHash &seconded) {
-          SL_TRACE(logger,
-                   "StatementDistributionMessageStatement seconded. "
-                   "(relay_parent={}, "
-                   "candidate_hash={})",
-                   stm.relay_parent,
-                   seconded.hash);
-        },
-        [&](const network::vstaging::ValidCandidateHash &valid) {
-          SL_TRACE(
-              logger,
-              "StatementDistributionMessageStatement valid. (relay_parent={}, "
-              "candidate_hash={})",
-              stm.relay_parent,
-              valid.hash);
-        },
-        [&](const auto &) {
-          SL_TRACE(logger, "StatementDistributionMessageStatement OTHER.");
-        });
-
-    auto parachain_state = tryGetStateByRelayParent(stm.relay_parent);
-    if (!parachain_state) {
-      SL_TRACE(logger,
-               "After request pov no parachain state on relay_parent. (relay "
-               "parent={})",
-               stm.relay_parent);
-      return;
-    }
+      const network::vstaging::StatementDistributionMessageStatement &stm,
+      PerRelayParentState &parachain_state) {
+    BOOST_ASSERT(statements_distribution_thread_handler->isInCurrentThread());
 
     const auto &session_info =
-        parachain_state->get().per_session_state->value().session_info;
-    if (parachain_state->get().is_disabled(stm.compact.payload.ix)) {
+        parachain_state.per_session_state->value().session_info;
+    if (parachain_state.is_disabled(stm.compact.payload.ix)) {
       SL_TRACE(
           logger,
           "Ignoring a statement from disabled validator. (relay parent={}, "
           "validator={})",
           stm.relay_parent,
           stm.compact.payload.ix);
-      return;
+      return std::nullopt;
     }
 
-    CHECK_OR_RET(parachain_state->get().local_validator);
-    auto &local_validator = *parachain_state->get().local_validator;
+    if (not parachain_state.local_validator) {
+      return std::nullopt;
+    }
+    auto &local_validator = *parachain_state.local_validator;
     auto originator_group =
-        parachain_state->get()
-            .per_session_state->value()
-            .groups.byValidatorIndex(stm.compact.payload.ix);
+        parachain_state.per_session_state->value().groups.byValidatorIndex(
+            stm.compact.payload.ix);
     if (!originator_group) {
       SL_TRACE(logger,
                "No correct validator index in statement. (relay parent={}, "
                "validator={})",
                stm.relay_parent,
                stm.compact.payload.ix);
-      return;
+      return std::nullopt;
     }
 
     auto &active = local_validator.active;
@@ -2112,45 +2086,177 @@ namespace kagome::parachain::statement_distribution {
     }();
 
     if (active && cluster_sender_index) {
-      if (handle_cluster_statement(
-              stm.relay_parent,
-              active->cluster_tracker,
-              parachain_state->get().per_session_state->value().session,
-              parachain_state->get().per_session_state->value().session_info,
-              stm.compact,
-              *cluster_sender_index)
-              .has_error()) {
-        return;
+      const auto accept = active->cluster_tracker.can_receive(
+          *cluster_sender_index,
+          stm.compact.payload.ix,
+          network::vstaging::from(getPayload(stm.compact)));
+      if (accept != outcome::success(Accept::Ok)
+          && accept != outcome::success(Accept::WithPrejudice)) {
+        SL_TRACE(logger,
+                 "Cluster statement rejected. (relay parent={}, "
+                 "validator={}, peer={})",
+                 stm.relay_parent,
+                 stm.compact.payload.ix,
+                 peer_id);
+        return std::nullopt;
       }
-    } else {
-      std::optional<std::pair<ValidatorIndex, bool>> grid_sender_index;
-      for (const auto &[i, validator_knows_statement] :
-           local_validator.grid_tracker.direct_statement_providers(
-               parachain_state->get().per_session_state->value().groups,
-               stm.compact.payload.ix,
-               getPayload(stm.compact))) {
-        if (i >= session_info.discovery_keys.size()) {
-          continue;
-        }
-
-        /// TODO(iceseer): do check is authority
-        /// const auto &ad = opt_session_info->discovery_keys[i];
-        grid_sender_index.emplace(i, validator_knows_statement);
-        break;
+      return IncomingStatementSender{
+          .index = *cluster_sender_index,
+          .cluster = true,
+          .originator_group = *originator_group,
+      };
+    }
+
+    std::optional<std::pair<ValidatorIndex, bool>> grid_sender_index;
+    for (const auto &[i, validator_knows_statement] :
+         local_validator.grid_tracker.direct_statement_providers(
+             parachain_state.per_session_state->value().groups,
+             stm.compact.payload.ix,
+             getPayload(stm.compact))) {
+      if (i >= session_info.discovery_keys.size()) {
+        continue;
       }
 
-      CHECK_OR_RET(grid_sender_index);
-      const auto &[gsi, validator_knows_statement] = *grid_sender_index;
+      /// TODO(iceseer): do check is authority
+      /// const auto &ad = opt_session_info->discovery_keys[i];
+      grid_sender_index.emplace(i, validator_knows_statement);
+      break;
+    }
+
+    if (not grid_sender_index) {
+      return std::nullopt;
+    }
+    const auto &[gsi, validator_knows_statement] = *grid_sender_index;
+    if (validator_knows_statement) {
+      return std::nullopt;
+    }
+    return IncomingStatementSender{
+        .index = gsi,
+        .cluster = false,
+        .originator_group = *originator_group,
+    };
+  }
+
+  void StatementDistribution::handle_incoming_statement(
+      const libp2p::peer::PeerId &peer_id,
+      const network::vstaging::StatementDistributionMessageStatement &stm) {
+    REINVOKE(*statements_distribution_thread_handler,
+             handle_incoming_statement,
+             peer_id,
+             stm);
+
+    auto parachain_state = tryGetStateByRelayParent(stm.relay_parent);
+    if (!parachain_state) {
+      SL_TRACE(logger,
+               "No parachain state on relay_parent. (relay parent={})",
+               stm.relay_parent);
+      return;
+    }
+
+    const auto &session_state =
+        parachain_state->get().per_session_state->value();
+    const auto &validators = session_state.session_info.validators;
+    if (stm.compact.payload.ix >= validators.size()) {
+      SL_TRACE(logger,
+               "Statement validator index out of bound. (relay parent={}, "
+               "validator={})",
+               stm.relay_parent,
+               stm.compact.payload.ix);
+      return;
+    }
+
+    // drop statement before expensive signature check
+    if (not check_incoming_statement(peer_id, stm, parachain_state->get())) {
+      return;
+    }
+
+    // signing context is built from known session to avoid runtime call
+    const SigningContext signing_context{
+        .session_index = session_state.session,
+        .relay_parent = stm.relay_parent,
+    };
+    signature_verifier->push(
+        stm.compact.signature,
+        common::Buffer{
+            signing_context.signable(*hasher, getPayload(stm.compact))},
+        validators[stm.compact.payload.ix],
+        [WEAK_SELF, peer_id, stm](bool valid) {
+          WEAK_LOCK(self);
+          if (not valid) {
+            SL_WARN(self->logger,
+                    "Incorrect statement signature. (relay parent={}, "
+                    "validator={}, peer={})",
+                    stm.relay_parent,
+                    stm.compact.payload.ix,
+                    peer_id);
+            return;
+          }
+          self->handle_verified_statement(peer_id, stm);
+        });
+  }
+
+  void StatementDistribution::handle_verified_statement(
+      const libp2p::peer::PeerId &peer_id,
+      const network::vstaging::StatementDistributionMessageStatement &stm) {
+    BOOST_ASSERT(statements_distribution_thread_handler->isInCurrentThread());
+
+    visit_in_place(
+        getPayload(stm.compact).inner_value,
+        [&](const network::vstaging::SecondedCandidateHash &seconded) {
+          SL_TRACE(logger,
+                   "StatementDistributionMessageStatement seconded. "
+                   "(relay_parent={}, "
+                   "candidate_hash={})",
+                   stm.relay_parent,
+                   seconded.hash);
+        },
+        [&](const network::vstaging::ValidCandidateHash &valid) {
+          SL_TRACE(
+              logger,
+              "StatementDistributionMessageStatement valid. (relay_parent={}, "
+              "candidate_hash={})",
+              stm.relay_parent,
+              valid.hash);
+        },
+        [&](const auto &) {
+          SL_TRACE(logger, "StatementDistributionMessageStatement OTHER.");
+        });
+
+    auto parachain_state = tryGetStateByRelayParent(stm.relay_parent);
+    if (!parachain_state) {
+      SL_TRACE(logger,
+               "After request pov no parachain state on relay_parent. (relay "
+               "parent={})",
+               stm.relay_parent);
+      return;
+    }
+
+    auto sender =
+        check_incoming_statement(peer_id, stm, parachain_state->get());
+    CHECK_OR_RET(sender);
+    const auto &session_info =
+        parachain_state->get().per_session_state->value().session_info;
+    auto &local_validator = *parachain_state->get().local_validator;
+    const auto &originator_group = sender->originator_group;
 
-      CHECK_OR_RET(!validator_knows_statement);
-      if (handle_grid_statement(stm.relay_parent,
-                                parachain_state->get(),
-                                local_validator.grid_tracker,
-                                stm.compact,
-                                gsi)
+    if (sender->cluster) {
+      if (handle_cluster_statement(
+              stm.relay_parent,
+              local_validator.active->cluster_tracker,
+              parachain_state->get().per_session_state->value().session,
+              session_info,
+              stm.compact,
+              sender->index)
               .has_error()) {
         return;
       }
+    } else if (handle_grid_statement(stm.relay_parent,
+                                     parachain_state->get(),
+                                     local_validator.grid_tracker,
+                                     stm.compact,
+                                     sender->index)
+                   .has_error()) {
+      return;
     }
 
     const auto &statement = getPayload(stm.compact);
@@ -2159,24 +2265,21 @@ namespace kagome::parachain::statement_distribution {
     const bool res = candidates.insert_unconfirmed(peer_id,
                                                    candidate_hash,
                                                    stm.relay_parent,
-                                                   *originator_group,
+                                                   originator_group,
                                                    std::nullopt);
     CHECK_OR_RET(res);
     const auto confirmed = candidates.get_confirmed(candidate_hash);
     const auto is_confirmed = candidates.is_confirmed(candidate_hash);
-    const auto &group = session_info.validator_groups[*originator_group];
+    const auto &group = session_info.validator_groups[originator_group];
 
     if (!is_confirmed) {
       request_attested_candidate(peer_id,
                                  parachain_state->get(),
                                  stm.relay_parent,
                                  candidate_hash,
-                                 *originator_group);
+                                 originator_group);
     }
 
-    /// TODO(iceseer): do https://github.com/qdrvm/kagome/issues/1888
-    /// check statement signature
-
     const auto was_fresh_opt = parachain_state->get().statement_store.insert(
         parachain_state->get().per_session_state->value().groups,
         stm.compact,
@@ -2218,27 +2321,6 @@ namespace kagome::parachain::statement_distribution {
     circulate_statement(stm.relay_parent, parachain_state->get(), stm.compact);
   }
 
-  outcome::result<
-      std::reference_wrapper<const network::vstaging::SignedCompactStatement>>
-  StatementDistribution::check_statement_signature(
-      SessionIndex session_index,
-      const std::vector<ValidatorId> &validators,
-      const RelayHash &relay_parent,
-      const network::vstaging::SignedCompactStatement &statement) {
-    OUTCOME_TRY(signing_context,
-                SigningContext::make(parachain_host, relay_parent));
-    OUTCOME_TRY(verified,
-                crypto_provider->verify(
-                    statement.signature,
-                    signing_context.signable(*hasher, getPayload(statement)),
-                    validators[statement.payload.ix]));
-
-    if (!verified) {
-      return Error::INCORRECT_SIGNATURE;
-    }
-    return std::cref(statement);
-  }
-
   void StatementDistribution::circulate_statement(
       const RelayHash &relay_parent,
       PerRelayParentState &relay_parent_state,
@@ -10,9 +10,11 @@
 #include <parachain/validator/statement_distribution/per_relay_parent_state.hpp>
 #include "authority_discovery/query/query.hpp"
 #include "common/ref_cache.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "consensus/babe/babe_config_repository.hpp"
 #include "consensus/babe/impl/babe_digests_util.hpp"
 #include "consensus/timeline/slots_util.hpp"
+#include "crypto/sr25519/sr25519_batch_verifier.hpp"
 #include "network/can_disconnect.hpp"
 #include "network/peer_manager.hpp"
 #include "network/peer_view.hpp"
@@ -81,6 +83,7 @@ namespace kagome::parachain::statement_distribution {
         std::shared_ptr<NetworkBridge> network_bridge,
         std::shared_ptr<network::Router> router,
         common::MainThreadPool &main_thread_pool,
+        common::WorkerThreadPool &worker_thread_pool,
         std::shared_ptr<crypto::Hasher> hasher,
         std::shared_ptr<crypto::Sr25519Provider> crypto_provider,
         std::shared_ptr<network::PeerView> peer_view,
@@ -221,17 +224,30 @@ namespace kagome::parachain::statement_distribution {
         PerRelayParentState &relay_parent_state,
         const IndexedAndSigned<network::vstaging::CompactStatement> &statement);
 
-    outcome::result<
-        std::reference_wrapper<const network::vstaging::SignedCompactStatement>>
-    check_statement_signature(
-        SessionIndex session_index,
-        const std::vector<ValidatorId> &validators,
-        const RelayHash &relay_parent,
-        const network::vstaging::SignedCompactStatement &statement);
+    /// Sender of incoming statement in cluster or grid topology
+    struct IncomingStatementSender {
+      ValidatorIndex index;
+      bool cluster;
+      GroupIndex originator_group;
+    };
+
+    /// Cheap checks of incoming statement, done before signature check and
+    /// repeated after it, because state may change while signature is
+    /// verified. Doesn't change state.
+    /// @return sender, or nullopt if statement must be dropped
+    std::optional<IncomingStatementSender> check_incoming_statement(
+        const libp2p::peer::PeerId &peer_id,
+        const network::vstaging::StatementDistributionMessageStatement &stm,
+        PerRelayParentState &parachain_state);
+
+    /// Handles incoming statement, which signature is already verified
+    void handle_verified_statement(
+        const libp2p::peer::PeerId &peer_id,
+        const network::vstaging::StatementDistributionMessageStatement &stm);
 
-    /// Checks whether a statement is allowed, whether the signature is
-    /// accurate,
+    /// Checks whether a statement is allowed
     /// and importing into the cluster tracker if successful.
+    /// Signature is verified in batch before.
     ///
     /// if successful, this returns a checked signed statement if it should be
     /// imported or otherwise an error indicating a reputational fault.
@@ -372,6 +388,7 @@ namespace kagome::parachain::statement_distribution {
     std::shared_ptr<ProspectiveParachains> prospective_parachains;
     std::shared_ptr<runtime::ParachainHost> parachain_host;
     std::shared_ptr<crypto::Sr25519Provider> crypto_provider;
+    std::shared_ptr<crypto::Sr25519BatchVerifier> signature_verifier;
     std::shared_ptr<network::PeerView> peer_view;
     std::shared_ptr<blockchain::BlockTree> block_tree;
     LazySPtr<consensus::SlotsUtil> slots_util;
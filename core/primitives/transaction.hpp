@@ -11,6 +11,29 @@
 
 namespace kagome::primitives {
 
+  enum class TransactionSource : uint8_t {
+    /// Transaction is already included in block.
+    ///
+    /// This means that we can't really tell where the transaction is coming
+    /// from, since it's already in the received block. Note that the custom
+    /// validation logic using either `Local` or `External` should most likely
+    /// just allow `InBlock` transactions as well.
+    InBlock,
+
+    /// Transaction is coming from a local source.
+    ///
+    /// This means that the transaction was produced internally by the node
+    /// (for instance an Off-Chain Worker, or an Off-Chain Call), as opposed
+    /// to being received over the network.
+    Local,
+
+    /// Transaction has been received externally.
+    ///
+    /// This means the transaction has been received from (usually) "untrusted"
+    /// source, for instance received over the network or RPC.
+    External,
+  };
+
   struct Transaction {
     /// Hash of tx
     using Hash = common::Hash256;
@@ -34,6 +57,7 @@ namespace kagome::primitives {
     Extrinsic ext{};
 
     /// Number of bytes encoding of the transaction requires.
+    /// Cached on construction, so block authoring does not re-encode `ext`.
     size_t bytes{};
 
     /// Extrinsic hash (non-unique)
@@ -56,14 +80,37 @@ namespace kagome::primitives {
 
     /// Should that transaction be propagated.
     bool should_propagate{false};
+
+    /// Where transaction came from, used again when it is revalidated.
+    TransactionSource source{TransactionSource::External};
   };
 
+  /// @return size of SCALE encoded extrinsic: compact length and data
+  inline size_t encodedSize(const Extrinsic &ext) {
+    auto size = ext.data.size();
+    if (size < (1ull << 6)) {
+      return 1 + size;
+    }
+    if (size < (1ull << 14)) {
+      return 2 + size;
+    }
+    if (size < (1ull << 30)) {
+      return 4 + size;
+    }
+    size_t length_bytes = 0;
+    for (auto value = size; value != 0; value >>= 8) {
+      ++length_bytes;
+    }
+    return 1 + length_bytes + size;
+  }
+
   inline bool operator==(const Transaction &v1, const Transaction &v2) {
     return v1.ext == v2.ext && v1.bytes == v2.bytes && v1.hash == v2.hash
         && v1.priority == v2.priority && v1.valid_till == v2.valid_till
         && v1.required_tags == v2.required_tags
         && v1.provided_tags == v2.provided_tags
-        && v1.should_propagate == v2.should_propagate;
+        && v1.should_propagate == v2.should_propagate
+        && v1.source == v2.source;
   }
 
 }  // namespace kagome::primitives
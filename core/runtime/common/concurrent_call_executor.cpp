@@ -0,0 +1,171 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/concurrent_call_executor.hpp"
+
+#include <thread>
+
+#include <boost/assert.hpp>
+
+#include "application/app_configuration.hpp"
+#include "blockchain/block_header_repository.hpp"
+#include "metrics/histogram_timer.hpp"
+#include "runtime/module_instance.hpp"
+#include "runtime/module_repository.hpp"
+#include "runtime/runtime_context.hpp"
+#include "storage/trie/impl/shared_trie_batch_impl.hpp"
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::runtime, ConcurrentCallExecutor::Error, e) {
+  using E = kagome::runtime::ConcurrentCallExecutor::Error;
+  switch (e) {
+    case E::BUSY:
+      return "Too many runtime calls in progress, try again later";
+  }
+  return "Unknown ConcurrentCallExecutor error";
+}
+
+namespace kagome::runtime {
+  namespace {
+    auto &metric_rejected() {
+      static metrics::CounterHelper metric{
+          "kagome_rpc_runtime_calls_rejected",
+          "Number of state_call RPC rejected over runtime call budget",
+      };
+      return metric;
+    }
+
+    auto &metric_running_cost() {
+      static metrics::GaugeHelper metric{
+          "kagome_rpc_runtime_calls_cost",
+          "Estimated cost of running state_call RPC in microseconds",
+      };
+      return metric;
+    }
+
+    ConcurrentCallExecutor::Cost defaultBudget() {
+      return std::chrono::seconds{
+          std::max<uint32_t>(std::thread::hardware_concurrency(), 1)};
+    }
+  }  // namespace
+
+  ConcurrentCallExecutor::ConcurrentCallExecutor(
+      std::shared_ptr<ModuleRepository> module_repo,
+      std::shared_ptr<RuntimeContextFactory> ctx_factory,
+      std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<storage::trie::Codec> codec,
+      std::shared_ptr<storage::trie::TrieSerializer> serializer,
+      Cost budget)
+      : module_repo_{std::move(module_repo)},
+        ctx_factory_{std::move(ctx_factory)},
+        header_repo_{std::move(header_repo)},
+        codec_{std::move(codec)},
+        serializer_{std::move(serializer)},
+        budget_{budget},
+        costs_{kMethods},
+        states_{kStates} {
+    BOOST_ASSERT(module_repo_ != nullptr);
+    BOOST_ASSERT(ctx_factory_ != nullptr);
+    BOOST_ASSERT(header_repo_ != nullptr);
+    BOOST_ASSERT(codec_ != nullptr);
+    BOOST_ASSERT(serializer_ != nullptr);
+  }
+
+  ConcurrentCallExecutor::ConcurrentCallExecutor(
+      std::shared_ptr<ModuleRepository> module_repo,
+      std::shared_ptr<RuntimeContextFactory> ctx_factory,
+      std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<storage::trie::Codec> codec,
+      std::shared_ptr<storage::trie::TrieSerializer> serializer,
+      const application::AppConfiguration &app_config)
+      : ConcurrentCallExecutor{
+          std::move(module_repo),
+          std::move(ctx_factory),
+          std::move(header_repo),
+          std::move(codec),
+          std::move(serializer),
+          app_config.rpcCallBudget() != 0
+              ? Cost{std::chrono::milliseconds{app_config.rpcCallBudget()}}
+              : defaultBudget()} {}
+
+  outcome::result<common::Buffer> ConcurrentCallExecutor::call(
+      const primitives::BlockHash &block_hash,
+      std::string_view method,
+      common::BufferView args) {
+    std::unique_lock lock{mutex_};
+    auto cost = costLocked(method);
+    if (running_ != Cost::zero() and running_ + cost > budget_) {
+      metric_rejected()->inc();
+      return Error::BUSY;
+    }
+    running_ += cost;
+    metric_running_cost()->set(static_cast<double>(running_.count()));
+    lock.unlock();
+
+    auto start = std::chrono::steady_clock::now();
+    auto res = [&]() -> outcome::result<common::Buffer> {
+      OUTCOME_TRY(ctx, contextAt(block_hash));
+      return ctx.module_instance->callExportFunction(ctx, method, args);
+    }();
+    auto duration = std::chrono::duration_cast<Cost>(
+        std::chrono::steady_clock::now() - start);
+
+    lock.lock();
+    running_ -= cost;
+    metric_running_cost()->set(static_cast<double>(running_.count()));
+    if (res) {
+      // exponential moving average, adapts to runtime upgrades
+      if (auto average = costs_.get(std::string{method})) {
+        average->get() += (duration - average->get()) / 8;
+      } else {
+        costs_.put(std::string{method}, duration);
+      }
+    }
+    return res;
+  }
+
+  outcome::result<RuntimeContext> ConcurrentCallExecutor::contextAt(
+      const primitives::BlockHash &block_hash) {
+    OUTCOME_TRY(header, header_repo_->getBlockHeader(block_hash));
+    OUTCOME_TRY(state, stateAt(header.state_root));
+    OUTCOME_TRY(instance,
+                module_repo_->getInstanceAt({block_hash, header.number},
+                                            header.state_root));
+    return ctx_factory_->fromBatch(
+        instance,
+        std::make_shared<storage::trie::SharedTrieBatchImpl>(std::move(state)));
+  }
+
+  outcome::result<std::shared_ptr<storage::trie::SharedTrieState>>
+  ConcurrentCallExecutor::stateAt(const storage::trie::RootHash &state) {
+    return SAFE_UNIQUE(states_)
+        ->outcome::result<std::shared_ptr<storage::trie::SharedTrieState>> {
+      if (auto r = states_.get(state)) {
+        return r->get();
+      }
+      OUTCOME_TRY(shared,
+                  storage::trie::SharedTrieState::create(
+                      codec_, serializer_, state));
+      states_.put(state, shared);
+      return shared;
+    };
+  }
+
+  ConcurrentCallExecutor::Cost ConcurrentCallExecutor::cost(
+      std::string_view method) const {
+    std::unique_lock lock{mutex_};
+    return costLocked(method);
+  }
+
+  ConcurrentCallExecutor::Cost ConcurrentCallExecutor::costLocked(
+      std::string_view method) const {
+    auto average = costs_.get(std::string{method});
+    if (not average) {
+      return kDefaultCost;
+    }
+    // at least 1us, so running calls are never free
+    return std::max(average->get(), Cost{1});
+  }
+}  // namespace kagome::runtime
@@ -0,0 +1,133 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#include <boost/di.hpp>
+
+#include "common/buffer.hpp"
+#include "primitives/common.hpp"
+#include "runtime/runtime_context.hpp"
+#include "storage/trie/types.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}  // namespace kagome::application
+
+namespace kagome::blockchain {
+  class BlockHeaderRepository;
+}  // namespace kagome::blockchain
+
+namespace kagome::storage::trie {
+  class Codec;
+  class SharedTrieState;
+  class TrieSerializer;
+}  // namespace kagome::storage::trie
+
+namespace kagome::runtime {
+  class ModuleRepository;
+  class RuntimeContextFactory;
+
+  /**
+   * Executes read-only runtime calls of `state_call` RPC concurrently.
+   * Calls on same block share `SharedTrieState`, so trie nodes are loaded
+   * and decoded once, and each call keeps changes in own overlay.
+   * Cost of call is estimated by average duration of previous calls of same
+   * method. Call is rejected when estimated cost of running calls would
+   * exceed budget, but single call is always admitted.
+   */
+  class ConcurrentCallExecutor {
+   public:
+    enum class Error : uint8_t {
+      BUSY = 1,
+    };
+
+    using Cost = std::chrono::microseconds;
+
+    /// Number of recent states kept shared
+    static constexpr size_t kStates = 4;
+    /// Number of methods with remembered cost
+    static constexpr size_t kMethods = 256;
+    /// Cost of method without previous calls
+    static constexpr Cost kDefaultCost = std::chrono::milliseconds{10};
+
+    ConcurrentCallExecutor(
+        std::shared_ptr<ModuleRepository> module_repo,
+        std::shared_ptr<RuntimeContextFactory> ctx_factory,
+        std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<storage::trie::Codec> codec,
+        std::shared_ptr<storage::trie::TrieSerializer> serializer,
+        Cost budget);
+
+    ConcurrentCallExecutor(
+        std::shared_ptr<ModuleRepository> module_repo,
+        std::shared_ptr<RuntimeContextFactory> ctx_factory,
+        std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<storage::trie::Codec> codec,
+        std::shared_ptr<storage::trie::TrieSerializer> serializer,
+        const application::AppConfiguration &app_config);
+
+    outcome::result<common::Buffer> call(
+        const primitives::BlockHash &block_hash,
+        std::string_view method,
+        common::BufferView args);
+
+    /**
+     * Context at block over shared state, for read-only calls of other
+     * components (e.g. transaction validation), not limited by budget.
+     */
+    outcome::result<RuntimeContext> contextAt(
+        const primitives::BlockHash &block_hash);
+
+    /**
+     * Shared state, reused while it is one of `kStates` recent states.
+     */
+    outcome::result<std::shared_ptr<storage::trie::SharedTrieState>> stateAt(
+        const storage::trie::RootHash &state);
+
+    /**
+     * Estimated cost of method call.
+     */
+    Cost cost(std::string_view method) const;
+
+   private:
+    /// Called with `mutex_` locked
+    Cost costLocked(std::string_view method) const;
+
+    std::shared_ptr<ModuleRepository> module_repo_;
+    std::shared_ptr<RuntimeContextFactory> ctx_factory_;
+    std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<storage::trie::Codec> codec_;
+    std::shared_ptr<storage::trie::TrieSerializer> serializer_;
+    Cost budget_;
+
+    mutable std::mutex mutex_;
+    Cost running_{};
+    // method names come from clients, so only `kMethods` recent are kept
+    mutable Lru<std::string, Cost> costs_;
+    SafeObject<Lru<storage::trie::RootHash,
+                   std::shared_ptr<storage::trie::SharedTrieState>>>
+        states_;
+  };
+}  // namespace kagome::runtime
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::runtime, ConcurrentCallExecutor::Error);
+
+template <>
+struct boost::di::ctor_traits<kagome::runtime::ConcurrentCallExecutor> {
+  BOOST_DI_INJECT_TRAITS(
+      std::shared_ptr<kagome::runtime::ModuleRepository>,
+      std::shared_ptr<kagome::runtime::RuntimeContextFactory>,
+      std::shared_ptr<const kagome::blockchain::BlockHeaderRepository>,
+      std::shared_ptr<kagome::storage::trie::Codec>,
+      std::shared_ptr<kagome::storage::trie::TrieSerializer>,
+      const kagome::application::AppConfiguration &);
+};
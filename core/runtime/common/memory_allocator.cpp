@@ -6,6 +6,10 @@
 
 #include "runtime/common/memory_allocator.hpp"
 
+#include <atomic>
+#include <bit>
+#include <mutex>
+
 #include <boost/endian/conversion.hpp>
 
 #include "runtime/memory.hpp"
@@ -19,24 +23,57 @@ namespace kagome::runtime {
 
   constexpr auto kPoisoned{"the allocator has been poisoned"};
 
-  static uint64_t read_u64(const MemoryHandle &memory, WasmPointer ptr) {
-    return boost::endian::load_little_u64(
-        memory.view(ptr, sizeof(uint64_t)).value().data());
-  }
+  namespace {
+    std::atomic_bool stats_enabled = false;
 
-  static void write_u64(const MemoryHandle &memory,
-                        WasmPointer ptr,
-                        uint64_t v) {
-    boost::endian::store_little_u64(
-        memory.view(ptr, sizeof(uint64_t)).value().data(), v);
+    struct TotalStats {
+      std::mutex mutex;
+      MemoryAllocatorImpl::Stats stats;
+    };
+
+    TotalStats &globalStats() {
+      static TotalStats total;
+      return total;
+    }
+  }  // namespace
+
+  void MemoryAllocatorImpl::Stats::merge(const Stats &other) {
+    for (size_t order = 0; order < kOrders; ++order) {
+      orders[order].allocations += other.orders[order].allocations;
+      orders[order].max_in_use = std::max(orders[order].max_in_use,
+                                          other.orders[order].max_in_use);
+    }
+    max_heap = std::max(max_heap, other.max_heap);
   }
 
   MemoryAllocatorImpl::MemoryAllocatorImpl(std::shared_ptr<MemoryHandle> memory,
                                            const MemoryConfig &config)
       : memory_{std::move(memory)},
         offset_{roundUpAlign(config.heap_base)},
-        max_memory_pages_num_{memory_->pagesMax().value_or(kMaxPages)} {
+        max_memory_pages_num_{memory_->pagesMax().value_or(kMaxPages)},
+        heap_base_{offset_} {
     BOOST_ASSERT(max_memory_pages_num_ > 0);
+    if (stats_enabled) {
+      stats_.emplace();
+    }
+  }
+
+  MemoryAllocatorImpl::~MemoryAllocatorImpl() {
+    if (stats_) {
+      auto &total = globalStats();
+      std::unique_lock lock{total.mutex};
+      total.stats.merge(*stats_);
+    }
+  }
+
+  void MemoryAllocatorImpl::enableStats(bool enable) {
+    stats_enabled = enable;
+  }
+
+  MemoryAllocatorImpl::Stats MemoryAllocatorImpl::totalStats() {
+    auto &total = globalStats();
+    std::unique_lock lock{total.mutex};
+    return total.stats;
   }
 
   WasmPointer MemoryAllocatorImpl::allocate(WasmSize size) {
@@ -47,11 +84,12 @@ namespace kagome::runtime {
     if (size > kMaxAllocate) {
       throw std::runtime_error{"RequestedAllocationTooLarge"};
     }
-    size = std::max(size, kMinAllocate);
-    size = math::nextHighPowerOf2(size);
-    uint32_t order = std::countr_zero(size) - std::countr_zero(kMinAllocate);
+    // smallest power of two chunk, which fits size
+    uint32_t order = std::bit_width(std::max(size, kMinAllocate) - 1)
+                   - std::countr_zero(kMinAllocate);
+    size = kMinAllocate << order;
     uint32_t head_ptr;  // NOLINT(cppcoreguidelines-init-variables)
-    if (auto &list = free_lists_.at(order)) {
+    if (auto &list = free_lists_[order]) {
       head_ptr = *list;
       if (*list + sizeof(Header) + size > memory_->size()) {
         throw std::runtime_error{"Header pointer out of memory bounds"};
@@ -73,7 +111,14 @@ namespace kagome::runtime {
       }
       offset_ = next_offset;
     }
-    write_u64(*memory_, head_ptr, kOccupied | order);
+    writeHeader(head_ptr, kOccupied | order);
+    if (stats_) {
+      auto &stats = stats_->orders[order];
+      ++stats.allocations;
+      ++stats.in_use;
+      stats.max_in_use = std::max(stats.max_in_use, stats.in_use);
+      stats_->max_heap = std::max(stats_->max_heap, offset_ - heap_base_);
+    }
     poisoned_ = false;
     return head_ptr + sizeof(Header);
   }
@@ -88,15 +133,43 @@ namespace kagome::runtime {
     }
     auto head_ptr = ptr - sizeof(Header);
     auto order = readOccupied(head_ptr);
-    auto &list = free_lists_.at(order);
+    auto &list = free_lists_[order];
     auto prev = list.value_or(kNil);
     list = head_ptr;
-    write_u64(*memory_, head_ptr, prev);
+    writeHeader(head_ptr, prev);
+    if (stats_ and stats_->orders[order].in_use != 0) {
+      --stats_->orders[order].in_use;
+    }
     poisoned_ = false;
   }
 
+  uint8_t *MemoryAllocatorImpl::base() const {
+    auto size = memory_->size();
+    if (size != base_size_) {
+      base_ = size == 0 ? nullptr : memory_->view(0, size).value().data();
+      base_size_ = size;
+    }
+    return base_;
+  }
+
+  uint64_t MemoryAllocatorImpl::readHeader(WasmPointer ptr) const {
+    auto *data = base();
+    if (uint64_t{ptr} + sizeof(Header) > base_size_) {
+      throw std::runtime_error{"Header pointer out of memory bounds"};
+    }
+    return boost::endian::load_little_u64(data + ptr);
+  }
+
+  void MemoryAllocatorImpl::writeHeader(WasmPointer ptr, uint64_t header) {
+    auto *data = base();
+    if (uint64_t{ptr} + sizeof(Header) > base_size_) {
+      throw std::runtime_error{"Header pointer out of memory bounds"};
+    }
+    boost::endian::store_little_u64(data + ptr, header);
+  }
+
   uint32_t MemoryAllocatorImpl::readOccupied(WasmPointer head_ptr) const {
-    auto head = read_u64(*memory_, head_ptr);
+    auto head = readHeader(head_ptr);
     uint32_t order = head;
     if (order >= kOrders) {
       throw std::runtime_error{"order exceed the total number of orders"};
@@ -109,7 +182,7 @@ namespace kagome::runtime {
 
   std::optional<uint32_t> MemoryAllocatorImpl::readFree(
       WasmPointer head_ptr) const {
-    auto head = read_u64(*memory_, head_ptr);
+    auto head = readHeader(head_ptr);
     if ((head & kOccupied) != 0) {
       throw std::runtime_error{"free list points to a occupied header"};
     }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <optional>
 
 #include "common/literals.hpp"
@@ -49,12 +50,47 @@ namespace kagome::runtime {
    */
   class MemoryAllocatorImpl final : public MemoryAllocator {
    public:
+    // https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs#L105
+    static constexpr size_t kOrders = 23;
+
+    /// Allocations of one order, chunk size is `8 << order`
+    struct OrderStats {
+      uint64_t allocations = 0;
+      uint32_t in_use = 0;
+      uint32_t max_in_use = 0;
+    };
+
+    /// Allocation statistics per size order
+    struct Stats {
+      std::array<OrderStats, kOrders> orders;
+      /// high-water mark of bump allocated heap size
+      WasmSize max_heap = 0;
+
+      /// Sums allocations, takes maximum of high-water marks
+      void merge(const Stats &other);
+    };
+
     MemoryAllocatorImpl(std::shared_ptr<MemoryHandle> memory,
                         const struct MemoryConfig &config);
+    ~MemoryAllocatorImpl() override;
 
     WasmPointer allocate(WasmSize size) override;
     void deallocate(WasmPointer ptr) override;
 
+    /**
+     * Enables statistics in allocators created afterwards. Statistics of
+     * allocator are merged into `totalStats` when it is destroyed, i.e. when
+     * memory is reset for next runtime call.
+     */
+    static void enableStats(bool enable);
+
+    /// Merged statistics of destroyed allocators
+    static Stats totalStats();
+
+    const std::optional<Stats> &stats() const {
+      return stats_;
+    }
+
     /*
       Following methods are needed mostly for testing purposes.
     */
@@ -64,8 +100,6 @@ namespace kagome::runtime {
    private:
     using Header = uint64_t;
 
-    // https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs#L105
-    static constexpr size_t kOrders = 23;
     // https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs#L106
     static constexpr WasmSize kMinAllocate = 8;
     static constexpr size_t kMaxAllocate = kMinAllocate << (kOrders - 1);
@@ -73,11 +107,18 @@ namespace kagome::runtime {
     static constexpr auto kOccupied = uint64_t{1} << 32;
     static constexpr uint32_t kNil = UINT32_MAX;
 
+    /// Raw pointer to linear memory, refreshed when memory size changes
+    uint8_t *base() const;
+    uint64_t readHeader(WasmPointer ptr) const;
+    void writeHeader(WasmPointer ptr, uint64_t header);
     uint32_t readOccupied(WasmPointer ptr) const;
     std::optional<uint32_t> readFree(WasmPointer ptr) const;
 
    private:
     std::shared_ptr<MemoryHandle> memory_;
+    // cached by `base()`, memory may move only when it grows
+    mutable uint8_t *base_ = nullptr;
+    mutable WasmSize base_size_ = 0;
 
     std::array<std::optional<uint32_t>, kOrders> free_lists_;
 
@@ -85,6 +126,8 @@ namespace kagome::runtime {
     uint32_t offset_;
     uint32_t max_memory_pages_num_;
     bool poisoned_ = false;
+    WasmSize heap_base_;
+    std::optional<Stats> stats_;
   };
 
 }  // namespace kagome::runtime
@@ -6,10 +6,13 @@
 
 #include "runtime/common/module_repository_impl.hpp"
 
+#include <boost/asio/post.hpp>
+
 #include "blockchain/block_header_repository.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "log/profiling_logger.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
-#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "runtime/common/uncompressed_code_cache.hpp"
 #include "runtime/heap_alloc_strategy_heappages.hpp"
 #include "runtime/instance_environment.hpp"
 #include "runtime/module.hpp"
@@ -32,7 +35,8 @@ namespace kagome::runtime {
       std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
       std::shared_ptr<storage::trie::TrieStorage> trie_storage,
       std::shared_ptr<const ModuleFactory> module_factory,
-      std::shared_ptr<const RuntimeCodeProvider> code_provider)
+      std::shared_ptr<const RuntimeCodeProvider> code_provider,
+      std::shared_ptr<UncompressedCodeCache> code_cache)
       : runtime_instances_pool_{std::move(runtime_instances_pool)},
         hasher_{std::move(hasher)},
         block_header_repository_{std::move(block_header_repository)},
@@ -40,12 +44,14 @@ namespace kagome::runtime {
         trie_storage_{std::move(trie_storage)},
         module_factory_{std::move(module_factory)},
         code_provider_{std::move(code_provider)},
+        code_cache_{std::move(code_cache)},
         cache_{4},
         logger_{log::createLogger("Module Repository", "runtime")} {
     BOOST_ASSERT(runtime_instances_pool_);
     BOOST_ASSERT(runtime_upgrade_tracker_);
     BOOST_ASSERT(module_factory_);
     BOOST_ASSERT(code_provider_);
+    BOOST_ASSERT(code_cache_);
   }
 
   outcome::result<std::shared_ptr<ModuleInstance>>
@@ -71,29 +77,76 @@ namespace kagome::runtime {
     KAGOME_PROFILE_START(code_retrieval)
     OUTCOME_TRY(state, runtime_upgrade_tracker_->getLastCodeUpdateState(block));
     KAGOME_PROFILE_END(code_retrieval)
+    return codeAtState(state, storage_state);
+  }
 
+  outcome::result<ModuleRepositoryImpl::Item> ModuleRepositoryImpl::codeAtState(
+      const storage::trie::RootHash &state,
+      const storage::trie::RootHash &storage_state) {
     KAGOME_PROFILE_START(module_retrieval)
-    Item item;
-    OUTCOME_TRY(SAFE_UNIQUE(cache_)->outcome::result<void> {
+    auto cached = SAFE_UNIQUE(cache_)->std::optional<Item> {
       if (auto r = cache_.get(state)) {
-        item = r->get();
-      } else {
-        auto code_res = code_provider_->getCodeAt(state);
-        if (not code_res) {
-          code_res = code_provider_->getCodeAt(storage_state);
-        }
-        auto &code_zstd = *code_res.value();
-        item.hash = hasher_->blake2b_256(code_zstd);
-        OUTCOME_TRY(code, uncompressCodeIfNeeded(code_zstd));
-        item.code = std::make_shared<Buffer>(code);
-        BOOST_OUTCOME_TRY(item.version, readEmbeddedVersion(code));
-        OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(storage_state));
-        BOOST_OUTCOME_TRY(item.config.heap_alloc_strategy,
-                          heapAllocStrategyHeappagesDefault(*batch));
-        cache_.put(state, item);
+        return r->get();
       }
-      return outcome::success();
-    });
+      return std::nullopt;
+    };
+    if (cached) {
+      return std::move(*cached);
+    }
+    // decompression and version parsing don't block cached states
+    Item item;
+    auto code_res = code_provider_->getCodeAt(state);
+    if (not code_res) {
+      code_res = code_provider_->getCodeAt(storage_state);
+    }
+    OUTCOME_TRY(code_zstd, code_res);
+    item.hash = hasher_->blake2b_256(*code_zstd);
+    BOOST_OUTCOME_TRY(item.code, code_cache_->get(item.hash, *code_zstd));
+    BOOST_OUTCOME_TRY(item.version, readEmbeddedVersion(*item.code));
+    OUTCOME_TRY(batch, trie_storage_->getEphemeralBatchAt(storage_state));
+    BOOST_OUTCOME_TRY(item.config.heap_alloc_strategy,
+                      heapAllocStrategyHeappagesDefault(*batch));
+    SAFE_UNIQUE(cache_) { cache_.put(state, item); };
     return item;
   }
+
+  void ModuleRepositoryImpl::precompileRuntimeUpgrades(
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+      common::WorkerThreadPool &worker_thread_pool) {
+    chain_sub_ = primitives::events::subscribe(
+        std::move(chain_sub_engine),
+        primitives::events::ChainEventType::kNewRuntime,
+        [weak{weak_from_this()}, io{worker_thread_pool.io_context()}](
+            const primitives::events::ChainEventParams &event_params) {
+          primitives::BlockHash block_hash =
+              boost::get<primitives::events::NewRuntimeEventParams>(
+                  event_params)
+                  .get();
+          boost::asio::post(*io, [weak, block_hash] {
+            if (auto self = weak.lock()) {
+              if (auto r = self->precompileAt(block_hash); not r) {
+                SL_WARN(self->logger_,
+                        "Runtime upgrade precompilation at {} failed: {}",
+                        block_hash,
+                        r.error());
+              }
+            }
+          });
+        });
+  }
+
+  outcome::result<void> ModuleRepositoryImpl::precompileAt(
+      const primitives::BlockHash &block_hash) {
+    OUTCOME_TRY(header, block_header_repository_->getBlockHeader(block_hash));
+    // block with `:code` change is state of runtime upgrade, so cache key
+    // matches `RuntimeUpgradeTracker::getLastCodeUpdateState` for descendants
+    OUTCOME_TRY(item, codeAtState(header.state_root, header.state_root));
+    OUTCOME_TRY(runtime_instances_pool_->instantiateFromCode(
+        item.hash, [&] { return item.code; }, {item.config}));
+    SL_VERBOSE(logger_,
+               "Precompiled runtime {} from block {}",
+               item.hash,
+               header.blockInfo());
+    return outcome::success();
+  }
 }  // namespace kagome::runtime
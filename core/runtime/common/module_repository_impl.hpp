@@ -12,6 +12,7 @@
 #include <unordered_map>
 
 #include "log/logger.hpp"
+#include "primitives/event_types.hpp"
 #include "runtime/instance_environment.hpp"
 #include "utils/lru.hpp"
 #include "utils/safe_object.hpp"
@@ -20,6 +21,10 @@ namespace kagome::blockchain {
   class BlockHeaderRepository;
 }  // namespace kagome::blockchain
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::crypto {
   class Hasher;
 }  // namespace kagome::crypto
@@ -32,8 +37,11 @@ namespace kagome::runtime {
   class RuntimeUpgradeTracker;
   class ModuleFactory;
   class RuntimeInstancesPool;
+  class UncompressedCodeCache;
 
-  class ModuleRepositoryImpl final : public ModuleRepository {
+  class ModuleRepositoryImpl final
+      : public ModuleRepository,
+        public std::enable_shared_from_this<ModuleRepositoryImpl> {
    public:
     ModuleRepositoryImpl(
         std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool,
@@ -43,7 +51,8 @@ namespace kagome::runtime {
         std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
         std::shared_ptr<storage::trie::TrieStorage> trie_storage,
         std::shared_ptr<const ModuleFactory> module_factory,
-        std::shared_ptr<const RuntimeCodeProvider> code_provider);
+        std::shared_ptr<const RuntimeCodeProvider> code_provider,
+        std::shared_ptr<UncompressedCodeCache> code_cache);
 
     outcome::result<std::shared_ptr<ModuleInstance>> getInstanceAt(
         const primitives::BlockInfo &block,
@@ -52,6 +61,17 @@ namespace kagome::runtime {
     outcome::result<std::optional<primitives::Version>> embeddedVersion(
         const primitives::BlockHash &block_hash) override;
 
+    /**
+     * Compiles runtime announced by `:code` (or `:heappages`) change in
+     * imported block on worker thread, so descendant blocks don't wait for
+     * compilation.
+     */
+    void precompileRuntimeUpgrades(
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
+        common::WorkerThreadPool &worker_thread_pool);
+
+    outcome::result<void> precompileAt(const primitives::BlockHash &block_hash);
+
    private:
     struct Item {
       common::Hash256 hash;
@@ -63,6 +83,13 @@ namespace kagome::runtime {
     outcome::result<Item> codeAt(const primitives::BlockInfo &block,
                                  const storage::trie::RootHash &storage_state);
 
+    /**
+     * @param state - state of last runtime upgrade, cache key
+     */
+    outcome::result<Item> codeAtState(
+        const storage::trie::RootHash &state,
+        const storage::trie::RootHash &storage_state);
+
     std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool_;
     std::shared_ptr<crypto::Hasher> hasher_;
     std::shared_ptr<blockchain::BlockHeaderRepository> block_header_repository_;
@@ -70,7 +97,9 @@ namespace kagome::runtime {
     std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
     std::shared_ptr<const ModuleFactory> module_factory_;
     std::shared_ptr<const RuntimeCodeProvider> code_provider_;
+    std::shared_ptr<UncompressedCodeCache> code_cache_;
     SafeObject<Lru<common::Hash256, Item>> cache_;
+    primitives::events::ChainEventSubscriberPtr chain_sub_;
     log::Logger logger_;
   };
 
@@ -0,0 +1,288 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/runtime_artifact_store.hpp"
+
+#include <array>
+#include <fstream>
+
+#include <boost/assert.hpp>
+
+#include "application/app_configuration.hpp"
+#include "common/buffer.hpp"
+#include "crypto/blake2/blake2b.h"
+#include "metrics/histogram_timer.hpp"
+#include "scale/scale.hpp"
+#include "utils/read_file.hpp"
+#include "utils/write_file.hpp"
+
+namespace kagome::runtime {
+  namespace {
+    auto &metric_artifacts_size() {
+      static metrics::GaugeHelper metric{
+          "kagome_runtime_artifacts_size",
+          "Total size of compiled runtime artifacts on disk in bytes",
+      };
+      return metric;
+    }
+
+    auto &metric_artifacts_evicted() {
+      static metrics::CounterHelper metric{
+          "kagome_runtime_artifacts_evicted",
+          "Number of compiled runtime artifacts removed over disk budget",
+      };
+      return metric;
+    }
+
+    auto &metric_artifacts_corrupted() {
+      static metrics::CounterHelper metric{
+          "kagome_runtime_artifacts_corrupted",
+          "Number of compiled runtime artifacts with checksum mismatch",
+      };
+      return metric;
+    }
+  }  // namespace
+
+  RuntimeArtifactStore::RuntimeArtifactStore(std::filesystem::path dir,
+                                             uint64_t budget)
+      : dir_{std::move(dir)},
+        budget_{budget},
+        logger_{log::createLogger("RuntimeArtifactStore", "runtime")} {
+    loadIndex();
+  }
+
+  RuntimeArtifactStore::RuntimeArtifactStore(
+      const application::AppConfiguration &app_config)
+      : RuntimeArtifactStore{
+          app_config.runtimeCacheDirPath(),
+          uint64_t{app_config.runtimeCacheLimit()} * 1024 * 1024} {}
+
+  RuntimeArtifactStore::~RuntimeArtifactStore() {
+    std::unique_lock lock{mutex_};
+    if (dirty_) {
+      saveIndex();
+    }
+  }
+
+  outcome::result<bool> RuntimeArtifactStore::contains(
+      const std::filesystem::path &path) {
+    auto name = path.filename().string();
+    std::error_code ec;
+    auto exists = std::filesystem::exists(path, ec);
+    if (ec) {
+      return ec;
+    }
+    {
+      std::unique_lock lock{mutex_};
+      auto it = entries_.find(name);
+      if (not exists) {
+        if (it != entries_.end()) {
+          size_ -= it->second.size;
+          entries_.erase(it);
+          saveIndex();
+        }
+        return false;
+      }
+      if (it != entries_.end() and it->second.verified) {
+        it->second.last_used = ++clock_;
+        saveIndexLater();
+        return true;
+      }
+    }
+    // checksum of large artifact takes a while, don't block other pools
+    OUTCOME_TRY(entry, scan(path));
+    std::unique_lock lock{mutex_};
+    auto it = entries_.find(name);
+    if (it != entries_.end()
+        and (it->second.size != entry.size
+             or it->second.checksum != entry.checksum)) {
+      SL_WARN(logger_, "Runtime artifact {} is corrupted, removing", name);
+      metric_artifacts_corrupted()->inc();
+      size_ -= it->second.size;
+      entries_.erase(it);
+      std::filesystem::remove(path, ec);
+      saveIndex();
+      return false;
+    }
+    use(name, entry);
+    evict(name);
+    saveIndex();
+    return true;
+  }
+
+  outcome::result<void> RuntimeArtifactStore::add(
+      const std::filesystem::path &path) {
+    std::error_code ec;
+    if (not std::filesystem::exists(path, ec)) {
+      // nothing to index
+      return outcome::success();
+    }
+    OUTCOME_TRY(entry, scan(path));
+    std::unique_lock lock{mutex_};
+    auto name = path.filename().string();
+    use(name, entry);
+    evict(name);
+    saveIndex();
+    return outcome::success();
+  }
+
+  void RuntimeArtifactStore::pin(const std::filesystem::path &path) {
+    std::unique_lock lock{mutex_};
+    ++pinned_[path.filename().string()];
+  }
+
+  void RuntimeArtifactStore::unpin(const std::filesystem::path &path) {
+    std::unique_lock lock{mutex_};
+    auto it = pinned_.find(path.filename().string());
+    BOOST_ASSERT(it != pinned_.end());
+    if (it != pinned_.end() and --it->second == 0) {
+      pinned_.erase(it);
+    }
+  }
+
+  std::shared_ptr<const Module> RuntimeArtifactStore::loaded(
+      const std::filesystem::path &path) const {
+    std::unique_lock lock{mutex_};
+    auto it = loaded_.find(path.filename().string());
+    if (it == loaded_.end()) {
+      return nullptr;
+    }
+    return it->second.lock();
+  }
+
+  void RuntimeArtifactStore::setLoaded(
+      const std::filesystem::path &path,
+      const std::shared_ptr<const Module> &module) {
+    std::unique_lock lock{mutex_};
+    std::erase_if(loaded_, [](auto &p) { return p.second.expired(); });
+    loaded_[path.filename().string()] = module;
+  }
+
+  uint64_t RuntimeArtifactStore::size() const {
+    std::unique_lock lock{mutex_};
+    return size_;
+  }
+
+  outcome::result<RuntimeArtifactStore::Entry> RuntimeArtifactStore::scan(
+      const std::filesystem::path &path) {
+    std::ifstream file{path, std::ios::binary};
+    if (not file.good()) {
+      return std::errc{errno};
+    }
+    Entry entry;
+    crypto::blake2b_ctx ctx;
+    crypto::blake2b_init(&ctx, entry.checksum.size(), nullptr, 0);
+    std::array<char, 1 << 16> chunk;
+    while (file.read(chunk.data(), chunk.size()) or file.gcount() != 0) {
+      crypto::blake2b_update(&ctx, chunk.data(), file.gcount());
+      entry.size += file.gcount();
+    }
+    if (file.bad()) {
+      return std::errc{errno};
+    }
+    crypto::blake2b_final(&ctx, entry.checksum.data());
+    return entry;
+  }
+
+  void RuntimeArtifactStore::loadIndex() {
+    common::Buffer raw;
+    auto path = dir_ / kIndexFile;
+    std::error_code ec;
+    if (not std::filesystem::exists(path, ec)) {
+      return;
+    }
+    if (auto r = readFile(raw, path); not r) {
+      SL_WARN(logger_, "Can't read {}: {}", path.native(), r.error());
+      return;
+    }
+    auto decoded = scale::decode<std::vector<IndexEntry>>(raw);
+    if (not decoded) {
+      SL_WARN(
+          logger_, "Can't decode {}: {}", path.native(), decoded.error());
+      return;
+    }
+    for (auto &item : decoded.value()) {
+      entries_[item.name] = {
+          .size = item.size,
+          .checksum = item.checksum,
+          .last_used = item.last_used,
+      };
+      size_ += item.size;
+      clock_ = std::max(clock_, item.last_used);
+    }
+    metric_artifacts_size()->set(static_cast<double>(size_));
+  }
+
+  void RuntimeArtifactStore::saveIndex() {
+    metric_artifacts_size()->set(static_cast<double>(size_));
+    std::vector<IndexEntry> index;
+    index.reserve(entries_.size());
+    for (auto &[name, entry] : entries_) {
+      index.emplace_back(IndexEntry{
+          .name = name,
+          .size = entry.size,
+          .checksum = entry.checksum,
+          .last_used = entry.last_used,
+      });
+    }
+    auto path = dir_ / kIndexFile;
+    auto r = writeFileTmp(path, scale::encode(index).value());
+    if (not r) {
+      SL_WARN(logger_, "Can't write {}: {}", path.native(), r.error());
+    }
+    dirty_ = false;
+    saved_ = std::chrono::steady_clock::now();
+  }
+
+  void RuntimeArtifactStore::saveIndexLater() {
+    // losing recent uses only changes eviction order, so hits don't rewrite
+    // whole index every time
+    dirty_ = true;
+    if (std::chrono::steady_clock::now() - saved_ >= kSaveInterval) {
+      saveIndex();
+    }
+  }
+
+  void RuntimeArtifactStore::use(const std::string &name, Entry entry) {
+    auto &current = entries_[name];
+    size_ -= current.size;
+    current = entry;
+    current.verified = true;
+    current.last_used = ++clock_;
+    size_ += current.size;
+  }
+
+  void RuntimeArtifactStore::evict(const std::string &keep) {
+    if (budget_ == 0) {
+      return;
+    }
+    while (size_ > budget_) {
+      auto lru = entries_.end();
+      for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (it->first != keep and not pinned_.contains(it->first)
+            and (lru == entries_.end()
+                 or it->second.last_used < lru->second.last_used)) {
+          lru = it;
+        }
+      }
+      if (lru == entries_.end()) {
+        break;
+      }
+      std::error_code ec;
+      std::filesystem::remove(dir_ / lru->first, ec);
+      if (ec) {
+        SL_WARN(logger_,
+                "Can't remove runtime artifact {}: {}",
+                lru->first,
+                ec.message());
+      }
+      SL_VERBOSE(logger_, "Evicted runtime artifact {}", lru->first);
+      metric_artifacts_evicted()->inc();
+      size_ -= lru->second.size;
+      entries_.erase(lru);
+    }
+  }
+}  // namespace kagome::runtime
@@ -0,0 +1,139 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/di.hpp>
+
+#include "common/blob.hpp"
+#include "log/logger.hpp"
+#include "scale/tie.hpp"
+
+namespace kagome::application {
+  class AppConfiguration;
+}  // namespace kagome::application
+
+namespace kagome::runtime {
+  class Module;
+
+  /**
+   * Compiled runtime artifacts in runtime cache directory.
+   * Artifacts are addressed by name from `getCachePath` (compiler, code hash
+   * and memory config).
+   * Index file stores size, checksum and last use of every artifact, so
+   * corrupted artifacts are compiled again and least recently used artifacts
+   * are removed when directory exceeds disk budget.
+   * Shared by relay runtime pool and `PvfPool`, so same artifact is loaded
+   * only once while any of them uses it.
+   */
+  class RuntimeArtifactStore {
+   public:
+    static constexpr auto kIndexFile = "index";
+    /// Index is written at most once per interval when only last use changes
+    static constexpr std::chrono::seconds kSaveInterval{30};
+
+    /**
+     * @param budget - disk budget in bytes, 0 means unlimited
+     */
+    RuntimeArtifactStore(std::filesystem::path dir, uint64_t budget);
+
+    explicit RuntimeArtifactStore(
+        const application::AppConfiguration &app_config);
+
+    ~RuntimeArtifactStore();
+
+    const std::filesystem::path &dir() const {
+      return dir_;
+    }
+
+    /**
+     * Checks whether artifact exists and is not corrupted.
+     * Checksum is verified once per process.
+     * Corrupted artifact is removed.
+     * Artifacts missing in index (e.g. from `--precompile-relay`) are adopted.
+     */
+    outcome::result<bool> contains(const std::filesystem::path &path);
+
+    /**
+     * Indexes just compiled artifact and evicts least recently used
+     * artifacts over disk budget.
+     */
+    outcome::result<void> add(const std::filesystem::path &path);
+
+    /**
+     * Pinned artifact is not evicted, so it can't be removed between
+     * `contains` or `add` and loading it.
+     * Each `pin` must be followed by `unpin`.
+     */
+    void pin(const std::filesystem::path &path);
+    void unpin(const std::filesystem::path &path);
+
+    /**
+     * Module loaded from artifact by any pool, if it is still alive.
+     */
+    std::shared_ptr<const Module> loaded(
+        const std::filesystem::path &path) const;
+
+    void setLoaded(const std::filesystem::path &path,
+                   const std::shared_ptr<const Module> &module);
+
+    /**
+     * Total size of indexed artifacts in bytes.
+     */
+    uint64_t size() const;
+
+   private:
+    struct IndexEntry {
+      SCALE_TIE(4);
+
+      std::string name;
+      uint64_t size = 0;
+      common::Hash256 checksum;
+      uint64_t last_used = 0;
+    };
+
+    struct Entry {
+      uint64_t size = 0;
+      common::Hash256 checksum;
+      uint64_t last_used = 0;
+      bool verified = false;
+    };
+
+    static outcome::result<Entry> scan(const std::filesystem::path &path);
+
+    void loadIndex();
+    /// Called with `mutex_` locked
+    void saveIndex();
+    /// Called with `mutex_` locked, when only last use changed
+    void saveIndexLater();
+    void use(const std::string &name, Entry entry);
+    void evict(const std::string &keep);
+
+    std::filesystem::path dir_;
+    uint64_t budget_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    uint64_t size_ = 0;
+    uint64_t clock_ = 0;
+    bool dirty_ = false;
+    std::chrono::steady_clock::time_point saved_;
+    std::unordered_map<std::string, size_t> pinned_;
+    std::unordered_map<std::string, std::weak_ptr<const Module>> loaded_;
+    log::Logger logger_;
+  };
+}  // namespace kagome::runtime
+
+template <>
+struct boost::di::ctor_traits<kagome::runtime::RuntimeArtifactStore> {
+  BOOST_DI_INJECT_TRAITS(const kagome::application::AppConfiguration &);
+};
@@ -6,9 +6,11 @@
 
 #include "runtime/common/runtime_instances_pool.hpp"
 
-#include "application/app_configuration.hpp"
+#include <libp2p/common/final_action.hpp>
+
 #include "common/monadic_utils.hpp"
-#include "runtime/common/uncompress_code_if_needed.hpp"
+#include "metrics/histogram_timer.hpp"
+#include "runtime/common/runtime_artifact_store.hpp"
 #include "runtime/instance_environment.hpp"
 #include "runtime/module.hpp"
 #include "runtime/module_factory.hpp"
@@ -16,6 +18,33 @@
 #include "runtime/wabt/instrument.hpp"
 
 namespace kagome::runtime {
+  namespace {
+    auto &metric_compile_time() {
+      static metrics::HistogramTimer metric{
+          "kagome_runtime_compile_time",
+          "Time spent in compiling runtime artifacts in seconds",
+          {0.1, 0.5, 1.0, 2.0, 5.0, 10.0, 20.0, 30.0, 60.0, 120.0, 240.0},
+      };
+      return metric;
+    }
+
+    auto &metric_artifact_hits() {
+      static metrics::CounterHelper metric{
+          "kagome_runtime_artifact_cache_hits",
+          "Number of runtime modules loaded without compilation",
+      };
+      return metric;
+    }
+
+    auto &metric_artifact_misses() {
+      static metrics::CounterHelper metric{
+          "kagome_runtime_artifact_cache_misses",
+          "Number of runtime modules compiled",
+      };
+      return metric;
+    }
+  }  // namespace
+
   /**
    * @brief Wrapper type over sptr<ModuleInstance>. Allows to return instance
    * back to the ModuleInstancePool upon destruction of
@@ -85,15 +114,16 @@ namespace kagome::runtime {
   };
 
   RuntimeInstancesPoolImpl::RuntimeInstancesPoolImpl(
-      const application::AppConfiguration &app_config,
       std::shared_ptr<ModuleFactory> module_factory,
       std::shared_ptr<WasmInstrumenter> instrument,
+      std::shared_ptr<RuntimeArtifactStore> artifacts,
       size_t capacity)
-      : cache_dir_{app_config.runtimeCacheDirPath()},
-        module_factory_{std::move(module_factory)},
+      : module_factory_{std::move(module_factory)},
         instrument_{std::move(instrument)},
+        artifacts_{std::move(artifacts)},
         pools_{capacity} {
     BOOST_ASSERT(module_factory_);
+    BOOST_ASSERT(artifacts_);
   }
 
   outcome::result<std::shared_ptr<ModuleInstance>>
@@ -136,7 +166,7 @@ namespace kagome::runtime {
                          config.memory_limits.heap_alloc_strategy)
                          .extra_pages);
     }
-    return cache_dir_ / name;
+    return artifacts_->dir() / name;
   }
 
   outcome::result<void> RuntimeInstancesPoolImpl::precompile(
@@ -204,18 +234,30 @@ namespace kagome::runtime {
     l.unlock();
     auto path = getCachePath(code_hash, config);
     auto res = [&]() -> CompilationResult {
-      std::error_code ec;
-      if (not std::filesystem::exists(path, ec)) {
-        if (ec) {
-          return ec;
-        }
-        OUTCOME_TRY(code_zstd, get_code());
-        OUTCOME_TRY(code, uncompressCodeIfNeeded(*code_zstd));
-        BOOST_OUTCOME_TRY(code,
-                          instrument_->instrument(code, config));
-        OUTCOME_TRY(module_factory_->compile(path, code, config));
+      // may be loaded by other pool (e.g. `PvfPool`)
+      if (auto module = artifacts_->loaded(path)) {
+        metric_artifact_hits()->inc();
+        return module;
+      }
+      // not evicted by other pools until loaded
+      artifacts_->pin(path);
+      libp2p::common::FinalAction unpin{[&] { artifacts_->unpin(path); }};
+      OUTCOME_TRY(cached, artifacts_->contains(path));
+      if (cached) {
+        metric_artifact_hits()->inc();
+      } else {
+        metric_artifact_misses()->inc();
+        // `get_code` returns uncompressed code (shared by
+        // `UncompressedCodeCache`), so it's not copied again here
+        OUTCOME_TRY(code, get_code());
+        OUTCOME_TRY(instrumented, instrument_->instrument(*code, config));
+        auto timer = metric_compile_time().timer();
+        OUTCOME_TRY(module_factory_->compile(path, instrumented, config));
+        timer.reset();
+        OUTCOME_TRY(artifacts_->add(path));
       }
       OUTCOME_TRY(module, module_factory_->loadCompiled(path, config));
+      artifacts_->setLoaded(path, module);
       return module;
     }();
     l.lock();
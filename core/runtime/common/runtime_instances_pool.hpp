@@ -18,11 +18,8 @@
 #include "runtime/module_factory.hpp"
 #include "utils/lru.hpp"
 
-namespace kagome::application {
-  class AppConfiguration;
-}  // namespace kagome::application
-
 namespace kagome::runtime {
+  class RuntimeArtifactStore;
   class WasmInstrumenter;
 
   /**
@@ -33,9 +30,9 @@ namespace kagome::runtime {
         public std::enable_shared_from_this<RuntimeInstancesPoolImpl> {
    public:
     explicit RuntimeInstancesPoolImpl(
-        const application::AppConfiguration &app_config,
         std::shared_ptr<ModuleFactory> module_factory,
         std::shared_ptr<WasmInstrumenter> instrument,
+        std::shared_ptr<RuntimeArtifactStore> artifacts,
         size_t capacity = DEFAULT_MODULES_CACHE_SIZE);
 
     outcome::result<std::shared_ptr<ModuleInstance>> instantiateFromCode(
@@ -88,9 +85,9 @@ namespace kagome::runtime {
         const GetCode &get_code,
         const RuntimeContext::ContextParams &config);
 
-    std::filesystem::path cache_dir_;
     std::shared_ptr<ModuleFactory> module_factory_;
     std::shared_ptr<WasmInstrumenter> instrument_;
+    std::shared_ptr<RuntimeArtifactStore> artifacts_;
 
     std::mutex pools_mtx_;
     Lru<Key, InstancePool> pools_;
@@ -104,7 +101,8 @@ namespace kagome::runtime {
 
 template <>
 struct boost::di::ctor_traits<kagome::runtime::RuntimeInstancesPoolImpl> {
-  BOOST_DI_INJECT_TRAITS(const kagome::application::AppConfiguration &,
-                         std::shared_ptr<kagome::runtime::ModuleFactory>,
-                         std::shared_ptr<kagome::runtime::WasmInstrumenter>);
+  BOOST_DI_INJECT_TRAITS(
+      std::shared_ptr<kagome::runtime::ModuleFactory>,
+      std::shared_ptr<kagome::runtime::WasmInstrumenter>,
+      std::shared_ptr<kagome::runtime::RuntimeArtifactStore>);
 };
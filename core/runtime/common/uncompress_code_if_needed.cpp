@@ -6,6 +6,8 @@
 
 #include "runtime/common/uncompress_code_if_needed.hpp"
 
+#include <memory>
+
 #include <zstd.h>
 #include <zstd_errors.h>
 
@@ -37,23 +39,54 @@ namespace kagome::runtime {
     if (startsWith(buf, kZstdPrefix)) {
       auto zstd = buf.subspan(std::size(kZstdPrefix));
       // here we can check that blob is really ZSTD compressed
-      // but we don't use the result size, it's unknown for the WASM blob
+      // but the result size is optional, it's unknown for streamed blob
       // @see ZSTD_CONTENTSIZE_UNKNOWN
       auto check_size = ZSTD_getFrameContentSize(zstd.data(), zstd.size());
       if (check_size == ZSTD_CONTENTSIZE_ERROR) {
         return UncompressError::ZSTD_ERROR;
       }
-      res.resize(kCodeBlobBombLimit);
-      auto size = ZSTD_decompress(
-          res.data(), kCodeBlobBombLimit, zstd.data(), zstd.size());
-      if (ZSTD_isError(size)) {
-        if (ZSTD_getErrorCode(size) == ZSTD_error_dstSize_tooSmall) {
-          return UncompressError::BOMB_SIZE_REACHED;
-        }
+      if (check_size != ZSTD_CONTENTSIZE_UNKNOWN
+          and check_size > kCodeBlobBombLimit) {
+        return UncompressError::BOMB_SIZE_REACHED;
+      }
+      std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> ctx{
+          ZSTD_createDCtx(), &ZSTD_freeDCtx};
+      if (not ctx) {
         return UncompressError::ZSTD_ERROR;
       }
-      res.resize(size);
-      res.shrink_to_fit();
+      // stream into buffer of exact size (when known) instead of zeroing
+      // bomb limit sized buffer for every blob
+      common::Buffer out_buf;
+      out_buf.resize(check_size != ZSTD_CONTENTSIZE_UNKNOWN
+                         ? check_size
+                         : ZSTD_DStreamOutSize());
+      ZSTD_inBuffer in{zstd.data(), zstd.size(), 0};
+      ZSTD_outBuffer out{out_buf.data(), out_buf.size(), 0};
+      while (true) {
+        auto hint = ZSTD_decompressStream(ctx.get(), &out, &in);
+        if (ZSTD_isError(hint)) {
+          return UncompressError::ZSTD_ERROR;
+        }
+        if (hint == 0 and in.pos == in.size) {
+          break;
+        }
+        if (out.pos == out.size) {
+          if (out.size == kCodeBlobBombLimit) {
+            return UncompressError::BOMB_SIZE_REACHED;
+          }
+          out_buf.resize(std::min(
+              std::max(out.size * 2, ZSTD_DStreamOutSize()),
+              kCodeBlobBombLimit));
+          out.dst = out_buf.data();
+          out.size = out_buf.size();
+        } else if (in.pos == in.size) {
+          // truncated frame
+          return UncompressError::ZSTD_ERROR;
+        }
+      }
+      out_buf.resize(out.pos);
+      out_buf.shrink_to_fit();
+      res = std::move(out_buf);
     } else {
       res = common::Buffer{buf};
     }
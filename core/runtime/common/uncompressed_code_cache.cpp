@@ -0,0 +1,44 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/uncompressed_code_cache.hpp"
+
+#include "runtime/common/uncompress_code_if_needed.hpp"
+
+namespace kagome::runtime {
+  outcome::result<UncompressedCodeCache::Code> UncompressedCodeCache::get(
+      const common::Hash256 &code_hash, common::BufferView code_zstd) {
+    std::unique_lock lock{mutex_};
+    if (auto it = cache_.find(code_hash); it != cache_.end()) {
+      if (auto code = it->second.lock()) {
+        return code;
+      }
+      cache_.erase(it);
+    }
+    if (auto it = uncompressing_.find(code_hash); it != uncompressing_.end()) {
+      auto future = it->second;
+      lock.unlock();
+      return future.get();
+    }
+    std::promise<outcome::result<Code>> promise;
+    uncompressing_.emplace(code_hash, promise.get_future());
+    lock.unlock();
+    auto res = [&]() -> outcome::result<Code> {
+      auto code = std::make_shared<common::Buffer>();
+      OUTCOME_TRY(uncompressCodeIfNeeded(code_zstd, *code));
+      return code;
+    }();
+    lock.lock();
+    // other hashes may be inserted meanwhile and rehash invalidates iterators
+    uncompressing_.erase(code_hash);
+    if (res) {
+      std::erase_if(cache_, [](auto &p) { return p.second.expired(); });
+      cache_.emplace(code_hash, res.value());
+    }
+    promise.set_value(res);
+    return res;
+  }
+}  // namespace kagome::runtime
@@ -0,0 +1,45 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/blob.hpp"
+#include "common/buffer.hpp"
+#include "outcome/outcome.hpp"
+
+namespace kagome::runtime {
+  /**
+   * Uncompressed runtime code shared by relay runtime (`ModuleRepositoryImpl`)
+   * and parachain runtimes (`PvfPool`, used by pvf precheck, validation and
+   * `ModulePrecompiler`).
+   * Code is uncompressed once while any user holds it, concurrent callers
+   * with same code wait for single decompression.
+   */
+  class UncompressedCodeCache {
+   public:
+    using Code = std::shared_ptr<const common::Buffer>;
+
+    /**
+     * @param code_hash - hash of (possibly) compressed code, cache key
+     * @param code_zstd - (possibly) compressed code
+     */
+    outcome::result<Code> get(const common::Hash256 &code_hash,
+                              common::BufferView code_zstd);
+
+   private:
+    std::mutex mutex_;
+    std::unordered_map<common::Hash256, std::weak_ptr<const common::Buffer>>
+        cache_;
+    std::unordered_map<common::Hash256,
+                       std::shared_future<outcome::result<Code>>>
+        uncompressing_;
+  };
+}  // namespace kagome::runtime
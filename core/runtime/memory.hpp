@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <optional>
 
 #include "common/buffer_view.hpp"
@@ -13,6 +14,7 @@
 #include "runtime/common/memory_allocator.hpp"
 #include "runtime/ptr_size.hpp"
 #include "runtime/types.hpp"
+#include "scale/encoder/primitives.hpp"
 
 namespace kagome::runtime {
   using BytesOut = std::span<uint8_t>;
@@ -124,6 +126,35 @@ namespace kagome::runtime {
       return PtrSize{ptr, static_cast<WasmSize>(v.size())}.combine();
     }
 
+    /**
+     * Stores SCALE encoded `Option<Vec<u8>>`. Allocates exact encoded size
+     * and writes option tag, compact length and bytes straight into memory,
+     * without intermediate encoded buffer.
+     */
+    WasmSpan storeOptionalBytes(std::optional<common::BufferView> bytes) {
+      // option tag and compact length take at most 10 bytes
+      std::array<uint8_t, 10> prefix{};
+      size_t prefix_size = 1;
+      if (bytes) {
+        prefix[0] = 1;
+        kagome::scale::encodeCompact(
+            [&](const uint8_t *const ptr, size_t count) {
+              memcpy(prefix.data() + prefix_size, ptr, count);
+              prefix_size += count;
+            },
+            bytes->size());
+      }
+      auto size =
+          static_cast<WasmSize>(prefix_size + (bytes ? bytes->size() : 0));
+      auto ptr = allocate(size);
+      auto out = handle_->view(ptr, size).value();
+      memcpy(out.data(), prefix.data(), prefix_size);
+      if (bytes and not bytes->empty()) {
+        memcpy(out.data() + prefix_size, bytes->data(), bytes->size());
+      }
+      return PtrSize{ptr, size}.combine();
+    }
+
     auto &memory() const {
       return handle_;
     }
@@ -7,17 +7,25 @@
 #include "runtime/runtime_api/impl/tagged_transaction_queue.hpp"
 
 #include "blockchain/block_tree.hpp"
+#include "crypto/hasher.hpp"
+#include "runtime/common/concurrent_call_executor.hpp"
 #include "runtime/executor.hpp"
 
 namespace kagome::runtime {
 
   TaggedTransactionQueueImpl::TaggedTransactionQueueImpl(
       std::shared_ptr<Executor> executor,
-      LazySPtr<blockchain::BlockTree> block_tree)
+      std::shared_ptr<ConcurrentCallExecutor> call_executor,
+      LazySPtr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<crypto::Hasher> hasher)
       : executor_{std::move(executor)},
+        call_executor_{std::move(call_executor)},
         block_tree_(block_tree),
+        hasher_{std::move(hasher)},
         logger_{log::createLogger("TaggedTransactionQueue", "runtime")} {
     BOOST_ASSERT(executor_);
+    BOOST_ASSERT(call_executor_);
+    BOOST_ASSERT(hasher_);
   }
 
   outcome::result<TaggedTransactionQueue::TransactionValidityAt>
@@ -25,7 +33,22 @@ namespace kagome::runtime {
       primitives::TransactionSource source, const primitives::Extrinsic &ext) {
     auto block = block_tree_.get()->bestBlock();
     SL_TRACE(logger_, "Validate transaction called at block {}", block);
-    OUTCOME_TRY(ctx, executor_->ctx().ephemeralAt(block.hash));
+    auto ext_hash = hasher_->blake2b_256(ext.data);
+    auto cached = cache_.exclusiveAccess(
+        [&](auto &cache) -> std::optional<primitives::TransactionValidity> {
+          if (auto entry = cache.get(ext_hash)) {
+            auto &validity = entry->get();
+            if (validity.block == block.hash and validity.source == source) {
+              return validity.validity;
+            }
+          }
+          return std::nullopt;
+        });
+    if (cached) {
+      SL_TRACE(logger_, "Validity of {} is cached", ext_hash);
+      return TransactionValidityAt{block, std::move(*cached)};
+    }
+    OUTCOME_TRY(ctx, call_executor_->contextAt(block.hash));
     OUTCOME_TRY(result,
                 executor_->call<primitives::TransactionValidity>(
                     ctx,
@@ -33,6 +56,9 @@ namespace kagome::runtime {
                     source,
                     ext,
                     block.hash));
+    cache_.exclusiveAccess([&](auto &cache) {
+      cache.put(ext_hash, CachedValidity{block.hash, source, result});
+    });
     return TransactionValidityAt{block, std::move(result)};
   }
 
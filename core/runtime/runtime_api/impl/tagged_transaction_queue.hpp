@@ -10,27 +10,52 @@
 
 #include "injector/lazy.hpp"
 #include "log/logger.hpp"
+#include "utils/lru.hpp"
+#include "utils/safe_object.hpp"
 
 namespace kagome::blockchain {
   class BlockTree;
 }
 
+namespace kagome::crypto {
+  class Hasher;
+}
+
 namespace kagome::runtime {
 
+  class ConcurrentCallExecutor;
   class Executor;
 
   class TaggedTransactionQueueImpl final : public TaggedTransactionQueue {
    public:
-    TaggedTransactionQueueImpl(std::shared_ptr<Executor> executor,
-                               LazySPtr<blockchain::BlockTree> block_tree);
+    /// Validation results of recent extrinsics
+    static constexpr size_t kValidationCacheSize = 8192;
+
+    TaggedTransactionQueueImpl(
+        std::shared_ptr<Executor> executor,
+        std::shared_ptr<ConcurrentCallExecutor> call_executor,
+        LazySPtr<blockchain::BlockTree> block_tree,
+        std::shared_ptr<crypto::Hasher> hasher);
 
     outcome::result<TransactionValidityAt> validate_transaction(
         primitives::TransactionSource source,
         const primitives::Extrinsic &ext) override;
 
    private:
+    /// Validity is reused only at same block, new block revalidates
+    struct CachedValidity {
+      primitives::BlockHash block;
+      primitives::TransactionSource source;
+      primitives::TransactionValidity validity;
+    };
+
     std::shared_ptr<Executor> executor_;
+    /// validations at same block share decoded trie nodes of its state
+    std::shared_ptr<ConcurrentCallExecutor> call_executor_;
     LazySPtr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<crypto::Hasher> hasher_;
+    SafeObject<Lru<common::Hash256, CachedValidity>> cache_{
+        kValidationCacheSize};
     log::Logger logger_;
   };
 
@@ -22,6 +22,7 @@ namespace kagome::runtime {
     static constexpr size_t DEFAULT_MODULES_CACHE_SIZE = 2;
 
     using CodeHash = common::Hash256;
+    /// Returns uncompressed code
     using GetCode = std::function<RuntimeCodeProvider::Result()>;
 
     virtual ~RuntimeInstancesPool() = default;
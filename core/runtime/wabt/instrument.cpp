@@ -8,6 +8,8 @@
 
 #include <algorithm>
 
+#include "common/worker_thread_pool.hpp"
+#include "crypto/blake2/blake2b.h"
 #include "runtime/wabt/stack_limiter.hpp"
 #include "runtime/wabt/util.hpp"
 
@@ -83,11 +85,24 @@ namespace kagome::runtime {
 
   WabtOutcome<common::Buffer> instrumentCodeForCompilation(
       common::BufferView code, const RuntimeContext::ContextParams &config) {
+    std::shared_ptr<const StackCosts> stack_costs;
+    return instrumentCodeForCompilation(code, config, stack_costs);
+  }
+
+  WabtOutcome<common::Buffer> instrumentCodeForCompilation(
+      common::BufferView code,
+      const RuntimeContext::ContextParams &config,
+      std::shared_ptr<const StackCosts> &stack_costs,
+      boost::asio::io_context *io) {
     OUTCOME_TRY(module, wabtDecode(code, config));
     const auto &memory_config = config.memory_limits;
     if (memory_config.max_stack_values_num) {
+      if (not stack_costs) {
+        OUTCOME_TRY(costs, computeStackCosts(module, io));
+        stack_costs = std::make_shared<const StackCosts>(std::move(costs));
+      }
       OUTCOME_TRY(instrumentWithStackLimiter(
-          module, *memory_config.max_stack_values_num));
+          module, *memory_config.max_stack_values_num, *stack_costs, io));
     }
     OUTCOME_TRY(convertMemoryImportIntoExport(module));
     OUTCOME_TRY(setupMemoryAccordingToHeapAllocStrategy(
@@ -96,8 +111,32 @@ namespace kagome::runtime {
     return wabtEncode(module);
   }
 
+  WasmInstrumenter::WasmInstrumenter(
+      common::WorkerThreadPool &worker_thread_pool)
+      : worker_io_{worker_thread_pool.io_context()} {}
+
   WabtOutcome<common::Buffer> WasmInstrumenter::instrument(
       common::BufferView code, const RuntimeContext::ContextParams &config) const {
-    return instrumentCodeForCompilation(code, config);
+    auto code_hash = crypto::blake2b<32>(code);
+    Key key{code_hash, config};
+    std::shared_ptr<const StackCosts> stack_costs;
+    {
+      std::unique_lock lock{mutex_};
+      if (auto cached = code_cache_.get(key)) {
+        return cached->get();
+      }
+      if (auto cached = stack_costs_cache_.get(code_hash)) {
+        stack_costs = cached->get();
+      }
+    }
+    OUTCOME_TRY(instrumented,
+                instrumentCodeForCompilation(
+                    code, config, stack_costs, worker_io_.get()));
+    std::unique_lock lock{mutex_};
+    if (stack_costs) {
+      stack_costs_cache_.put(code_hash, stack_costs);
+    }
+    code_cache_.put(key, instrumented);
+    return std::move(instrumented);
   }
 }  // namespace kagome::runtime
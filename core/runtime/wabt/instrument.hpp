@@ -6,14 +6,24 @@
 
 #pragma once
 
+#include <mutex>
+
+#include "common/blob.hpp"
 #include "common/buffer.hpp"
 #include "runtime/runtime_context.hpp"
 #include "runtime/wabt/error.hpp"
+#include "runtime/wabt/stack_limiter.hpp"
+#include "utils/lru.hpp"
+#include "utils/tuple_hash.hpp"
 
 namespace wabt {
   struct Module;
 }  // namespace wabt
 
+namespace kagome::common {
+  class WorkerThreadPool;
+}  // namespace kagome::common
+
 namespace kagome::runtime {
   struct MemoryLimits;
 
@@ -32,12 +42,44 @@ namespace kagome::runtime {
   WabtOutcome<common::Buffer> instrumentCodeForCompilation(
       common::BufferView code, const RuntimeContext::ContextParams &config);
 
+  /**
+   * Same as above, reusing `stack_costs` if present, or computing it.
+   * Functions are analyzed and patched on `io` pool too, if passed.
+   */
+  WabtOutcome<common::Buffer> instrumentCodeForCompilation(
+      common::BufferView code,
+      const RuntimeContext::ContextParams &config,
+      std::shared_ptr<const StackCosts> &stack_costs,
+      boost::asio::io_context *io = nullptr);
+
+  /**
+   * Caches instrumented code per (code hash, config), and stack costs per
+   * code hash, so same code with other limits skips function analysis.
+   */
   class WasmInstrumenter {
    public:
+    static constexpr size_t kCodeCacheSize = 4;
+    static constexpr size_t kStackCostsCacheSize = 32;
+
+    /// Instruments on calling thread only
+    WasmInstrumenter() = default;
+
+    /// Instruments functions of large modules on worker pool too
+    explicit WasmInstrumenter(common::WorkerThreadPool &worker_thread_pool);
+
     virtual ~WasmInstrumenter() = default;
 
     virtual WabtOutcome<common::Buffer> instrument(
         common::BufferView code,
         const RuntimeContext::ContextParams &config) const;
+
+   private:
+    using Key = std::tuple<common::Hash256, RuntimeContext::ContextParams>;
+
+    std::shared_ptr<boost::asio::io_context> worker_io_;
+    mutable std::mutex mutex_;
+    mutable Lru<Key, common::Buffer> code_cache_{kCodeCacheSize};
+    mutable Lru<common::Hash256, std::shared_ptr<const StackCosts>>
+        stack_costs_cache_{kStackCostsCacheSize};
   };
 }  // namespace kagome::runtime
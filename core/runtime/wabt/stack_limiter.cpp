@@ -6,10 +6,16 @@
 
 #include "runtime/wabt/stack_limiter.hpp"
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include "common/visitor.hpp"
 #include "log/logger.hpp"
 #include "log/profiling_logger.hpp"
 #include "runtime/wabt/util.hpp"
+#include "utils/parallel_for.hpp"
 
 namespace kagome::runtime {
   namespace detail {
@@ -548,7 +554,7 @@ namespace kagome::runtime {
         wabt::Func &func,
         const wabt::Var &stack_height,
         uint32_t stack_limit,
-        const std::unordered_map<wabt::Index, uint32_t> &stack_costs,
+        const StackCosts &stack_costs,
         log::Logger logger) {
       if (func.exprs.empty()) {
         return outcome::success();
@@ -622,7 +628,7 @@ namespace kagome::runtime {
         wabt::Module &module,
         const wabt::Var &stack_height,
         uint32_t stack_limit,
-        const std::unordered_map<wabt::Index, uint32_t> &stack_costs) {
+        const StackCosts &stack_costs) {
       std::set<wabt::Index> thunked_funcs;
       for (auto *exported : module.exports) {
         if (exported->kind == wabt::ExternalKind::Func) {
@@ -735,6 +741,56 @@ namespace kagome::runtime {
       }
       return outcome::success();
     }
+
+    // smaller modules are not worth posting tasks
+    constexpr size_t kMinFuncsPerTask = 64;
+
+    /**
+     * Calls `f(i)` for every `i` in `[begin, end)`, on `io` pool too if
+     * passed. Stops on first error.
+     */
+    WabtOutcome<void> parallel_for(
+        boost::asio::io_context *io,
+        size_t begin,
+        size_t end,
+        const std::function<WabtOutcome<void>(size_t)> &f) {
+      auto count = end - std::min(begin, end);
+      std::atomic_bool failed = false;
+      std::mutex error_mutex;
+      std::optional<WabtError> error;
+      auto work = [&](size_t i) {
+        if (failed.load()) {
+          return;
+        }
+        auto r = [&]() -> WabtOutcome<void> {
+          try {
+            return f(begin + i);
+          } catch (std::exception &e) {
+            return WabtError{e.what()};
+          }
+        }();
+        if (not r) {
+          std::unique_lock lock{error_mutex};
+          if (not error) {
+            error = r.error();
+          }
+          failed.store(true);
+        }
+      };
+      if (io == nullptr) {
+        for (size_t i = 0; i < count and not failed.load(); ++i) {
+          work(i);
+        }
+      } else {
+        auto tasks = std::min<size_t>(std::thread::hardware_concurrency(),
+                                      count / kMinFuncsPerTask);
+        parallelFor(*io, tasks, count, work);
+      }
+      if (error) {
+        return *error;
+      }
+      return outcome::success();
+    }
   }  // namespace detail
 
   auto &stackLimiterLog() {
@@ -742,22 +798,43 @@ namespace kagome::runtime {
     return log;
   }
 
+  WabtOutcome<StackCosts> computeStackCosts(const wabt::Module &module,
+                                            boost::asio::io_context *io) {
+    auto logger = stackLimiterLog();
+    KAGOME_PROFILE_START_L(logger, count_costs);
+    // imported functions cost nothing
+    StackCosts func_costs(module.funcs.size(), 0);
+    OUTCOME_TRY(detail::parallel_for(
+        io,
+        module.num_func_imports,
+        module.funcs.size(),
+        [&](size_t i) -> WabtOutcome<void> {
+          auto &func = module.funcs[i];
+          SL_TRACE(logger, "count cost {}", func->name);
+          OUTCOME_TRY(cost, detail::compute_stack_cost(logger, *func, module));
+          func_costs[i] = cost;
+          SL_TRACE(logger, "cost {} = {}", func->name, cost);
+          return outcome::success();
+        }));
+    KAGOME_PROFILE_END(count_costs);
+    return func_costs;
+  }
+
   WabtOutcome<void> instrumentWithStackLimiter(wabt::Module &module,
                                                size_t stack_limit) {
+    OUTCOME_TRY(func_costs, computeStackCosts(module));
+    OUTCOME_TRY(instrumentWithStackLimiter(module, stack_limit, func_costs));
+    return outcome::success();
+  }
+
+  WabtOutcome<void> instrumentWithStackLimiter(wabt::Module &module,
+                                               size_t stack_limit,
+                                               const StackCosts &func_costs,
+                                               boost::asio::io_context *io) {
     auto logger = stackLimiterLog();
-    KAGOME_PROFILE_START_L(logger, count_costs);
-    std::unordered_map<wabt::Index, uint32_t> func_costs;
-    for (size_t i = 0; i < module.num_func_imports; i++) {
-      func_costs[i] = 0;
+    if (func_costs.size() != module.funcs.size()) {
+      return WabtError{"stack costs don't match module functions"};
     }
-    for (size_t i = module.num_func_imports; i < module.funcs.size(); i++) {
-      auto &func = module.funcs[i];
-      SL_TRACE(logger, "count cost {}", func->name);
-      OUTCOME_TRY(cost, detail::compute_stack_cost(logger, *func, module));
-      func_costs[i] = cost;
-      SL_TRACE(logger, "cost {} = {}", func->name, cost);
-    }
-    KAGOME_PROFILE_END(count_costs);
 
     wabt::Global stack_height_global{""};
     stack_height_global.type = wabt::Type::I32;
@@ -771,19 +848,20 @@ namespace kagome::runtime {
     wabt::Var stack_height_var{stack_height_index, wabt::Location{}};
 
     KAGOME_PROFILE_START_L(logger, instrument_wasm);
-    for (size_t i = 0; i < module.funcs.size(); i++) {
-      auto &func = module.funcs[i];
-      OUTCOME_TRY(detail::instrument_func(
-          *func, stack_height_var, stack_limit, func_costs, logger));
-      SL_TRACE(logger, "[{}/{}] {}", i, module.funcs.size(), func->name);
-    }
+    // each function body is patched independently
+    OUTCOME_TRY(detail::parallel_for(
+        io, 0, module.funcs.size(), [&](size_t i) -> WabtOutcome<void> {
+          auto &func = module.funcs[i];
+          OUTCOME_TRY(detail::instrument_func(
+              *func, stack_height_var, stack_limit, func_costs, logger));
+          SL_TRACE(logger, "[{}/{}] {}", i, module.funcs.size(), func->name);
+          return outcome::success();
+        }));
 
     OUTCOME_TRY(detail::generate_thunks(
         logger, module, stack_height_var, stack_limit, func_costs));
 
     KAGOME_PROFILE_END(instrument_wasm);
-
-    OUTCOME_TRY(wabtValidate(module));
     return outcome::success();
   }
 
@@ -795,6 +873,7 @@ namespace kagome::runtime {
     KAGOME_PROFILE_END(read_ir);
 
     OUTCOME_TRY(instrumentWithStackLimiter(module, stack_limit));
+    OUTCOME_TRY(wabtValidate(module));
 
     KAGOME_PROFILE_START_L(logger, serialize_wasm);
     return wabtEncode(module);
@@ -10,12 +10,22 @@
 #include "log/logger.hpp"
 #include "runtime/wabt/error.hpp"
 
+namespace boost::asio {
+  class io_context;
+}  // namespace boost::asio
+
 namespace wabt {
   struct Module;
   struct Func;
 }  // namespace wabt
 
 namespace kagome::runtime {
+  /**
+   * Max stack height of every function, indexed like `wabt::Module::funcs`.
+   * Depends only on code, so reused for different stack limits.
+   */
+  using StackCosts = std::vector<uint32_t>;
+
   // for tests
   namespace detail {
     WabtOutcome<uint32_t> compute_stack_cost(const log::Logger &logger,
@@ -35,6 +45,25 @@ namespace kagome::runtime {
   [[nodiscard]] WabtOutcome<common::Buffer> instrumentWithStackLimiter(
       common::BufferView uncompressed_wasm, size_t stack_limit);
 
+  /**
+   * Analyzes functions, in parallel on `io` pool if passed.
+   */
+  WabtOutcome<StackCosts> computeStackCosts(
+      const wabt::Module &module, boost::asio::io_context *io = nullptr);
+
+  /**
+   * Patches module in place, doesn't validate it.
+   */
   WabtOutcome<void> instrumentWithStackLimiter(wabt::Module &module,
                                                size_t stack_limit);
+
+  /**
+   * Same as above, with precomputed `func_costs`.
+   * Patches functions in parallel on `io` pool if passed.
+   */
+  WabtOutcome<void> instrumentWithStackLimiter(
+      wabt::Module &module,
+      size_t stack_limit,
+      const StackCosts &func_costs,
+      boost::asio::io_context *io = nullptr);
 }  // namespace kagome::runtime
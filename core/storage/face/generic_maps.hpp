@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "storage/face/batch_writeable.hpp"
 #include "storage/face/iterable.hpp"
 #include "storage/face/readable.hpp"
@@ -29,6 +32,21 @@ namespace kagome::storage::face {
     virtual std::optional<size_t> byteSizeHint() const {
       return std::nullopt;
     }
+
+    /**
+     * Gets values of several keys, in one batch if storage supports it
+     * @return values in order of keys, std::nullopt for missing ones
+     */
+    virtual outcome::result<std::vector<std::optional<OwnedOrView<V>>>>
+    tryGetMany(std::span<const View<K>> keys) const {
+      std::vector<std::optional<OwnedOrView<V>>> values;
+      values.reserve(keys.size());
+      for (const auto &key : keys) {
+        OUTCOME_TRY(value, this->tryGet(key));
+        values.emplace_back(std::move(value));
+      }
+      return values;
+    }
   };
 
 }  // namespace kagome::storage::face
@@ -23,6 +23,9 @@ namespace kagome::storage {
 
   inline const common::Buffer kActivePeersKey = ":kagome:last_active_peers"_buf;
 
+  inline const common::Buffer kBlockSkipLookupPrefix =
+      ":kagome:block_skip:"_buf;
+
   inline const common::Buffer kRuntimeHashesLookupKey =
       ":kagome:runtime_hashes"_buf;
 
@@ -538,6 +538,33 @@ namespace kagome::storage {
     return status_as_error(status);
   }
 
+  outcome::result<std::vector<std::optional<BufferOrView>>>
+  RocksDbSpace::tryGetMany(std::span<const BufferView> keys) const {
+    OUTCOME_TRY(rocks, use());
+    std::vector<rocksdb::Slice> slices;
+    slices.reserve(keys.size());
+    for (const auto &key : keys) {
+      slices.emplace_back(make_slice(key));
+    }
+    std::vector<rocksdb::ColumnFamilyHandle *> columns(keys.size(), column_);
+    std::vector<std::string> values;
+    auto statuses = rocks->db_->MultiGet(rocks->ro_, columns, slices, &values);
+
+    std::vector<std::optional<BufferOrView>> result;
+    result.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (statuses[i].ok()) {
+        auto *data = reinterpret_cast<uint8_t *>(values[i].data());  // NOLINT
+        result.emplace_back(Buffer(data, data + values[i].size()));
+      } else if (statuses[i].IsNotFound()) {
+        result.emplace_back(std::nullopt);
+      } else {
+        return status_as_error(statuses[i]);
+      }
+    }
+    return result;
+  }
+
   outcome::result<void> RocksDbSpace::put(const BufferView &key,
                                           BufferOrView &&value) {
     OUTCOME_TRY(rocks, use());
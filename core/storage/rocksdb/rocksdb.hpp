@@ -150,6 +150,9 @@ namespace kagome::storage {
     outcome::result<std::optional<BufferOrView>> tryGet(
         const BufferView &key) const override;
 
+    outcome::result<std::vector<std::optional<BufferOrView>>> tryGetMany(
+        std::span<const BufferView> keys) const override;
+
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
 
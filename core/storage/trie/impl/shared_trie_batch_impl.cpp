@@ -0,0 +1,199 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/impl/shared_trie_batch_impl.hpp"
+
+#include <boost/assert.hpp>
+
+#include "storage/trie/impl/ephemeral_trie_batch_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_cursor.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_impl.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
+
+namespace kagome::storage::trie {
+  namespace {
+    PolkadotTrie::NodePtr copyNode(const TrieNode &node) {
+      if (node.isBranch()) {
+        return std::make_shared<BranchNode>(node.asBranch());
+      }
+      return std::make_shared<LeafNode>(node.asLeaf());
+    }
+  }  // namespace
+
+  outcome::result<std::shared_ptr<SharedTrieState>> SharedTrieState::create(
+      std::shared_ptr<Codec> codec,
+      std::shared_ptr<TrieSerializer> serializer,
+      const RootHash &root) {
+    OUTCOME_TRY(root_node, serializer->retrieveNode(root));
+    return std::shared_ptr<SharedTrieState>{new SharedTrieState{
+        std::move(codec), std::move(serializer), root, std::move(root_node)}};
+  }
+
+  SharedTrieState::SharedTrieState(std::shared_ptr<Codec> codec,
+                                   std::shared_ptr<TrieSerializer> serializer,
+                                   const RootHash &root,
+                                   PolkadotTrie::NodePtr root_node)
+      : codec_{std::move(codec)},
+        serializer_{std::move(serializer)},
+        root_{root},
+        root_node_{std::move(root_node)} {
+    BOOST_ASSERT(codec_ != nullptr);
+    BOOST_ASSERT(serializer_ != nullptr);
+  }
+
+  std::shared_ptr<PolkadotTrie> SharedTrieState::trie() {
+    PolkadotTrie::RetrieveFunctions retrieve{
+        [self{shared_from_this()}](const DummyNode &dummy) {
+          return self->node(dummy.db_key);
+        },
+        [self{shared_from_this()}](const common::Hash256 &hash) {
+          return self->value(hash);
+        },
+    };
+    if (root_node_ == nullptr) {
+      return PolkadotTrieImpl::createEmpty(std::move(retrieve));
+    }
+    return PolkadotTrieImpl::create(copyNode(*root_node_), std::move(retrieve));
+  }
+
+  outcome::result<PolkadotTrie::NodePtr> SharedTrieState::node(
+      const MerkleValue &db_key) {
+    auto hash = db_key.asHash();
+    if (not hash) {
+      // node is inlined into parent, decoding it is cheap
+      return serializer_->retrieveNode(db_key);
+    }
+    auto cached = nodes_.sharedAccess(
+        [&](const auto &nodes) -> std::shared_ptr<const TrieNode> {
+          auto it = nodes.find(*hash);
+          return it != nodes.end() ? it->second : nullptr;
+        });
+    if (cached == nullptr) {
+      // other call may load same node meanwhile, both copies are equal
+      OUTCOME_TRY(loaded, serializer_->retrieveNode(db_key));
+      if (loaded == nullptr) {
+        return nullptr;
+      }
+      cached = nodes_.exclusiveAccess([&](auto &nodes) {
+        return nodes.emplace(*hash, std::move(loaded)).first->second;
+      });
+    }
+    return copyNode(*cached);
+  }
+
+  outcome::result<std::optional<common::Buffer>> SharedTrieState::value(
+      const common::Hash256 &hash) {
+    auto cached = values_.sharedAccess(
+        [&](const auto &values) -> std::optional<common::Buffer> {
+          auto it = values.find(hash);
+          if (it == values.end()) {
+            return std::nullopt;
+          }
+          return it->second;
+        });
+    if (cached) {
+      return cached;
+    }
+    OUTCOME_TRY(loaded, serializer_->retrieveValue(hash, nullptr));
+    if (loaded) {
+      values_.exclusiveAccess(
+          [&](auto &values) { values.emplace(hash, *loaded); });
+    }
+    return loaded;
+  }
+
+  outcome::result<std::shared_ptr<SharedTrieState>> SharedTrieState::child(
+      const RootHash &root) {
+    auto cached = children_.sharedAccess(
+        [&](const auto &children) -> std::shared_ptr<SharedTrieState> {
+          auto it = children.find(root);
+          return it != children.end() ? it->second : nullptr;
+        });
+    if (cached != nullptr) {
+      return cached;
+    }
+    OUTCOME_TRY(child, create(codec_, serializer_, root));
+    return children_.exclusiveAccess([&](auto &children) {
+      return children.emplace(root, std::move(child)).first->second;
+    });
+  }
+
+  SharedTrieBatchImpl::SharedTrieBatchImpl(
+      std::shared_ptr<SharedTrieState> state)
+      : state_{std::move(state)} {
+    BOOST_ASSERT(state_ != nullptr);
+    own_ = std::make_unique<EphemeralTrieBatchImpl>(
+        state_->codec_, state_->trie(), state_->serializer_, nullptr);
+  }
+
+  outcome::result<BufferOrView> SharedTrieBatchImpl::get(
+      const BufferView &key) const {
+    return own_->get(key);
+  }
+
+  outcome::result<std::optional<BufferOrView>> SharedTrieBatchImpl::tryGet(
+      const BufferView &key) const {
+    return own_->tryGet(key);
+  }
+
+  outcome::result<std::vector<std::optional<BufferOrView>>>
+  SharedTrieBatchImpl::tryGetMany(std::span<const BufferView> keys) const {
+    return own_->tryGetMany(keys);
+  }
+
+  outcome::result<bool> SharedTrieBatchImpl::contains(
+      const BufferView &key) const {
+    return own_->contains(key);
+  }
+
+  std::unique_ptr<PolkadotTrieCursor> SharedTrieBatchImpl::trieCursor() {
+    return own_->trieCursor();
+  }
+
+  outcome::result<void> SharedTrieBatchImpl::put(const BufferView &key,
+                                                 BufferOrView &&value) {
+    return own_->put(key, std::move(value));
+  }
+
+  outcome::result<void> SharedTrieBatchImpl::remove(const BufferView &key) {
+    return own_->remove(key);
+  }
+
+  outcome::result<std::tuple<bool, uint32_t>> SharedTrieBatchImpl::clearPrefix(
+      const BufferView &prefix, std::optional<uint64_t> limit) {
+    return own_->clearPrefix(prefix, limit);
+  }
+
+  outcome::result<RootHash> SharedTrieBatchImpl::commit(StateVersion version) {
+    for (auto &[path, child] : children_) {
+      OUTCOME_TRY(root, child->commit(version));
+      if (root == kEmptyRootHash) {
+        OUTCOME_TRY(own_->remove(path));
+      } else {
+        OUTCOME_TRY(own_->put(path, BufferView{root}));
+      }
+    }
+    children_.clear();
+    return own_->commit(version);
+  }
+
+  outcome::result<std::optional<std::shared_ptr<TrieBatch>>>
+  SharedTrieBatchImpl::createChildBatch(common::BufferView path) {
+    Buffer key{path};
+    if (children_.contains(key)) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(child_root_value, own_->tryGet(path));
+    auto child_root = child_root_value
+                        ? common::Hash256::fromSpan(*child_root_value).value()
+                        : kEmptyRootHash;
+    OUTCOME_TRY(child, state_->child(child_root));
+    std::shared_ptr<TrieBatch> batch =
+        std::make_shared<SharedTrieBatchImpl>(std::move(child));
+    children_.emplace(std::move(key), batch);
+    return batch;
+  }
+}  // namespace kagome::storage::trie
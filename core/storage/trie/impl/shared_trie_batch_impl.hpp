@@ -0,0 +1,107 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "storage/trie/trie_batches.hpp"
+
+#include <map>
+#include <unordered_map>
+
+#include "storage/trie/polkadot_trie/polkadot_trie.hpp"
+#include "utils/safe_object.hpp"
+
+namespace kagome::storage::trie {
+  class Codec;
+  class TrieSerializer;
+
+  /**
+   * Read-only trie state shared by concurrent runtime calls on same block.
+   * Trie nodes are loaded and decoded once for all calls and are never
+   * changed. Each call has own trie, which gets copies of nodes it visits,
+   * so calls don't lock each other except for short cache lookups.
+   */
+  class SharedTrieState
+      : public std::enable_shared_from_this<SharedTrieState> {
+   public:
+    static outcome::result<std::shared_ptr<SharedTrieState>> create(
+        std::shared_ptr<Codec> codec,
+        std::shared_ptr<TrieSerializer> serializer,
+        const RootHash &root);
+
+    const RootHash &root() const {
+      return root_;
+    }
+
+   private:
+    SharedTrieState(std::shared_ptr<Codec> codec,
+                    std::shared_ptr<TrieSerializer> serializer,
+                    const RootHash &root,
+                    PolkadotTrie::NodePtr root_node);
+
+    /// Own trie of single call, loading nodes through shared cache
+    std::shared_ptr<PolkadotTrie> trie();
+
+    /// Copy of decoded node, which may be changed by trie of call
+    outcome::result<PolkadotTrie::NodePtr> node(const MerkleValue &db_key);
+
+    outcome::result<std::optional<common::Buffer>> value(
+        const common::Hash256 &hash);
+
+    /// Shared state of child trie
+    outcome::result<std::shared_ptr<SharedTrieState>> child(
+        const RootHash &root);
+
+    std::shared_ptr<Codec> codec_;
+    std::shared_ptr<TrieSerializer> serializer_;
+    RootHash root_;
+    std::shared_ptr<const TrieNode> root_node_;
+    SafeObject<std::unordered_map<common::Hash256,
+                                  std::shared_ptr<const TrieNode>>>
+        nodes_;
+    SafeObject<std::unordered_map<common::Hash256, common::Buffer>> values_;
+    SafeObject<std::unordered_map<RootHash, std::shared_ptr<SharedTrieState>>>
+        children_;
+
+    friend class SharedTrieBatchImpl;
+  };
+
+  /**
+   * Batch of single runtime call over `SharedTrieState`.
+   * Runtime keeps changes in `TopperTrieBatchImpl` over this batch, so it's
+   * written only by `ext_storage_root`, which applies changes to base batch.
+   * Writes change only own trie of batch, so shared state is never changed.
+   */
+  class SharedTrieBatchImpl final : public TrieBatch {
+   public:
+    explicit SharedTrieBatchImpl(std::shared_ptr<SharedTrieState> state);
+
+    outcome::result<BufferOrView> get(const BufferView &key) const override;
+    outcome::result<std::optional<BufferOrView>> tryGet(
+        const BufferView &key) const override;
+    outcome::result<std::vector<std::optional<BufferOrView>>> tryGetMany(
+        std::span<const BufferView> keys) const override;
+    outcome::result<bool> contains(const BufferView &key) const override;
+
+    std::unique_ptr<PolkadotTrieCursor> trieCursor() override;
+
+    outcome::result<void> put(const BufferView &key,
+                              BufferOrView &&value) override;
+    outcome::result<void> remove(const BufferView &key) override;
+    outcome::result<std::tuple<bool, uint32_t>> clearPrefix(
+        const BufferView &prefix, std::optional<uint64_t> limit) override;
+
+    outcome::result<RootHash> commit(StateVersion version) override;
+
+    outcome::result<std::optional<std::shared_ptr<TrieBatch>>> createChildBatch(
+        common::BufferView path) override;
+
+   private:
+    std::shared_ptr<SharedTrieState> state_;
+    std::unique_ptr<TrieBatch> own_;
+    std::map<Buffer, std::shared_ptr<TrieBatch>> children_;
+  };
+}  // namespace kagome::storage::trie
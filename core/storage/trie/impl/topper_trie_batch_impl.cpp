@@ -35,10 +35,98 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie,
 }
 
 namespace kagome::storage::trie {
+  namespace {
+    /// Decodes SCALE compact length prefix of vector, returns length and
+    /// size of prefix
+    std::optional<std::pair<uint64_t, size_t>> decodeLength(BufferView bytes) {
+      if (bytes.empty()) {
+        return std::nullopt;
+      }
+      size_t size = 0;
+      switch (bytes[0] & 3) {
+        case 0:
+          return std::make_pair(uint64_t{bytes[0]} >> 2, size_t{1});
+        case 1:
+          size = 2;
+          break;
+        case 2:
+          size = 4;
+          break;
+        default:
+          size = (bytes[0] >> 2) + 5;
+      }
+      if (bytes.size() < size or size > 9) {
+        return std::nullopt;
+      }
+      uint64_t length = 0;
+      for (size_t i = size; i > 1; --i) {
+        length = (length << 8) | bytes[i - 1];
+      }
+      if (size <= 4) {
+        length = (length << 8 | bytes[0]) >> 2;
+      }
+      return std::make_pair(length, size);
+    }
+
+    /// Encodes SCALE compact length prefix of vector
+    Buffer encodeLength(uint64_t length) {
+      Buffer out;
+      if (length < (1 << 6)) {
+        out.putUint8(length << 2);
+      } else if (length < (1 << 14)) {
+        length = length << 2 | 1;
+        out.putUint8(length).putUint8(length >> 8);
+      } else if (length < (1 << 30)) {
+        length = length << 2 | 2;
+        for (size_t i = 0; i < 4; ++i) {
+          out.putUint8(length >> (8 * i));
+        }
+      } else {
+        size_t size = 4;
+        while (size < 8 and (length >> (8 * size)) != 0) {
+          ++size;
+        }
+        out.putUint8((size - 4) << 2 | 3);
+        for (size_t i = 0; i < size; ++i) {
+          out.putUint8(length >> (8 * i));
+        }
+      }
+      return out;
+    }
+
+    /**
+     * Appends `count` encoded `items` to encoded vector `value`, patching
+     * length prefix in place. Empty value becomes new vector.
+     * @return false if value is not a vector, it is left unchanged then
+     */
+    bool appendToVector(Buffer &value, uint64_t count, BufferView items) {
+      uint64_t length = 0;
+      size_t prefix_size = 0;
+      if (not value.empty()) {
+        auto prefix = decodeLength(value);
+        if (not prefix) {
+          return false;
+        }
+        std::tie(length, prefix_size) = *prefix;
+      }
+      auto prefix = encodeLength(length + count);
+      if (prefix.size() == prefix_size) {
+        std::copy(prefix.begin(), prefix.end(), value.begin());
+      } else {
+        // prefix grows only few times, when length crosses mode bounds
+        prefix.put(value.view(prefix_size));
+        value = std::move(prefix);
+      }
+      value.put(items);
+      return true;
+    }
+  }  // namespace
 
   TopperTrieBatchImpl::TopperTrieBatchImpl(
       const std::shared_ptr<TrieBatch> &parent)
-      : parent_(parent) {}
+      : parent_(parent),
+        parent_topper_(std::dynamic_pointer_cast<TopperTrieBatchImpl>(parent)) {
+  }
 
   outcome::result<BufferOrView> TopperTrieBatchImpl::get(
       const BufferView &key) const {
@@ -57,13 +145,25 @@ namespace kagome::storage::trie {
       }
       return std::nullopt;
     }
-    if (auto p = parent_.lock(); p != nullptr) {
-      return p->tryGet(key);
+    auto p = parent_.lock();
+    if (p == nullptr) {
+      return Error::PARENT_EXPIRED;
     }
-    return Error::PARENT_EXPIRED;
+    OUTCOME_TRY(value, p->tryGet(key));
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      // merged copy is not kept, values being appended are rarely read
+      auto merged = value ? std::move(*value).intoBuffer() : Buffer{};
+      appendToVector(merged, it->second.count, it->second.items);
+      return merged;
+    }
+    return std::move(value);
   }
 
   std::unique_ptr<PolkadotTrieCursor> TopperTrieBatchImpl::trieCursor() {
+    // cursor takes values from `cache_`
+    if (not materializeAppended()) {
+      return nullptr;
+    }
     if (auto p = parent_.lock(); p != nullptr) {
       return std::make_unique<TopperTrieCursor>(shared_from_this(),
                                                 p->trieCursor());
@@ -76,6 +176,9 @@ namespace kagome::storage::trie {
     if (auto it = cache_.find(key); it != cache_.end()) {
       return it->second.has_value();
     }
+    if (appended_.contains(key)) {
+      return true;
+    }
     if (auto p = parent_.lock(); p != nullptr) {
       return p->contains(key);
     }
@@ -84,16 +187,67 @@ namespace kagome::storage::trie {
 
   outcome::result<void> TopperTrieBatchImpl::put(const BufferView &key,
                                                  BufferOrView &&value) {
+    appended_.erase(key);
     cache_.insert_or_assign(Buffer{key}, std::move(value).intoBuffer());
     return outcome::success();
   }
 
   outcome::result<void> TopperTrieBatchImpl::remove(const BufferView &key) {
+    appended_.erase(key);
     cache_.insert_or_assign(Buffer{key}, std::nullopt);
 
     return outcome::success();
   }
 
+  outcome::result<void> TopperTrieBatchImpl::append(const BufferView &key,
+                                                    BufferView item) {
+    return appendItems(key, 1, item);
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::appendItems(const BufferView &key,
+                                                         uint64_t count,
+                                                         BufferView items) {
+    if (auto it = cache_.find(key); it != cache_.end()) {
+      if (not it->second) {
+        it->second.emplace();
+      }
+      appendToVector(*it->second, count, items);
+      return outcome::success();
+    }
+    if (auto it = appended_.find(key); it != appended_.end()) {
+      it->second.count += count;
+      it->second.items.put(items);
+      return outcome::success();
+    }
+    auto p = parent_.lock();
+    if (p == nullptr) {
+      return Error::PARENT_EXPIRED;
+    }
+    if (not parent_topper_.expired()) {
+      OUTCOME_TRY(exists, p->contains(key));
+      if (exists) {
+        appended_.emplace(Buffer{key}, Appended{count, Buffer{items}});
+        return outcome::success();
+      }
+    }
+    // value is copied once, further appends extend it in place
+    OUTCOME_TRY(value, p->tryGet(key));
+    auto copy = value ? std::move(*value).intoBuffer() : Buffer{};
+    if (appendToVector(copy, count, items)) {
+      cache_.emplace(Buffer{key}, std::move(copy));
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> TopperTrieBatchImpl::materializeAppended() {
+    for (auto &[key, appended] : appended_) {
+      OUTCOME_TRY(value, tryGet(key));
+      cache_.emplace(key, std::move(*value).intoBuffer());
+    }
+    appended_.clear();
+    return outcome::success();
+  }
+
   outcome::result<std::tuple<bool, uint32_t>> TopperTrieBatchImpl::clearPrefix(
       const BufferView &prefix, std::optional<uint64_t>) {
     for (auto it = cache_.lower_bound(prefix);
@@ -101,6 +255,11 @@ namespace kagome::storage::trie {
          ++it) {
       it->second = std::nullopt;
     }
+    for (auto it = appended_.lower_bound(prefix);
+         it != appended_.end() && startsWith(it->first, prefix);) {
+      cache_.emplace(it->first, std::nullopt);
+      it = appended_.erase(it);
+    }
 
     if (parent_.lock() != nullptr) {
       return outcome::success(std::make_tuple(false, 0ULL));
@@ -109,10 +268,28 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<void> TopperTrieBatchImpl::writeBack() {
-    if (auto p = parent_.lock()) {
+    auto p = parent_.lock();
+    if (not p) {
+      return Error::PARENT_EXPIRED;
+    }
+    auto topper = parent_topper_.lock();
+    if (not topper) {
       return apply(*p);
     }
-    return Error::PARENT_EXPIRED;
+    // batch is discarded after write back, so values are moved to parent
+    for (auto &[k, v] : cache_) {
+      if (v) {
+        OUTCOME_TRY(topper->put(k, std::move(*v)));
+      } else {
+        OUTCOME_TRY(topper->remove(k));
+      }
+    }
+    for (auto &[k, appended] : appended_) {
+      OUTCOME_TRY(topper->appendItems(k, appended.count, appended.items));
+    }
+    cache_.clear();
+    appended_.clear();
+    return outcome::success();
   }
 
   outcome::result<void> TopperTrieBatchImpl::apply(
@@ -124,6 +301,10 @@ namespace kagome::storage::trie {
         OUTCOME_TRY(map.remove(k));
       }
     }
+    for (auto &[k, appended] : appended_) {
+      OUTCOME_TRY(value, tryGet(k));
+      OUTCOME_TRY(map.put(k, std::move(*value)));
+    }
     return outcome::success();
   }
 
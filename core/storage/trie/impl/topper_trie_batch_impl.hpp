@@ -38,6 +38,16 @@ namespace kagome::storage::trie {
     outcome::result<void> put(const BufferView &key,
                               BufferOrView &&value) override;
     outcome::result<void> remove(const BufferView &key) override;
+
+    /**
+     * Appends SCALE encoded `item` to SCALE encoded vector stored by `key`,
+     * as ext_storage_append does. Value of this batch is extended in place,
+     * items appended to value of parent topper batch are kept aside until
+     * value is read or written back, so appending doesn't copy whole value.
+     * If stored value is not a vector, it is left unchanged.
+     */
+    outcome::result<void> append(const BufferView &key, BufferView item);
+
     outcome::result<std::tuple<bool, uint32_t>> clearPrefix(
         const BufferView &prefix, std::optional<uint64_t> limit) override;
 
@@ -51,8 +61,26 @@ namespace kagome::storage::trie {
     outcome::result<void> apply(storage::BufferStorage &map);
 
    private:
+    /// Encoded items appended to vector value of parent batch
+    struct Appended {
+      uint64_t count = 0;
+      Buffer items;
+    };
+
+    /// Appends `count` encoded `items` to vector value of `key`
+    outcome::result<void> appendItems(const BufferView &key,
+                                      uint64_t count,
+                                      BufferView items);
+
+    /// Moves items appended to parent value into `cache_`
+    outcome::result<void> materializeAppended();
+
     std::map<Buffer, std::optional<Buffer>> cache_;
+    /// keys are present in parent and absent in `cache_`
+    std::map<Buffer, Appended> appended_;
     std::weak_ptr<TrieBatch> parent_;
+    /// set if parent is topper batch too, which can keep appended items
+    std::weak_ptr<TopperTrieBatchImpl> parent_topper_;
 
     friend class TopperTrieCursor;
   };
@@ -6,27 +6,23 @@
 
 #include "telemetry/impl/message_pool.hpp"
 
-#include <mutex>  // for std::lock_guard
-
-#include <boost/assert.hpp>
+#include <cstring>
+#include <stdexcept>
 
 namespace kagome::telemetry {
   MessagePool::MessagePool(std::size_t entry_size_bytes,
                            std::size_t entries_count)
-      : entry_size_{entry_size_bytes}, entries_count_{entries_count} {
+      : entry_size_{entry_size_bytes},
+        entries_count_{entries_count},
+        pool_{std::make_unique<Record[]>(entries_count)} {
     // preallocate all the buffers
-    pool_.resize(entries_count);
-    for (auto &entry : pool_) {
-      entry.data.resize(entry_size_bytes, '\0');
-    }
-    free_slots_.reserve(entries_count);
     for (size_t i = 0; i < entries_count; ++i) {
-      free_slots_.emplace(i);
+      pool_[i].data.resize(entry_size_bytes, '\0');
     }
   }
 
-  std::optional<MessageHandle> MessagePool::push(const std::string &message,
-                                                 int16_t ref_count) {
+  std::optional<MessageHandle> MessagePool::push(std::string_view message,
+                                                 RefCount ref_count) {
     bool message_exceeds_max_size = message.length() > entry_size_;
     if (message_exceeds_max_size) {
       return std::nullopt;
@@ -34,58 +30,45 @@ namespace kagome::telemetry {
     if (ref_count <= 0) {
       return std::nullopt;
     }
-    auto has_free_slot = nextFreeSlot();  // quick blocking lookup
+    auto has_free_slot = nextFreeSlot(ref_count);
     if (not has_free_slot) {
       return std::nullopt;
     }
 
     auto slot = has_free_slot.value();
     auto &entry = pool_[slot];
-    entry.ref_count = ref_count;
+    // slot is owned by caller till handle is passed somewhere
     entry.data_size = message.length();
-    memcpy(entry.data.data(), message.c_str(), message.length());
-    // presence of zero-terminating char is preserved by the way of memory
-    // (re-)initialization in constructor and release method, and also a
-    // boundary check here - at the first line of push method
+    memcpy(entry.data.data(), message.data(), message.length());
     return slot;
   }
 
   MessagePool::RefCount MessagePool::add_ref(MessageHandle handle) {
-    bool handle_is_valid =
-        (handle < pool_.size()) and not free_slots_.contains(handle);
-    if (not handle_is_valid) {
+    auto entry = occupied(handle);
+    if (not entry) {
       return 0;  // zero references for bad handle
     }
-    std::lock_guard lock(mutex_);
-    // allowed to call only over already occupied slots
-    BOOST_ASSERT(not free_slots_.contains(handle));
-    auto &entry = pool_[handle];
-    // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-    return ++entry.ref_count;
+    return ++entry->ref_count;
   }
 
   MessagePool::RefCount MessagePool::release(MessageHandle handle) {
-    bool handle_is_valid =
-        (handle < pool_.size()) and not free_slots_.contains(handle);
-    if (not handle_is_valid) {
+    auto entry = occupied(handle);
+    if (not entry) {
       return 0;  // zero references for bad handle
     }
-    std::lock_guard lock(mutex_);
-    auto &entry = pool_[handle];
-    if (entry.ref_count > 0 and --entry.ref_count == 0) {
-      memset(entry.data.data(), '\0', entry.data.size());
-      entry.data_size = 0;
-      free_slots_.emplace(handle);
+    auto refs = entry->ref_count.load(std::memory_order_relaxed);
+    // decrement only positive counter, to not free slot twice
+    while (refs > 0
+           and not entry->ref_count.compare_exchange_weak(
+               refs, refs - 1, std::memory_order_acq_rel)) {
     }
-    // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-    return entry.ref_count;
+    return refs > 0 ? refs - 1 : 0;
   }
 
   boost::asio::mutable_buffer MessagePool::operator[](
       MessageHandle handle) const {
-    bool handle_is_valid =
-        (handle < pool_.size()) and not free_slots_.contains(handle);
-    if (not handle_is_valid) {
+    auto entry = occupied(handle);
+    if (not entry) {
       throw std::runtime_error("Bad access through invalid handle");
     }
     // No synchronization required due to the design of its use way.
@@ -94,23 +77,34 @@ namespace kagome::telemetry {
     // The buffer will remain valid till all holders request its release.
     // The handle cannot be reassigned prior to complete release.
     // => There is no chance to get dangling pointers inside boost buffers.
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-    auto &entry = const_cast<Record &>(pool_[handle]);
-    return boost::asio::buffer(entry.data.data(), entry.data_size);
+    return boost::asio::buffer(entry->data.data(), entry->data_size);
   }
 
   std::size_t MessagePool::capacity() const {
     return entries_count_;
   }
 
-  std::optional<MessageHandle> MessagePool::nextFreeSlot() {
-    std::lock_guard lock(mutex_);
-    if (free_slots_.empty()) {
-      return std::nullopt;
+  MessagePool::Record *MessagePool::occupied(MessageHandle handle) const {
+    if (handle >= entries_count_) {
+      return nullptr;
     }
-    auto free_slot = free_slots_.begin();
-    auto slot = *free_slot;
-    free_slots_.erase(free_slot);
-    return slot;
+    auto &entry = pool_[handle];
+    if (entry.ref_count.load(std::memory_order_acquire) <= 0) {
+      return nullptr;
+    }
+    return &entry;
+  }
+
+  std::optional<MessageHandle> MessagePool::nextFreeSlot(RefCount ref_count) {
+    for (size_t i = 0; i < entries_count_; ++i) {
+      auto slot =
+          cursor_.fetch_add(1, std::memory_order_relaxed) % entries_count_;
+      RefCount free = 0;
+      if (pool_[slot].ref_count.compare_exchange_strong(
+              free, ref_count, std::memory_order_acquire)) {
+        return slot;
+      }
+    }
+    return std::nullopt;
   }
 }  // namespace kagome::telemetry
@@ -6,14 +6,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <optional>
-#include <string>
-#include <unordered_set>
+#include <string_view>
+#include <vector>
 
 #include <boost/asio/buffer.hpp>
-#include "common/spin_lock.hpp"
 
 namespace kagome::telemetry {
 
@@ -28,10 +29,10 @@ namespace kagome::telemetry {
    * construction.
    * All the copy operations are performed in a fastest manner via memcpy.
    *
-   * Access operations to shared data where data race is possible are
-   * synchronized via spin locks. Locking is performed for a smallest possible
-   * set of lines of code. Spin locks let us avoid expensive context switches
-   * and performance degradation.
+   * The pool is lock-free. Slots form a ring, a producer claims the next
+   * free slot by CAS of its reference counter from zero, so pushing and
+   * releasing from different threads never waits. Slot is free again when
+   * its reference counter drops to zero.
    */
   class MessagePool {
    public:
@@ -59,8 +60,8 @@ namespace kagome::telemetry {
      * Note: the record will be freed from the pool as soon as an handle-owner
      * calls the release method for the handle ref_count-many times
      */
-    std::optional<MessageHandle> push(const std::string &message,
-                                      int16_t ref_count);
+    std::optional<MessageHandle> push(std::string_view message,
+                                      RefCount ref_count);
 
     /**
      * Increase reference counter for the specified handle
@@ -93,20 +94,23 @@ namespace kagome::telemetry {
     std::size_t capacity() const;
 
    private:
-    /// performs quick lookup for a free slot
-    std::optional<MessageHandle> nextFreeSlot();
-
     struct Record {
       std::vector<uint8_t> data;
       std::size_t data_size = 0;
-      std::size_t ref_count = 0;
+      /// zero for free slot
+      std::atomic<RefCount> ref_count = 0;
     };
 
+    /// claims free slot, starting from the ring cursor
+    std::optional<MessageHandle> nextFreeSlot(RefCount ref_count);
+
+    /// @return record of occupied slot or nullptr for bad handle
+    Record *occupied(MessageHandle handle) const;
+
     const std::size_t entry_size_;
     const std::size_t entries_count_;
-    std::vector<Record> pool_;
-    std::unordered_set<std::size_t> free_slots_;
-    common::spin_lock mutex_;
+    std::unique_ptr<Record[]> pool_;
+    std::atomic_size_t cursor_ = 0;
   };
 
 }  // namespace kagome::telemetry
@@ -341,25 +341,33 @@ namespace kagome::telemetry {
     }
     std::optional<MessageHandle> last_imported_msg, last_finalized_msg;
     auto refs = connections_.size();
+    std::optional<std::pair<primitives::BlockInfo, BlockOrigin>> imported;
+    std::optional<primitives::BlockInfo> finalized;
     {
-      // do quick information retrieval under spin lock
+      // do quick information retrieval under spin lock,
+      // json is composed after it to not block block import
       std::lock_guard lock(cache_mutex_);
-      // prepare last imported block message
       if (last_imported_.is_set) {
         last_imported_.is_set = false;
-        auto msg =
-            blockNotification(last_imported_.block, last_imported_.origin);
-        // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-        last_imported_msg = message_pool_->push(msg, refs);
+        imported.emplace(last_imported_.block, last_imported_.origin);
       }
       // prepare last finalized message if there is a need to
       if (last_finalized_.reported < last_finalized_.block.number) {
-        auto msg = blockNotification(last_finalized_.block, std::nullopt);
-        // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
-        last_finalized_msg = message_pool_->push(msg, refs);
+        finalized = last_finalized_.block;
         last_finalized_.reported = last_finalized_.block.number;
       }
     }
+    // json is composed once and shared by all connections
+    if (imported) {
+      auto msg = blockNotification(imported->first, imported->second);
+      // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
+      last_imported_msg = message_pool_->push(msg, refs);
+    }
+    if (finalized) {
+      auto msg = blockNotification(*finalized, std::nullopt);
+      // NOLINTNEXTLINE(cppcoreguidelines-narrowing-conversions)
+      last_finalized_msg = message_pool_->push(msg, refs);
+    }
     for (auto &conn : connections_) {
       if (last_imported_msg) {
         conn->send(*last_imported_msg);
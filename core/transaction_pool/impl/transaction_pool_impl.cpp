@@ -6,11 +6,16 @@
 
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
+#include <boost/asio/post.hpp>
+
+#include "blockchain/block_storage.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "crypto/hasher.hpp"
 #include "network/transactions_transmitter.hpp"
 #include "primitives/block_id.hpp"
 #include "runtime/runtime_api/tagged_transaction_queue.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
+#include "utils/parallel_for.hpp"
 
 using kagome::primitives::BlockNumber;
 using kagome::primitives::Transaction;
@@ -31,19 +36,26 @@ namespace kagome::transaction_pool {
       std::shared_ptr<network::TransactionsTransmitter> tx_transmitter,
       std::unique_ptr<PoolModerator> moderator,
       std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
       std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
           sub_engine,
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository> ext_key_repo,
+      common::WorkerThreadPool &worker_thread_pool,
+      primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
       Limits limits)
       : header_repo_{std::move(header_repo)},
+        block_storage_{std::move(block_storage)},
         sub_engine_{std::move(sub_engine)},
         ext_key_repo_{std::move(ext_key_repo)},
         ttq_{std::move(ttq)},
         hasher_{std::move(hasher)},
         tx_transmitter_{std::move(tx_transmitter)},
         moderator_{std::move(moderator)},
-        limits_{limits} {
+        limits_{limits},
+        worker_io_{worker_thread_pool.io_context()},
+        chain_sub_{std::move(chain_sub_engine)} {
     BOOST_ASSERT_MSG(header_repo_ != nullptr, "header repo is nullptr");
+    BOOST_ASSERT_MSG(block_storage_ != nullptr, "block storage is nullptr");
     BOOST_ASSERT_MSG(ttq_ != nullptr, "tagged-transaction queue is nullptr");
     BOOST_ASSERT_MSG(hasher_ != nullptr, "hasher is nullptr");
     BOOST_ASSERT_MSG(tx_transmitter_ != nullptr, "tx_transmitter is nullptr");
@@ -59,6 +71,23 @@ namespace kagome::transaction_pool {
     metric_ready_txs_ =
         metrics_registry_->registerGaugeMetric(readyTransactionsMetricName);
     metric_ready_txs_->set(0);
+
+    // subscription is owned by this
+    chain_sub_.onHead([this](const primitives::BlockHeader &header) {
+      new_heads_.exclusiveAccess(
+          [&](std::vector<primitives::BlockHash> &heads) {
+            heads.emplace_back(header.hash());
+          });
+      if (revalidating_.test_and_set()) {
+        return;
+      }
+      boost::asio::post(*worker_io_, [weak{weak_from_this()}] {
+        if (auto self = weak.lock()) {
+          self->revalidate();
+          self->revalidating_.clear();
+        }
+      });
+    });
   }
 
   outcome::result<primitives::Transaction>
@@ -92,17 +121,18 @@ namespace kagome::transaction_pool {
         },
         [&](primitives::ValidTransaction &&v)
             -> outcome::result<primitives::Transaction> {
-          size_t length = extrinsic.data.size();
+          auto bytes = primitives::encodedSize(extrinsic);
 
           return primitives::Transaction{
               .ext = extrinsic,
-              .bytes = length,
+              .bytes = bytes,
               .hash = extrinsic_hash,
               .priority = v.priority,
               .valid_till = res.first.number + v.longevity,
               .required_tags = std::move(v.required_tags),
               .provided_tags = std::move(v.provided_tags),
-              .should_propagate = v.propagate};
+              .should_propagate = v.propagate,
+              .source = source};
         });
   }
 
@@ -132,6 +162,156 @@ namespace kagome::transaction_pool {
     return hash;
   }
 
+  std::vector<outcome::result<Transaction::Hash>>
+  TransactionPoolImpl::submitExtrinsics(
+      primitives::TransactionSource source,
+      std::vector<primitives::Extrinsic> extrinsics) {
+    std::vector<Transaction::Hash> hashes;
+    hashes.reserve(extrinsics.size());
+    std::vector<std::optional<outcome::result<Transaction>>> txs(
+        extrinsics.size());
+    // repeated extrinsics of batch are validated once
+    std::unordered_set<Transaction::Hash> unique;
+    for (size_t i = 0; i < extrinsics.size(); ++i) {
+      hashes.emplace_back(hasher_->blake2b_256(extrinsics[i].data));
+      if (not unique.emplace(hashes[i]).second or imported(hashes[i])) {
+        txs[i] = TransactionPoolError::TX_ALREADY_IMPORTED;
+      }
+    }
+
+    // runtime calls dominate, so each extrinsic is a separate work item,
+    // calls at same block share its state
+    parallelFor(
+        *worker_io_, kMaxValidationTasks, extrinsics.size(), [&](size_t i) {
+          if (not txs[i]) {
+            txs[i] = constructTransaction(source, extrinsics[i], hashes[i]);
+          }
+        });
+
+    std::vector<outcome::result<Transaction::Hash>> results;
+    results.reserve(extrinsics.size());
+    for (size_t i = 0; i < extrinsics.size(); ++i) {
+      auto &tx = *txs[i];
+      if (not tx) {
+        results.emplace_back(tx.error());
+        continue;
+      }
+      // same extrinsic may be imported by other submission meanwhile
+      if (imported(hashes[i])) {
+        results.emplace_back(TransactionPoolError::TX_ALREADY_IMPORTED);
+        continue;
+      }
+      if (tx.value().should_propagate) {
+        tx_transmitter_->propagateTransaction(tx.value());
+      }
+      auto res = submitOneInternal(
+          std::make_shared<Transaction>(std::move(tx.value())));
+      if (not res) {
+        results.emplace_back(res.error());
+        continue;
+      }
+      results.emplace_back(hashes[i]);
+    }
+    return results;
+  }
+
+  void TransactionPoolImpl::takeIncluded(
+      std::unordered_set<Transaction::Hash> &included) {
+    auto heads = new_heads_.exclusiveAccess(
+        [](std::vector<primitives::BlockHash> &heads) {
+          return std::exchange(heads, {});
+        });
+    for (auto &head : heads) {
+      auto body = block_storage_->getBlockBody(head);
+      if (not body or not body.value()) {
+        continue;
+      }
+      for (auto &ext : *body.value()) {
+        included.emplace(hasher_->blake2b_256(ext.data));
+      }
+    }
+  }
+
+  void TransactionPoolImpl::revalidate() {
+    // extrinsics of new heads are not removed from pool yet
+    std::unordered_set<Transaction::Hash> included;
+    takeIncluded(included);
+
+    // next batch by hash after cursor, wrapping around
+    std::vector<std::shared_ptr<const Transaction>> batch;
+    pool_state_.sharedAccess([&](const PoolState &pool_state) {
+      std::vector<std::shared_ptr<const Transaction>> after, before;
+      for (const auto &[hash, ready_status] : pool_state.ready_txs_) {
+        if (included.contains(hash)) {
+          continue;
+        }
+        auto &part = revalidation_cursor_ and hash <= *revalidation_cursor_
+                       ? before
+                       : after;
+        part.emplace_back(ready_status.tx);
+      }
+      auto take = [&](std::vector<std::shared_ptr<const Transaction>> &txs) {
+        auto n = std::min(txs.size(), kRevalidationBatchSize - batch.size());
+        auto by_hash = [](const auto &l, const auto &r) {
+          return l->hash < r->hash;
+        };
+        std::partial_sort(txs.begin(), txs.begin() + n, txs.end(), by_hash);
+        batch.insert(batch.end(), txs.begin(), txs.begin() + n);
+      };
+      take(after);
+      take(before);
+    });
+    if (batch.empty()) {
+      return;
+    }
+    revalidation_cursor_ = batch.back()->hash;
+
+    using ValidityAt = runtime::TaggedTransactionQueue::TransactionValidityAt;
+    std::vector<std::optional<outcome::result<ValidityAt>>> results(
+        batch.size());
+    parallelFor(
+        *worker_io_, kMaxValidationTasks, batch.size(), [&](size_t i) {
+          results[i] =
+              ttq_->validate_transaction(batch[i]->source, batch[i]->ext);
+        });
+
+    // heads imported during validation
+    takeIncluded(included);
+
+    size_t removed = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+      // runtime call errors and unknown validity keep transaction
+      auto &result = *results[i];
+      if (not result) {
+        continue;
+      }
+      auto error = boost::get<primitives::TransactionValidityError>(
+          &result.value().second);
+      if (error == nullptr
+          or boost::get<primitives::InvalidTransaction>(error) == nullptr) {
+        continue;
+      }
+      auto &hash = batch[i]->hash;
+      if (included.contains(hash)) {
+        continue;
+      }
+      if (not removeOne(hash)) {
+        continue;
+      }
+      moderator_->ban(hash);
+      ++removed;
+      if (auto key = ext_key_repo_->get(hash); key.has_value()) {
+        sub_engine_->notify(key.value(),
+                            ExtrinsicLifecycleEvent::Invalid(key.value()));
+        ext_key_repo_->remove(hash);
+      }
+    }
+    SL_DEBUG(logger_,
+             "Revalidated {} ready transactions, {} became invalid",
+             batch.size(),
+             removed);
+  }
+
   outcome::result<void> TransactionPoolImpl::submitOne(Transaction &&tx) {
     if (imported(tx.hash)) {
       return TransactionPoolError::TX_ALREADY_IMPORTED;
@@ -225,6 +405,7 @@ namespace kagome::transaction_pool {
     } else {
       if (auto it = pool_state.ready_txs_.find(tx_hash);
           it != pool_state.ready_txs_.end()) {
+        unsetReady(pool_state, it->second);
         ReadyStatus ready_status{std::move(it->second)};
         auto state = std::make_shared<TxReadyState>(std::move(ready_status.tx));
 
@@ -284,6 +465,7 @@ namespace kagome::transaction_pool {
           if (auto it = pool_state.ready_txs_.find(tx_hash);
               it != pool_state.ready_txs_.end()) {
             ReadyStatus &ready_status = it->second;
+            unsetReady(pool_state, ready_status);
             for (auto &provider : ready_status.tx->provided_tags) {
               PendingStatus &ps = pool_state.dependency_graph_[provider];
               // TODO(kamilsa): Uncomment when #1786 is fixed
@@ -385,6 +567,27 @@ namespace kagome::transaction_pool {
     if (auto [it, ok] =
             pool_state.ready_txs_.emplace(tx->hash, ReadyStatus{.tx = tx});
         ok) {
+      // reference stays valid when recursive calls rehash the map
+      auto &ready = it->second;
+      ready.insertion_id = pool_state.next_insertion_id_++;
+      for (const auto &tag : tx->required_tags) {
+        auto tag_it = pool_state.dependency_graph_.find(tag);
+        if (tag_it == pool_state.dependency_graph_.end()
+            or not tag_it->second.provider
+            or *tag_it->second.provider == tx->hash) {
+          continue;
+        }
+        auto &provider = *tag_it->second.provider;
+        if (auto provider_it = pool_state.ready_txs_.find(provider);
+            provider_it != pool_state.ready_txs_.end()) {
+          ready.requires_ready.emplace(provider);
+          provider_it->second.unlocks.emplace(tx->hash);
+        }
+      }
+      if (ready.requires_ready.empty()) {
+        pool_state.best_.emplace(ready.key());
+      }
+
       if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
         sub_engine_->notify(key.value(),
                             ExtrinsicLifecycleEvent::Ready(key.value()));
@@ -393,12 +596,13 @@ namespace kagome::transaction_pool {
       for (const auto &tag : tx->provided_tags) {
         PendingStatus &status = pool_state.dependency_graph_[tag];
         status.tag_provided = true;
+        status.provider = tx->hash;
 
         for (auto &dep : status.dependents) {
           auto dependent = std::move(dep.second);
           if (dependent) {
             BOOST_ASSERT(dependent->tx);
-            it->second.triggered.emplace_back(dependent->tx->hash);
+            ready.triggered.emplace_back(dependent->tx->hash);
             if (--dependent->remains_required_txs_count == 0ull) {
               pool_state.pending_txs_.erase(dependent->tx->hash);
               setReady(pool_state, dependent->tx);
@@ -411,6 +615,122 @@ namespace kagome::transaction_pool {
     }
   }
 
+  void TransactionPoolImpl::unsetReady(PoolState &pool_state,
+                                       const ReadyStatus &ready_status) {
+    const auto &hash = ready_status.tx->hash;
+    for (const auto &provider : ready_status.requires_ready) {
+      if (auto it = pool_state.ready_txs_.find(provider);
+          it != pool_state.ready_txs_.end()) {
+        it->second.unlocks.erase(hash);
+      }
+    }
+    for (const auto &dependent : ready_status.unlocks) {
+      if (auto it = pool_state.ready_txs_.find(dependent);
+          it != pool_state.ready_txs_.end()) {
+        auto &requires_ready = it->second.requires_ready;
+        if (requires_ready.erase(hash) != 0 and requires_ready.empty()) {
+          pool_state.best_.emplace(it->second.key());
+        }
+      }
+    }
+    pool_state.best_.erase(ready_status.key());
+    for (const auto &tag : ready_status.tx->provided_tags) {
+      if (auto it = pool_state.dependency_graph_.find(tag);
+          it != pool_state.dependency_graph_.end()
+          and it->second.provider == hash) {
+        it->second.provider.reset();
+      }
+    }
+  }
+
+  /**
+   * Walks `best_` by key cursor, taking shared lock only for each step, so
+   * pool may be changed between steps. Dependent transaction is unlocked
+   * when all its ready dependencies were yielded.
+   */
+  class TransactionPoolImpl::ReadyIterator : public ReadyTransactionsIterator {
+   public:
+    explicit ReadyIterator(const TransactionPoolImpl &pool) : pool_{pool} {}
+
+    std::shared_ptr<const Transaction> next() override {
+      return pool_.pool_state_.sharedAccess(
+          [&](const PoolState &pool_state)
+              -> std::shared_ptr<const Transaction> {
+            if (last_ and not last_invalid_) {
+              unlock(pool_state, last_->hash);
+            }
+            last_.reset();
+            last_invalid_ = false;
+            while (true) {
+              auto best_it = cursor_ ? pool_state.best_.upper_bound(*cursor_)
+                                     : pool_state.best_.begin();
+              auto unlocked_it = unlocked_.begin();
+              auto has_best = best_it != pool_state.best_.end();
+              auto has_unlocked = unlocked_it != unlocked_.end();
+              if (not has_best and not has_unlocked) {
+                return nullptr;
+              }
+              ReadyKey key{};
+              if (has_best and (not has_unlocked or *best_it < *unlocked_it)) {
+                key = *best_it;
+                cursor_ = key;
+              } else {
+                key = *unlocked_it;
+                unlocked_.erase(unlocked_it);
+              }
+              auto it = pool_state.ready_txs_.find(key.hash);
+              if (it == pool_state.ready_txs_.end()
+                  or not yielded_.emplace(key.hash).second) {
+                continue;
+              }
+              last_ = it->second.tx;
+              return last_;
+            }
+          });
+    }
+
+    void reportInvalid() override {
+      last_invalid_ = true;
+    }
+
+   private:
+    void unlock(const PoolState &pool_state, const Transaction::Hash &hash) {
+      auto it = pool_state.ready_txs_.find(hash);
+      if (it == pool_state.ready_txs_.end()) {
+        return;
+      }
+      for (const auto &dependent : it->second.unlocks) {
+        auto dependent_it = pool_state.ready_txs_.find(dependent);
+        if (dependent_it == pool_state.ready_txs_.end()
+            or yielded_.contains(dependent)) {
+          continue;
+        }
+        auto [awaiting_it, _] = awaiting_.try_emplace(
+            dependent, dependent_it->second.requires_ready.size());
+        if (--awaiting_it->second == 0) {
+          unlocked_.emplace(dependent_it->second.key());
+          awaiting_.erase(awaiting_it);
+        }
+      }
+    }
+
+    const TransactionPoolImpl &pool_;
+    /// last key taken from `best_`
+    std::optional<ReadyKey> cursor_;
+    /// dependents with all ready dependencies yielded
+    std::set<ReadyKey> unlocked_;
+    /// dependents with some ready dependencies not yielded yet
+    std::unordered_map<Transaction::Hash, size_t> awaiting_;
+    std::unordered_set<Transaction::Hash> yielded_;
+    std::shared_ptr<const Transaction> last_;
+    bool last_invalid_ = false;
+  };
+
+  std::unique_ptr<ReadyTransactionsIterator>
+  TransactionPoolImpl::readyTransactions() const {
+    return std::make_unique<ReadyIterator>(*this);
+  }
+
   TransactionPoolImpl::Status TransactionPoolImpl::getStatus() const {
     return pool_state_.sharedAccess([&](const auto &pool_state) {
       return Status{pool_state.ready_txs_.size(),
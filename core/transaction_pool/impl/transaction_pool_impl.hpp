@@ -7,6 +7,9 @@
 #pragma once
 
 #include <deque>
+#include <set>
+#include <unordered_set>
+
 #include <libp2p/common/byteutil.hpp>
 
 #include "blockchain/block_header_repository.hpp"
@@ -20,6 +23,17 @@
 #include "transaction_pool/transaction_pool.hpp"
 #include "utils/safe_object.hpp"
 
+namespace boost::asio {
+  class io_context;
+}
+namespace kagome::common {
+  class WorkerThreadPool;
+}
+
+namespace kagome::blockchain {
+  class BlockStorage;
+}
+
 namespace kagome::runtime {
   class TaggedTransactionQueue;
 }
@@ -32,20 +46,31 @@ namespace kagome::network {
 
 namespace kagome::transaction_pool {
 
-  class TransactionPoolImpl : public TransactionPool {
+  class TransactionPoolImpl
+      : public TransactionPool,
+        public std::enable_shared_from_this<TransactionPoolImpl> {
    public:
+    /// Ready transactions revalidated after each new head
+    static constexpr size_t kRevalidationBatchSize = 256;
+
+    /// Worker tasks used to validate one batch
+    static constexpr size_t kMaxValidationTasks = 8;
+
     TransactionPoolImpl(
         std::shared_ptr<runtime::TaggedTransactionQueue> ttq,
         std::shared_ptr<crypto::Hasher> hasher,
         std::shared_ptr<network::TransactionsTransmitter> tx_transmitter,
         std::unique_ptr<PoolModerator> moderator,
         std::shared_ptr<blockchain::BlockHeaderRepository> header_repo,
+        std::shared_ptr<blockchain::BlockStorage> block_storage,
         std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
             sub_engine,
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository> ext_key_repo,
+        common::WorkerThreadPool &worker_thread_pool,
+        primitives::events::ChainSubscriptionEnginePtr chain_sub_engine,
         Limits limits);
 
-    TransactionPoolImpl(TransactionPoolImpl &&) = default;
+    TransactionPoolImpl(TransactionPoolImpl &&) = delete;
     TransactionPoolImpl(const TransactionPoolImpl &) = delete;
 
     ~TransactionPoolImpl() override = default;
@@ -59,6 +84,10 @@ namespace kagome::transaction_pool {
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic) override;
 
+    std::vector<outcome::result<Transaction::Hash>> submitExtrinsics(
+        primitives::TransactionSource source,
+        std::vector<primitives::Extrinsic> extrinsics) override;
+
     outcome::result<void> submitOne(Transaction &&tx) override;
 
     outcome::result<Transaction> removeOne(
@@ -69,6 +98,9 @@ namespace kagome::transaction_pool {
         std::pair<Transaction::Hash, std::shared_ptr<const Transaction>>>
     getReadyTransactions() const override;
 
+    std::unique_ptr<ReadyTransactionsIterator> readyTransactions()
+        const override;
+
     outcome::result<std::vector<Transaction>> removeStale(
         const primitives::BlockId &at) override;
 
@@ -107,13 +139,38 @@ namespace kagome::transaction_pool {
 
     struct PendingStatus {
       bool tag_provided{false};
+      /// ready transaction providing the tag
+      std::optional<Transaction::Hash> provider{};
       std::unordered_map<Transaction::Hash, std::shared_ptr<TxReadyState>>
           dependents{};
     };
 
+    /// Orders ready transactions: higher priority first, then older first
+    struct ReadyKey {
+      Transaction::Priority priority;
+      uint64_t insertion_id;
+      Transaction::Hash hash;
+
+      bool operator<(const ReadyKey &other) const {
+        if (priority != other.priority) {
+          return priority > other.priority;
+        }
+        return insertion_id < other.insertion_id;
+      }
+    };
+
     struct ReadyStatus {
       std::shared_ptr<Transaction> tx;
       std::deque<Transaction::Hash> triggered;
+      uint64_t insertion_id{};
+      /// ready transactions providing tags required by this one
+      std::unordered_set<Transaction::Hash> requires_ready{};
+      /// ready transactions requiring tags provided by this one
+      std::unordered_set<Transaction::Hash> unlocks{};
+
+      ReadyKey key() const {
+        return {tx->priority, insertion_id, tx->hash};
+      }
     };
 
     struct PoolState {
@@ -124,8 +181,14 @@ namespace kagome::transaction_pool {
 
       /// Collection transaction with full-satisfied dependencies
       std::unordered_map<Transaction::Hash, ReadyStatus> ready_txs_;
+
+      /// Ready transactions without ready dependencies, best first
+      std::set<ReadyKey> best_;
+      uint64_t next_insertion_id_ = 0;
     };
 
+    class ReadyIterator;
+
     bool imported(const Transaction::Hash &tx_hash) const;
     bool is_ready(const PoolState &pool_state,
                   const std::shared_ptr<const Transaction> &tx) const;
@@ -142,12 +205,22 @@ namespace kagome::transaction_pool {
     void setReady(PoolState &pool_state,
                   const std::shared_ptr<Transaction> &tx);
 
+    /// Unlinks ready transaction from ready index before erasing
+    void unsetReady(PoolState &pool_state, const ReadyStatus &ready_status);
+
     outcome::result<Transaction> constructTransaction(
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic,
         const Transaction::Hash &extrinsic_hash) const;
 
+    /// Revalidates next batch of ready transactions against best block
+    void revalidate();
+
+    /// Adds hashes of extrinsics of new heads seen since last call
+    void takeIncluded(std::unordered_set<Transaction::Hash> &included);
+
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
+    std::shared_ptr<blockchain::BlockStorage> block_storage_;
 
     log::Logger logger_ = log::createLogger("TransactionPool", "transactions");
 
@@ -165,6 +238,16 @@ namespace kagome::transaction_pool {
     SafeObject<PoolState> pool_state_;
     Limits limits_;
 
+    std::shared_ptr<boost::asio::io_context> worker_io_;
+    primitives::events::ChainSub chain_sub_;
+    /// one revalidation at a time, new heads arriving meanwhile are skipped
+    std::atomic_flag revalidating_;
+    /// last revalidated hash, batches walk ready transactions by hash
+    std::optional<Transaction::Hash> revalidation_cursor_;
+    /// New heads, whose extrinsics are removed from pool after head event by
+    /// block executor, so revalidation must not ban them
+    SafeObject<std::vector<primitives::BlockHash>> new_heads_;
+
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Gauge *metric_ready_txs_;
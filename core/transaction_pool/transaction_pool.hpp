@@ -16,6 +16,25 @@ namespace kagome::transaction_pool {
 
   using primitives::Transaction;
 
+  /**
+   * Lazily yields ready transactions, higher priority first, older first
+   * among equal priorities. Transaction is yielded only after all ready
+   * transactions providing its required tags.
+   */
+  class ReadyTransactionsIterator {
+   public:
+    virtual ~ReadyTransactionsIterator() = default;
+
+    /// @return next ready transaction, or nullptr when there are no more
+    virtual std::shared_ptr<const Transaction> next() = 0;
+
+    /**
+     * Last yielded transaction was not included, so transactions depending
+     * on it are not yielded
+     */
+    virtual void reportInvalid() = 0;
+  };
+
   class TransactionPool {
    public:
     struct Status;
@@ -43,6 +62,16 @@ namespace kagome::transaction_pool {
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic) = 0;
 
+    /**
+     * Validates extrinsics in parallel and submits valid ones into pool
+     * @param source how extrinsics were received
+     * @param extrinsics batch of extrinsics, e.g. from one network message
+     * @return result of submission for each extrinsic, in same order
+     */
+    virtual std::vector<outcome::result<Transaction::Hash>> submitExtrinsics(
+        primitives::TransactionSource source,
+        std::vector<primitives::Extrinsic> extrinsics) = 0;
+
     /**
      * Import one verified transaction to the pool. If it has unresolved
      * dependencies (requires tags of transactions that are not in the pool
@@ -69,6 +98,13 @@ namespace kagome::transaction_pool {
         std::pair<Transaction::Hash, std::shared_ptr<const Transaction>>>
     getReadyTransactions() const = 0;
 
+    /**
+     * @return iterator over ready transactions in order of inclusion into
+     * block, pool is not copied
+     */
+    virtual std::unique_ptr<ReadyTransactionsIterator> readyTransactions()
+        const = 0;
+
     /**
      * Remove from the pool and temporarily ban transactions which longevity is
      * expired
@@ -0,0 +1,93 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+namespace kagome {
+  /**
+   * Calls `f(i)` for each `i` in `[0, count)`.
+   * Items are handled by calling thread and by up to `max_tasks` tasks posted
+   * to `io`, returns when all items are done.
+   * Calling thread handles items too, so it doesn't deadlock when called from
+   * `io` thread or when `io` is busy.
+   * First exception thrown by `f` is rethrown, remaining items are skipped.
+   */
+  inline void parallelFor(boost::asio::io_context &io,
+                          size_t max_tasks,
+                          size_t count,
+                          const std::function<void(size_t)> &f) {
+    const auto tasks = count == 0 ? 0 : std::min(count - 1, max_tasks);
+    if (tasks == 0) {
+      for (size_t i = 0; i < count; ++i) {
+        f(i);
+      }
+      return;
+    }
+
+    // Shared with tasks, which may start after all items are done.
+    // Such tasks find no items left and don't touch `f`.
+    struct Shared {
+      std::atomic_size_t next = 0;
+      std::mutex mutex;
+      std::condition_variable cv;
+      size_t done = 0;
+      std::exception_ptr error;
+    };
+    auto shared = std::make_shared<Shared>();
+
+    auto work = [&f, count](Shared &shared) {
+      while (true) {
+        auto i = shared.next.fetch_add(1);
+        if (i >= count) {
+          return;
+        }
+        std::exception_ptr error;
+        try {
+          f(i);
+        } catch (...) {
+          error = std::current_exception();
+        }
+        std::unique_lock lock{shared.mutex};
+        ++shared.done;
+        if (error) {
+          if (not shared.error) {
+            shared.error = error;
+          }
+          // items which were not taken yet are skipped
+          auto skipped = shared.next.exchange(count);
+          if (skipped < count) {
+            shared.done += count - skipped;
+          }
+        }
+        if (shared.done == count) {
+          shared.cv.notify_one();
+        }
+      }
+    };
+
+    for (size_t i = 0; i < tasks; ++i) {
+      boost::asio::post(io, [shared, work] { work(*shared); });
+    }
+    work(*shared);
+
+    std::unique_lock lock{shared->mutex};
+    shared->cv.wait(lock, [&] { return shared->done == count; });
+    if (shared->error) {
+      std::rethrow_exception(shared->error);
+    }
+  }
+}  // namespace kagome
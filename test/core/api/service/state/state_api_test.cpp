@@ -16,11 +16,14 @@
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/runtime/metadata_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
 #include "mock/core/runtime/runtime_context_factory_mock.hpp"
+#include "mock/core/storage/trie/serialization/codec_mock.hpp"
+#include "mock/core/storage/trie/serialization/trie_serializer_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
-#include "runtime/executor.hpp"
+#include "runtime/common/concurrent_call_executor.hpp"
 #include "runtime/runtime_context.hpp"
 #include "testutil/lazy.hpp"
 #include "testutil/literals.hpp"
@@ -35,7 +38,7 @@ using kagome::primitives::BlockHeader;
 using kagome::primitives::BlockInfo;
 using kagome::primitives::BlockNumber;
 using kagome::runtime::CoreMock;
-using kagome::runtime::Executor;
+using kagome::runtime::ConcurrentCallExecutor;
 using kagome::runtime::MetadataMock;
 using kagome::storage::trie::TrieBatchMock;
 using kagome::storage::trie::TrieStorageMock;
@@ -55,11 +58,21 @@ namespace kagome::api {
     };
   }
 
+  std::shared_ptr<ConcurrentCallExecutor> makeCallExecutor(
+      std::shared_ptr<BlockTreeMock> block_tree) {
+    return std::make_shared<ConcurrentCallExecutor>(
+        std::make_shared<runtime::ModuleRepositoryMock>(),
+        std::make_shared<runtime::RuntimeContextFactoryMock>(),
+        std::move(block_tree),
+        std::make_shared<storage::trie::CodecMock>(),
+        std::make_shared<storage::trie::TrieSerializerMock>(),
+        std::chrono::seconds{1});
+  }
+
   class StateApiTest : public ::testing::Test {
    public:
     void SetUp() override {
-      executor_ = std::make_shared<Executor>(
-          std::make_shared<kagome::runtime::RuntimeContextFactoryMock>());
+      executor_ = makeCallExecutor(block_tree_);
       api_ = std::make_unique<api::StateApiImpl>(
           storage_,
           block_tree_,
@@ -78,7 +91,7 @@ namespace kagome::api {
     std::shared_ptr<MetadataMock> metadata_ = std::make_shared<MetadataMock>();
     std::shared_ptr<ApiServiceMock> api_service_ =
         std::make_shared<ApiServiceMock>();
-    std::shared_ptr<Executor> executor_;
+    std::shared_ptr<ConcurrentCallExecutor> executor_;
 
     std::unique_ptr<api::StateApiImpl> api_{};
   };
@@ -123,8 +136,7 @@ namespace kagome::api {
 
       auto runtime_core = std::make_shared<CoreMock>();
       auto metadata = std::make_shared<MetadataMock>();
-      auto executor = std::make_shared<Executor>(
-          std::make_shared<runtime::RuntimeContextFactoryMock>());
+      auto executor = makeCallExecutor(block_tree_);
 
       api_ = std::make_shared<api::StateApiImpl>(
           storage,
@@ -151,6 +151,15 @@ class StateJrpcProcessorTest : public testing::Test {
           call_contexts_.emplace(std::make_pair(CallType::kCallType_GetMetadata,
                                                 CallContext{.handler = f}));
         }));
+    for (auto name : {"state_subscribeRuntimeVersion",
+                      "state_unsubscribeRuntimeVersion",
+                      "state_subscribeStorage",
+                      "state_unsubscribeStorage"}) {
+      EXPECT_CALL(*server, markOrdered(name));
+    }
+    EXPECT_CALL(*server, registerStreamHandler("state_getKeysPaged", _, _));
+    EXPECT_CALL(*server, registerStreamHandler("state_getReadProof", _, _));
+    EXPECT_CALL(*server, registerStreamHandler("state_getMetadata", _, _));
     processor.registerHandlers();
   }
 
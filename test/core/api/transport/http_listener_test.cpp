@@ -10,6 +10,8 @@
 #include <backward.hpp>
 #endif
 
+#include <zstd.h>
+
 #include "api/transport/impl/ws/ws_listener_impl.hpp"
 #include "core/api/client/http_client.hpp"
 
@@ -90,3 +92,113 @@ TEST_F(HttpListenerTest, EchoSuccess) {
   asio_runner->join();
   watchdog_thread.join();
 }
+
+/**
+ * Runs service and `client` on separate thread, then shuts service down.
+ */
+struct HttpListenerClientTest : HttpListenerTest {
+  void run(std::function<void(Context &)> client) {
+    std::unique_ptr<std::thread> asio_runner;
+    app_state_manager->atLaunch([&] {
+      asio_runner = std::make_unique<std::thread>(
+          [ctx{main_context}, watchdog{watchdog}] { watchdog->run(ctx); });
+      return true;
+    });
+    std::thread watchdog_thread([watchdog{watchdog}] {
+      watchdog->checkLoop(kagome::kWatchdogDefaultTimeout);
+    });
+    app_state_manager->atShutdown([watchdog{watchdog}] { watchdog->stop(); });
+
+    std::unique_ptr<std::thread> client_thread;
+    post(*main_context, [&] {
+      client_thread = std::make_unique<std::thread>([&] {
+        std::this_thread::sleep_for(1s);  // Gives chance app to be started
+        Context local_context;
+        client(local_context);
+        app_state_manager->shutdown();
+      });
+    });
+
+    app_state_manager->run();
+
+    client_thread->join();
+    asio_runner->join();
+    watchdog_thread.join();
+  }
+
+  boost::beast::http::request<boost::beast::http::string_body> httpRequest()
+      const {
+    boost::beast::http::request<boost::beast::http::string_body> req{
+        boost::beast::http::verb::post, "/", 11};
+    req.set(boost::beast::http::field::content_type, "application/json");
+    req.body() = request;
+    req.prepare_payload();
+    return req;
+  }
+};
+
+/**
+ * @given running HTTP transport based RPC service
+ * @when send two requests over one connection before reading responses
+ * @then both responses are received in order, connection is kept alive
+ */
+TEST_F(HttpListenerClientTest, KeepAlivePipelining) {
+  run([&](Context &context) {
+    boost::beast::tcp_stream stream{context};
+    stream.connect(endpoint);
+    auto req = httpRequest();
+    boost::beast::http::write(stream, req);
+    boost::beast::http::write(stream, req);
+    boost::beast::flat_buffer buffer;
+    for (size_t i = 0; i < 2; ++i) {
+      boost::beast::http::response<boost::beast::http::string_body> res;
+      boost::beast::http::read(stream, buffer, res);
+      EXPECT_EQ(res.result(), boost::beast::http::status::ok);
+      EXPECT_TRUE(res.keep_alive());
+      EXPECT_EQ(res.body(), response);
+    }
+  });
+}
+
+struct HttpListenerCompressionTest : HttpListenerClientTest {
+  void SetUp() override {
+    session_config.compress_min_size = 0;
+    HttpListenerClientTest::SetUp();
+  }
+};
+
+/**
+ * @given running HTTP transport based RPC service compressing all responses
+ * @when do requests with and without zstd in `Accept-Encoding`
+ * @then only response to request accepting zstd is compressed
+ */
+TEST_F(HttpListenerCompressionTest, Zstd) {
+  run([&](Context &context) {
+    boost::beast::tcp_stream stream{context};
+    stream.connect(endpoint);
+    boost::beast::flat_buffer buffer;
+
+    auto req = httpRequest();
+    req.set(boost::beast::http::field::accept_encoding, "gzip, zstd;q=0");
+    boost::beast::http::write(stream, req);
+    boost::beast::http::response<boost::beast::http::string_body> plain;
+    boost::beast::http::read(stream, buffer, plain);
+    EXPECT_EQ(plain[boost::beast::http::field::content_encoding], "");
+    EXPECT_EQ(plain.body(), response);
+
+    req.set(boost::beast::http::field::accept_encoding, "gzip, zstd");
+    boost::beast::http::write(stream, req);
+    boost::beast::http::response<boost::beast::http::string_body> compressed;
+    boost::beast::http::read(stream, buffer, compressed);
+    EXPECT_EQ(compressed[boost::beast::http::field::content_encoding],
+              "zstd");
+    auto &body = compressed.body();
+    std::string decompressed(response.size(), 0);
+    EXPECT_EQ(ZSTD_decompress(decompressed.data(),
+                              decompressed.size(),
+                              body.data(),
+                              body.size()),
+              response.size());
+    EXPECT_EQ(decompressed, response);
+  });
+}
@@ -5,10 +5,16 @@
  */
 
 #include <gtest/gtest.h>
+
+#include <thread>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
 #include <jsonrpc-lean/server.h>
 
 #include "api/jrpc/jrpc_handle_batch.hpp"
 
+using kagome::api::JrpcBatchExecutor;
 using kagome::api::JrpcHandleBatch;
 
 #define REQUEST(id) \
@@ -22,9 +28,20 @@ struct JrpcHanldeBatchTest : ::testing::Test {
     jsonrpc_handler_.RegisterFormatHandler(format_handler_);
     auto &dispatcher = jsonrpc_handler_.GetDispatcher();
     dispatcher.AddMethod("foo", [] { return 0; });
+    // earlier requests complete later
+    dispatcher.AddMethod(
+        "sleep", [](const jsonrpc::Request::Parameters &params) {
+          auto ms = params.at(0).AsInteger32();
+          std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+          return jsonrpc::Value{ms};
+        });
   }
 };
 
+#define SLEEP(id, ms) \
+  R"({"jsonrpc":"2.0","method":"sleep","id":)" #id R"(,"params":[)" #ms "]}"
+#define SLEPT(id, ms) R"({"jsonrpc":"2.0","id":)" #id R"(,"result":)" #ms "}"
+
 /**
  * @given single request
  * @when handle single request
@@ -44,3 +61,144 @@ TEST_F(JrpcHanldeBatchTest, Batch) {
   JrpcHandleBatch batch(jsonrpc_handler_, "[" REQUEST(1) "," REQUEST(2) "]");
   EXPECT_EQ(batch.response(), "[" RESPONSE(1) "," RESPONSE(2) "]");
 }
+
+/// Set by scope on worker threads
+thread_local bool bound = false;
+
+struct JrpcHanldeBatchConcurrentTest : JrpcHanldeBatchTest {
+  void SetUp() override {
+    JrpcHanldeBatchTest::SetUp();
+    auto &dispatcher = jsonrpc_handler_.GetDispatcher();
+    // whether request is handled by calling thread or bound worker
+    dispatcher.AddMethod("bound", [this] {
+      return std::this_thread::get_id() == caller_ or bound;
+    });
+    // whether request is handled by calling thread
+    auto caller = [this] { return std::this_thread::get_id() == caller_; };
+    dispatcher.AddMethod("caller", caller);
+    dispatcher.AddMethod("chain_subscribeNewHeads", caller);
+    for (size_t i = 0; i < 2; ++i) {
+      threads_.emplace_back([io{io_}] { io->run(); });
+    }
+  }
+
+  void TearDown() override {
+    work_guard_.reset();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  JrpcBatchExecutor executor_{
+      .io = std::make_shared<boost::asio::io_context>(),
+      .max_tasks = 2,
+      .scope =
+          [](const std::function<void()> &f) {
+            bound = true;
+            f();
+            bound = false;
+          },
+      .ordered =
+          [](const std::string &method) {
+            return method == "chain_subscribeNewHeads";
+          },
+  };
+  std::shared_ptr<boost::asio::io_context> io_ = executor_.io;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+      work_guard_ = boost::asio::make_work_guard(*io_);
+  std::vector<std::thread> threads_;
+  std::thread::id caller_ = std::this_thread::get_id();
+};
+
+#define BOUND(id) \
+  R"({"jsonrpc":"2.0","method":"bound","id":)" #id R"(,"params":[]})"
+#define SUBSCRIBE(id)                                               \
+  R"({"jsonrpc":"2.0","method":"chain_subscribeNewHeads","id":)" #id \
+  R"(,"params":[]})"
+#define YES(id) R"({"jsonrpc":"2.0","id":)" #id R"(,"result":true})"
+#define CALLER(id) \
+  R"({"jsonrpc":"2.0","method":"caller","id":)" #id R"(,"params":[]})"
+
+/**
+ * @given batch request and worker threads
+ * @when handle batch request concurrently
+ * @then responses are in order of requests, workers are bound to scope
+ */
+TEST_F(JrpcHanldeBatchConcurrentTest, Concurrent) {
+  JrpcHandleBatch batch(jsonrpc_handler_,
+                        "[" SLEEP(1, 30) "," SLEEP(2, 20) "," SLEEP(3, 10) ","
+                        BOUND(4) "," BOUND(5) "]",
+                        &executor_);
+  EXPECT_EQ(batch.response(),
+            "[" SLEPT(1, 30) "," SLEPT(2, 20) "," SLEPT(3, 10) "," YES(4)
+            "," YES(5) "]");
+}
+
+/**
+ * @given batch request with ordered method
+ * @when handle batch request concurrently
+ * @then all entries are handled on calling thread, in order of requests
+ */
+TEST_F(JrpcHanldeBatchConcurrentTest, OrderedSequential) {
+  JrpcHandleBatch batch(jsonrpc_handler_,
+                        "[" CALLER(1) "," SUBSCRIBE(2) "," CALLER(3) "]",
+                        &executor_);
+  EXPECT_EQ(batch.response(), "[" YES(1) "," YES(2) "," YES(3) "]");
+}
+
+/**
+ * @given worker tasks of all batches reached limit
+ * @when handle batch request
+ * @then entries are handled on calling thread, tasks are not leaked
+ */
+TEST_F(JrpcHanldeBatchConcurrentTest, TotalTasks) {
+  std::atomic_size_t total_tasks = 1;
+  executor_.total_tasks = &total_tasks;
+  executor_.max_total_tasks = 1;
+  JrpcHandleBatch full(
+      jsonrpc_handler_, "[" CALLER(1) "," CALLER(2) "]", &executor_);
+  EXPECT_EQ(full.response(), "[" YES(1) "," YES(2) "]");
+
+  total_tasks = 0;
+  executor_.max_total_tasks = 2;
+  JrpcHandleBatch batch(
+      jsonrpc_handler_, "[" BOUND(1) "," BOUND(2) "," BOUND(3) "]", &executor_);
+  EXPECT_EQ(batch.response(), "[" YES(1) "," YES(2) "," YES(3) "]");
+  EXPECT_EQ(total_tasks, 0);
+}
+
+/**
+ * @given batch request with too many entries
+ * @when handle batch request
+ * @then single error response is returned
+ */
+TEST_F(JrpcHanldeBatchTest, TooLarge) {
+  std::string request = "[";
+  for (size_t i = 0; i <= JrpcHandleBatch::kMaxBatchEntries; ++i) {
+    if (i != 0) {
+      request += ",";
+    }
+    request += REQUEST(0);
+  }
+  request += "]";
+  JrpcHandleBatch batch(jsonrpc_handler_, request);
+  EXPECT_NE(batch.response().find(R"("code":-32600)"), std::string::npos);
+}
+
+/**
+ * @given single requests
+ * @when peek method
+ * @then top level string method is returned, parsing stops after it
+ */
+TEST(PeekJrpcMethodTest, Method) {
+  using kagome::api::peekJrpcMethod;
+  EXPECT_EQ(peekJrpcMethod(
+                R"({"id":1,"params":[{"method":"bar"}],"method":"foo"})"),
+            "foo");
+  // params after method are not parsed
+  EXPECT_EQ(peekJrpcMethod(R"({"method":"foo","params":[)"), "foo");
+  EXPECT_EQ(peekJrpcMethod(R"({"method":1})"), std::nullopt);
+  EXPECT_EQ(peekJrpcMethod(R"({"id":1})"), std::nullopt);
+  EXPECT_EQ(peekJrpcMethod(R"([{"method":"foo"}])"), std::nullopt);
+  EXPECT_EQ(peekJrpcMethod("{"), std::nullopt);
+}
@@ -0,0 +1,105 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "api/jrpc/json_stream_writer.hpp"
+#include "api/jrpc/jrpc_server_impl.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::api::JRpcServerImpl;
+using kagome::api::JsonStreamWriter;
+using kagome::common::Buffer;
+
+#define REQUEST(method, id) \
+  R"({"jsonrpc":"2.0","method":")" method R"(","id":)" #id R"(,"params":[]})"
+
+struct JrpcStreamTest : ::testing::Test {
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    for (auto *server : {&value_server, &stream_server}) {
+      server->registerHandler("bytes", [this](const auto &) {
+        return jsonrpc::Value{kagome::common::hex_lower_0x(bytes)};
+      });
+      server->registerHandler("fail", [](const auto &) -> jsonrpc::Value {
+        throw jsonrpc::Fault("failed");
+      });
+    }
+    stream_server.registerStreamHandler(
+        "bytes", [this](const auto &, JsonStreamWriter &writer) {
+          writer.hex(bytes);
+        });
+    stream_server.registerStreamHandler(
+        "fail", [](const auto &, JsonStreamWriter &) {
+          throw jsonrpc::Fault("failed");
+        });
+  }
+
+  std::string process(JRpcServerImpl &server, std::string_view request) {
+    std::string response;
+    server.processData(
+        request, false, [&](std::string_view r) { response = r; });
+    return response;
+  }
+
+  Buffer bytes{std::vector<uint8_t>(1000, 0xab)};
+  JRpcServerImpl value_server;
+  JRpcServerImpl stream_server;
+};
+
+/**
+ * @given method with streaming handler
+ * @when handle single request
+ * @then response is same as built with value tree
+ */
+TEST_F(JrpcStreamTest, SameResponse) {
+  for (auto request : {REQUEST("bytes", 1), REQUEST("bytes", "id")}) {
+    EXPECT_EQ(process(stream_server, request),
+              process(value_server, request));
+  }
+}
+
+/**
+ * @given streaming handler throwing fault
+ * @when handle single request
+ * @then error response is same as built with value tree
+ */
+TEST_F(JrpcStreamTest, Fault) {
+  EXPECT_EQ(process(stream_server, REQUEST("fail", 2)),
+            process(value_server, REQUEST("fail", 2)));
+}
+
+/**
+ * @given method with streaming handler
+ * @when handle batch request
+ * @then batch response is same as built with value tree
+ */
+TEST_F(JrpcStreamTest, Batch) {
+  auto request = "[" REQUEST("bytes", 3) "," REQUEST("fail", 4) "]";
+  EXPECT_EQ(process(stream_server, request), process(value_server, request));
+}
+
+/**
+ * @given strings with characters which must be escaped
+ * @when write them
+ * @then they are escaped
+ */
+TEST(JsonStreamWriterTest, Escape) {
+  std::string out;
+  JsonStreamWriter writer{out};
+  writer.startObject();
+  writer.key("a\"b");
+  writer.startArray();
+  writer.string("c\\d\n");
+  writer.string(std::string_view{"\x01", 1});
+  writer.null();
+  writer.endArray();
+  writer.endObject();
+  EXPECT_EQ(out, R"({"a\"b":["c\\d\n","\u0001",null]})");
+}
@@ -22,6 +22,7 @@
 #include "transaction_pool/transaction_pool_error.hpp"
 
 using ::testing::_;
+using ::testing::ByMove;
 using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::Test;
@@ -46,6 +47,7 @@ using kagome::primitives::Transaction;
 using kagome::primitives::events::ExtrinsicSubscriptionEngine;
 using kagome::runtime::BlockBuilderApiMock;
 using kagome::subscription::ExtrinsicEventKeyRepository;
+using kagome::transaction_pool::ReadyTransactionsIterator;
 using kagome::transaction_pool::TransactionPoolError;
 using kagome::transaction_pool::TransactionPoolMock;
 
@@ -57,6 +59,38 @@ namespace kagome::primitives {
   }
 }  // namespace kagome::primitives
 
+/// Yields given transactions in order
+class VectorReadyIterator : public ReadyTransactionsIterator {
+ public:
+  explicit VectorReadyIterator(
+      std::vector<std::shared_ptr<const Transaction>> txs)
+      : txs_{std::move(txs)} {}
+
+  std::shared_ptr<const Transaction> next() override {
+    return next_ < txs_.size() ? txs_[next_++] : nullptr;
+  }
+
+  void reportInvalid() override {}
+
+ private:
+  std::vector<std::shared_ptr<const Transaction>> txs_;
+  size_t next_ = 0;
+};
+
+/// @return iterator over `txs`, transaction hashes are set from pairs
+std::unique_ptr<ReadyTransactionsIterator> iterate(
+    const std::vector<
+        std::pair<Transaction::Hash, std::shared_ptr<const Transaction>>>
+        &txs) {
+  std::vector<std::shared_ptr<const Transaction>> result;
+  for (auto &[hash, tx] : txs) {
+    auto copy = std::make_shared<Transaction>(*tx);
+    copy->hash = hash;
+    result.emplace_back(std::move(copy));
+  }
+  return std::make_unique<VectorReadyIterator>(std::move(result));
+}
+
 class ProposerTest : public ::testing::Test {
  public:
   static void SetUpTestCase() {
@@ -130,8 +164,8 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
       ready_transactions{
           std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
 
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  EXPECT_CALL(*transaction_pool_, readyTransactions())
+      .WillOnce(Return(ByMove(iterate(ready_transactions))));
 
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(outcome::success()));
@@ -229,8 +263,8 @@ TEST_F(ProposerTest, PushFailed) {
       ready_transactions{
           std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
 
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  EXPECT_CALL(*transaction_pool_, readyTransactions())
+      .WillOnce(Return(ByMove(iterate(ready_transactions))));
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
       .WillOnce(Return(outcome::success()));
 
@@ -279,8 +313,8 @@ TEST_F(ProposerTest, TrxSkippedDueToOverflow) {
   EXPECT_CALL(*transaction_pool_, removeOne(_))
       .WillRepeatedly(
           Return(outcome::failure(TransactionPoolError::TX_NOT_FOUND)));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  EXPECT_CALL(*transaction_pool_, readyTransactions())
+      .WillOnce(Return(ByMove(iterate(ready_transactions))));
   ;
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
       .WillRepeatedly(Return(outcome::success()));
@@ -330,8 +364,8 @@ TEST_F(ProposerTest, TrxSkippedDueToResourceExhausted) {
   EXPECT_CALL(*transaction_pool_, removeOne(_))
       .WillRepeatedly(
           Return(outcome::failure(TransactionPoolError::TX_NOT_FOUND)));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  EXPECT_CALL(*transaction_pool_, readyTransactions())
+      .WillOnce(Return(ByMove(iterate(ready_transactions))));
   ;
   ;
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
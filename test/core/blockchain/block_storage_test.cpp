@@ -9,12 +9,14 @@
 #include <gtest/gtest.h>
 
 #include "blockchain/block_storage_error.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
 #include "mock/core/storage/generic_storage_mock.hpp"
 #include "mock/core/storage/spaced_storage_mock.hpp"
 #include "scale/kagome_scale.hpp"
 #include "scale/scale.hpp"
 #include "storage/database_error.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
@@ -23,6 +25,7 @@ using kagome::blockchain::BlockStorageError;
 using kagome::blockchain::BlockStorageImpl;
 using kagome::common::Buffer;
 using kagome::common::BufferView;
+using kagome::crypto::HasherImpl;
 using kagome::crypto::HasherMock;
 using kagome::primitives::Block;
 using kagome::primitives::BlockBody;
@@ -31,6 +34,7 @@ using kagome::primitives::BlockHash;
 using kagome::primitives::BlockHeader;
 using kagome::primitives::BlockNumber;
 using kagome::storage::BufferStorageMock;
+using kagome::storage::InMemorySpacedStorage;
 using kagome::storage::Space;
 using kagome::storage::SpacedStorageMock;
 using kagome::storage::trie::RootHash;
@@ -250,6 +254,8 @@ TEST_F(BlockStorageTest, Remove) {
       .WillOnce(Return(outcome::success()));
   EXPECT_CALL(*(spaces[Space::kJustification]), remove(hash))
       .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*(spaces[Space::kLookupKey]), remove(_))
+      .WillOnce(Return(outcome::success()));
 
   ASSERT_OUTCOME_SUCCESS_TRY(block_storage->removeBlock(genesis_block_hash));
 
@@ -258,3 +264,40 @@ TEST_F(BlockStorageTest, Remove) {
 
   ASSERT_OUTCOME_SUCCESS_TRY(block_storage->removeBlock(genesis_block_hash));
 }
+
+/**
+ * @given a block storage with chain of 1000 blocks
+ * @when finding ancestors of blocks using skip pointers
+ * @then ancestors match ones found by parent hashes
+ */
+TEST_F(BlockStorageTest, GetAncestorHash) {
+  ASSERT_OUTCOME_SUCCESS(block_storage,
+                         BlockStorageImpl::create(
+                             root_hash,
+                             std::make_shared<InMemorySpacedStorage>(),
+                             std::make_shared<HasherImpl>()));
+
+  ASSERT_OUTCOME_SUCCESS(genesis_hash, block_storage->getBlockHash(0));
+  std::vector<BlockHash> chain{genesis_hash.value()};
+  for (BlockNumber number = 1; number <= 1000; ++number) {
+    BlockHeader header;
+    header.number = number;
+    header.parent_hash = chain.back();
+    ASSERT_OUTCOME_SUCCESS(hash, block_storage->putBlockHeader(header));
+    chain.emplace_back(hash);
+  }
+
+  for (BlockNumber number : {1, 3, 512, 777, 1000}) {
+    for (BlockNumber ancestor :
+         {BlockNumber{0}, BlockNumber{1}, number / 2, number - 1, number}) {
+      ASSERT_OUTCOME_SUCCESS(
+          ancestor_hash,
+          block_storage->getAncestorHash({number, chain[number]}, ancestor));
+      EXPECT_EQ(ancestor_hash, chain[ancestor]);
+    }
+    ASSERT_OUTCOME_SUCCESS(
+        descendant_hash,
+        block_storage->getAncestorHash({number, chain[number]}, number + 1));
+    EXPECT_EQ(descendant_hash, std::nullopt);
+  }
+}
@@ -0,0 +1,42 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/buffer.hpp"
+#include "common/hexutil.hpp"
+
+using kagome::common::Buffer;
+using kagome::common::hex_lower;
+using kagome::common::hex_lower_0x;
+using kagome::common::unhexWith0x;
+
+/**
+ * @given bytes with every possible value
+ * @when encode them to hex
+ * @then each byte is encoded as two lowercase digits
+ */
+TEST(HexUtilTest, AllBytes) {
+  Buffer bytes;
+  std::string expected;
+  for (size_t i = 0; i < 256; ++i) {
+    bytes.putUint8(i);
+    expected += fmt::format("{:02x}", i);
+  }
+  EXPECT_EQ(hex_lower(bytes), expected);
+  EXPECT_EQ(hex_lower_0x(bytes), "0x" + expected);
+  EXPECT_EQ(Buffer{unhexWith0x(hex_lower_0x(bytes)).value()}, bytes);
+}
+
+/**
+ * @given empty bytes
+ * @when encode them to hex
+ * @then only prefix is returned
+ */
+TEST(HexUtilTest, Empty) {
+  EXPECT_EQ(hex_lower(Buffer{}), "");
+  EXPECT_EQ(hex_lower_0x(Buffer{}), "0x");
+}
@@ -0,0 +1,87 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/parallel_for.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+
+class ParallelForTest : public testing::Test {
+ public:
+  void SetUp() override {
+    for (size_t i = 0; i < 4; ++i) {
+      threads_.emplace_back([this] { io_.run(); });
+    }
+  }
+
+  void TearDown() override {
+    work_guard_.reset();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  boost::asio::io_context io_;
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+      work_guard_{io_.get_executor()};
+  std::vector<std::thread> threads_;
+};
+
+/**
+ * @given pool with 4 threads
+ * @when items are handled
+ * @then each item is handled once
+ */
+TEST_F(ParallelForTest, AllItems) {
+  std::vector<std::atomic_size_t> calls(1000);
+  kagome::parallelFor(io_, 4, calls.size(), [&](size_t i) { ++calls[i]; });
+  for (auto &count : calls) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+/**
+ * @given pool which is busy
+ * @when items are handled
+ * @then calling thread handles items, without waiting for pool
+ */
+TEST_F(ParallelForTest, BusyPool) {
+  std::atomic_bool release = false;
+  for (size_t i = 0; i < threads_.size(); ++i) {
+    boost::asio::post(io_, [&] {
+      while (not release) {
+        std::this_thread::yield();
+      }
+    });
+  }
+  size_t calls = 0;
+  kagome::parallelFor(io_, 4, 10, [&](size_t) { ++calls; });
+  EXPECT_EQ(calls, 10);
+  release = true;
+}
+
+/**
+ * @given item which throws
+ * @when items are handled
+ * @then exception is rethrown to caller
+ */
+TEST_F(ParallelForTest, Exception) {
+  EXPECT_THROW(kagome::parallelFor(io_,
+                                   4,
+                                   100,
+                                   [&](size_t i) {
+                                     if (i == 10) {
+                                       throw std::runtime_error{"error"};
+                                     }
+                                   }),
+               std::runtime_error);
+}
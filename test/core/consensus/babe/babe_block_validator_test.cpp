@@ -216,6 +216,58 @@ TEST_F(BabeBlockValidatorTest, Success) {
   EXPECT_OUTCOME_TRUE_1(validate_res);
 }
 
+/**
+ * @given block validator and imported ancestor from the same epoch
+ * @when prechecking block ahead of import, then validating it
+ * @then seal and VRF are verified once
+ */
+TEST_F(BabeBlockValidatorTest, PrecheckSameEpoch) {
+  auto ancestor = valid_block_;
+  ancestor.header.number = block_header_.number - 1;
+  sealBlock(ancestor, {});
+  ancestor.header.hash_opt.emplace(parent_hash_);
+
+  auto [seal, pubkey] = sealBlock(valid_block_, {});
+  valid_block_.header.hash_opt.emplace(
+      BlockHash::fromString("block_hash_with_32_bytes_length!").value());
+  authorities.emplace_back();
+  authorities.emplace_back(Authority{AuthorityId{pubkey}, 42});
+
+  EXPECT_CALL(*hasher, blake2b_256(_)).WillOnce(Return(BlockHash{}));
+  EXPECT_CALL(*sr25519_provider, verify(_, _, pubkey))
+      .WillOnce(Return(outcome::result<bool>(true)));
+  EXPECT_CALL(*vrf_provider, verifyTranscript(_, _, pubkey, _))
+      .WillOnce(Return(VRFVerifyOutput{.is_valid = true, .is_less = true}));
+
+  auto precheck =
+      block_validator->precheckHeader(valid_block_.header, ancestor.header);
+  ASSERT_TRUE(precheck);
+  (*precheck)();
+  EXPECT_OUTCOME_TRUE_1(block_validator->validateHeader(valid_block_.header));
+}
+
+/**
+ * @given block validator and imported ancestor from previous epoch
+ * @when prechecking block ahead of import
+ * @then block is left to be checked in order of import
+ */
+TEST_F(BabeBlockValidatorTest, PrecheckEpochBoundary) {
+  auto ancestor = valid_block_;
+  ancestor.header.number = block_header_.number - 1;
+  sealBlock(ancestor, {});
+  ancestor.header.hash_opt.emplace(parent_hash_);
+
+  sealBlock(valid_block_, {});
+  valid_block_.header.hash_opt.emplace(
+      BlockHash::fromString("block_hash_with_32_bytes_length!").value());
+  EXPECT_CALL(*slots_util, slotToEpoch(_, _)).WillRepeatedly(Return(1));
+  EXPECT_CALL(*slots_util, slotToEpoch(ancestor.header.blockInfo(), _))
+      .WillOnce(Return(2));
+
+  EXPECT_FALSE(
+      block_validator->precheckHeader(valid_block_.header, ancestor.header));
+}
+
 /**
  * @given block validator
  * @when validating block, which has less than two digests
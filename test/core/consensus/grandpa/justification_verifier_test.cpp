@@ -0,0 +1,148 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/worker_thread_pool.hpp"
+#include "consensus/grandpa/impl/justification_verifier.hpp"
+#include "consensus/grandpa/voting_round_error.hpp"
+#include "crypto/ed25519/ed25519_provider_impl.hpp"
+#include "crypto/hasher/hasher_impl.hpp"
+#include "mock/core/blockchain/block_tree_mock.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::TestThreadPool;
+using kagome::blockchain::BlockTreeMock;
+using kagome::common::Hash256;
+using kagome::common::WorkerThreadPool;
+using kagome::consensus::grandpa::Authority;
+using kagome::consensus::grandpa::AuthoritySet;
+using kagome::consensus::grandpa::GrandpaJustification;
+using kagome::consensus::grandpa::JustificationVerifier;
+using kagome::consensus::grandpa::Precommit;
+using kagome::consensus::grandpa::SignedPrecommit;
+using kagome::consensus::grandpa::VotingRoundError;
+using kagome::crypto::Ed25519Keypair;
+using kagome::crypto::Ed25519ProviderImpl;
+using kagome::crypto::Ed25519Seed;
+using kagome::crypto::HasherImpl;
+using kagome::crypto::SecureCleanGuard;
+using kagome::primitives::BlockInfo;
+using testing::Return;
+
+class JustificationVerifierTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    authorities.id = kSetId;
+    for (size_t i = 0; i < kVoters; ++i) {
+      Hash256 seed_bytes;
+      seed_bytes[0] = i;
+      auto keypair =
+          ed_provider
+              ->generateKeypair(
+                  Ed25519Seed::from(SecureCleanGuard{seed_bytes}), {})
+              .value();
+      authorities.authorities.emplace_back(
+          Authority{.id = keypair.public_key, .weight = 1});
+      keypairs.emplace_back(keypair);
+    }
+    verifier = std::make_shared<JustificationVerifier>(
+        hasher, ed_provider, block_tree, worker_thread_pool);
+  }
+
+  /// Makes justification for `target` signed by first `signers` voters
+  GrandpaJustification makeJustification(size_t signers) const {
+    GrandpaJustification justification{
+        .round_number = kRound,
+        .block_info = target,
+    };
+    for (size_t i = 0; i < signers; ++i) {
+      Precommit precommit{target.number, target.hash};
+      auto payload = scale::encode(kagome::consensus::grandpa::Vote{precommit},
+                                   kRound,
+                                   kSetId)
+                         .value();
+      SignedPrecommit commit;
+      commit.message = precommit;
+      commit.signature = ed_provider->sign(keypairs[i], payload).value();
+      commit.id = keypairs[i].public_key;
+      justification.items.emplace_back(std::move(commit));
+    }
+    return justification;
+  }
+
+  static constexpr size_t kVoters = 100;
+  static constexpr kagome::consensus::grandpa::RoundNumber kRound = 7;
+  static constexpr kagome::consensus::grandpa::VoterSetId kSetId = 3;
+
+  BlockInfo target{10, "target"_hash256};
+  std::shared_ptr<HasherImpl> hasher = std::make_shared<HasherImpl>();
+  std::shared_ptr<Ed25519ProviderImpl> ed_provider =
+      std::make_shared<Ed25519ProviderImpl>(hasher);
+  std::shared_ptr<BlockTreeMock> block_tree = std::make_shared<BlockTreeMock>();
+  WorkerThreadPool worker_thread_pool{TestThreadPool{}};
+  AuthoritySet authorities;
+  std::vector<Ed25519Keypair> keypairs;
+  std::shared_ptr<JustificationVerifier> verifier;
+};
+
+/**
+ * @given justification signed by supermajority of voters
+ * @when verify it
+ * @then verification succeeds
+ */
+TEST_F(JustificationVerifierTest, Valid) {
+  auto justification = makeJustification(kVoters * 2 / 3 + 1);
+  EXPECT_OUTCOME_TRUE_1(verifier->verify(justification, authorities));
+}
+
+/**
+ * @given justification signed by less than supermajority of voters
+ * @when verify it
+ * @then verification fails with NOT_ENOUGH_WEIGHT
+ */
+TEST_F(JustificationVerifierTest, NotEnoughWeight) {
+  auto justification = makeJustification(kVoters * 2 / 3);
+  EXPECT_OUTCOME_ERROR(res,
+                       verifier->verify(justification, authorities),
+                       VotingRoundError::NOT_ENOUGH_WEIGHT);
+}
+
+/**
+ * @given justification with one corrupted signature in last chunk
+ * @when verify it
+ * @then verification fails with INVALID_SIGNATURE
+ */
+TEST_F(JustificationVerifierTest, InvalidSignature) {
+  auto justification = makeJustification(kVoters);
+  justification.items.back().signature[0] ^= 1;
+  EXPECT_OUTCOME_ERROR(res,
+                       verifier->verify(justification, authorities),
+                       VotingRoundError::INVALID_SIGNATURE);
+}
+
+/**
+ * @given justification with precommits for descendant of justified block
+ * @when verify it
+ * @then ancestry is checked with block tree
+ */
+TEST_F(JustificationVerifierTest, AncestryFromBlockTree) {
+  auto justification = makeJustification(kVoters);
+  target = {11, "descendant"_hash256};
+  auto descendant_justification = makeJustification(kVoters);
+  descendant_justification.block_info = justification.block_info;
+  EXPECT_CALL(*block_tree,
+              hasDirectChain(justification.block_info.hash, target.hash))
+      .WillRepeatedly(Return(true));
+  EXPECT_OUTCOME_TRUE_1(
+      verifier->verify(descendant_justification, authorities));
+}
@@ -33,21 +33,21 @@ TEST_F(VoteWeightTest, AddDifferentVote) {
 
   // THEN.1
   EXPECT_EQ(testee->sum, w[0]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 1);
+  EXPECT_EQ(testee->flags.count(), 1);
 
   // WHEN.2
   testee->set(2, w[2]);
 
   // THEN.2
   EXPECT_EQ(testee->sum, w[0] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  EXPECT_EQ(testee->flags.count(), 2);
 
   // WHEN.3
   testee->set(1, w[1]);
 
   // THEN.3
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3);
 }
 
 /**
@@ -61,28 +61,28 @@ TEST_F(VoteWeightTest, AddExistingVote) {
   testee->set(1, w[1]);
   testee->set(2, w[2]);
   ASSERT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  ASSERT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  ASSERT_EQ(testee->flags.count(), 3);
 
   // WHEN.1
   testee->set(0, w[0]);
 
   // THEN.1
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3);
 
   // WHEN.2
   testee->set(1, w[1]);
 
   // WHEN.2
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3);
 
   // THEN.3
   testee->set(2, w[2]);
 
   // WHEN.3
   EXPECT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  EXPECT_EQ(testee->flags.count(), 3);
 }
 
 /**
@@ -96,28 +96,28 @@ TEST_F(VoteWeightTest, RemoveExistingVote) {
   testee->set(1, w[1]);
   testee->set(2, w[2]);
   ASSERT_EQ(testee->sum, w[0] + w[1] + w[2]);
-  ASSERT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 3);
+  ASSERT_EQ(testee->flags.count(), 3);
 
   // WHEN.1
   testee->unset(1, w[1]);
 
   // THEN.1
   EXPECT_EQ(testee->sum, w[0] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  EXPECT_EQ(testee->flags.count(), 2);
 
   // WHEN.2
   testee->unset(0, w[0]);
 
   // THEN.2
   EXPECT_EQ(testee->sum, w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 1);
+  EXPECT_EQ(testee->flags.count(), 1);
 
   // WHEN.3
   testee->unset(2, w[2]);
 
   // THEN.3
   EXPECT_EQ(testee->sum, 0);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 0);
+  EXPECT_EQ(testee->flags.count(), 0);
 }
 
 /**
@@ -130,12 +130,12 @@ TEST_F(VoteWeightTest, RemoveNonExistingVote) {
   testee->set(0, w[0]);
   testee->set(2, w[2]);
   ASSERT_EQ(testee->sum, w[0] + w[2]);
-  ASSERT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  ASSERT_EQ(testee->flags.count(), 2);
 
   // WHEN
   testee->unset(1, w[1]);
 
   // THEN
   EXPECT_EQ(testee->sum, w[0] + w[2]);
-  EXPECT_EQ(std::count(testee->flags.begin(), testee->flags.end(), true), 2);
+  EXPECT_EQ(testee->flags.count(), 2);
 }
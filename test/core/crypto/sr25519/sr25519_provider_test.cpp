@@ -134,6 +134,37 @@ TEST_F(Sr25519ProviderTest, VerifyWrongKeyFail) {
   ASSERT_FALSE(ver_res);
 }
 
+/**
+ * @given sr25519 provider instance configured with boost random generator
+ * @and several messages signed by different keypairs
+ * @when verify them in batch @and break one of signatures
+ * @then only broken signature is reported invalid
+ */
+TEST_F(Sr25519ProviderTest, VerifyBatch) {
+  std::vector<std::vector<uint8_t>> messages;
+  std::vector<kagome::crypto::Sr25519VerifyItem> items;
+  for (uint8_t i = 0; i < 8; ++i) {
+    messages.emplace_back(message).push_back(i);
+  }
+  for (auto &msg : messages) {
+    EXPECT_OUTCOME_TRUE(kp, generate());
+    EXPECT_OUTCOME_TRUE(signature, sr25519_provider->sign(kp, msg));
+    items.emplace_back(kagome::crypto::Sr25519VerifyItem{
+        .signature = signature,
+        .message = msg,
+        .public_key = kp.public_key,
+    });
+  }
+  EXPECT_OUTCOME_TRUE(valid, sr25519_provider->verifyBatch(items));
+  ASSERT_EQ(valid, std::vector<bool>(items.size(), true));
+
+  items[3].public_key = items[4].public_key;
+  EXPECT_OUTCOME_TRUE(invalid, sr25519_provider->verifyBatch(items));
+  auto expected = std::vector<bool>(items.size(), true);
+  expected[3] = false;
+  ASSERT_EQ(invalid, expected);
+}
+
 /**
  * Don't try to verify a message and signature against an invalid key, this may
  * lead to program termination
@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include <gtest/gtest.h>
+#include <boost/asio/io_context.hpp>
 #include <span>
 
 #include "crypto/ecdsa/ecdsa_provider_impl.hpp"
@@ -189,6 +190,22 @@ class CryptoExtensionTest : public ::testing::Test {
     ed_sr_signature_failure_result_buffer.putUint8(0);
   }
 
+  /// Queues `count` ed25519 and sr25519 signatures to batch, each twice
+  void queueBatch(CryptoExtension &crypto_ext, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(crypto_ext.ext_crypto_ed25519_batch_verify_version_1(
+                    memory_[ed25519_signature],
+                    memory_[input],
+                    memory_[ed25519_keypair.public_key]),
+                CryptoExtension::kVerifySuccess);
+      EXPECT_EQ(crypto_ext.ext_crypto_sr25519_batch_verify_version_1(
+                    memory_[sr25519_signature],
+                    memory_[input],
+                    memory_[sr25519_keypair.public_key]),
+                CryptoExtension::kVerifySuccess);
+    }
+  }
+
   void bytesN(WasmPointer ptr, BufferView expected) {
     EXPECT_EQ(memory_.memory.view(ptr, expected.size()).value(),
               SpanAdl{expected});
@@ -640,3 +657,68 @@ TEST_F(CryptoExtensionTest, Twox_64Version1_Success) {
   bytesN(crypto_ext_->ext_hashing_twox_64_version_1(memory_[twox_input]),
          twox64_result);
 }
+
+/**
+ * @given crypto extension with worker pool
+ * @when valid signatures are queued in batch and workers verify them
+ * @then finish of batch succeeds
+ */
+TEST_F(CryptoExtensionTest, BatchVerifyByWorkers) {
+  auto worker_io = std::make_shared<boost::asio::io_context>();
+  CryptoExtension crypto_ext{memory_provider_,
+                             sr25519_provider_,
+                             ecdsa_provider_,
+                             ed25519_provider_,
+                             secp256k1_provider_,
+                             hasher_,
+                             key_store_,
+                             worker_io};
+  crypto_ext.ext_crypto_start_batch_verify_version_1();
+  queueBatch(crypto_ext, CryptoExtension::kBatchChunkSize + 1);
+  EXPECT_GT(worker_io->run(), 0);
+  ASSERT_EQ(crypto_ext.ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifySuccess);
+}
+
+/**
+ * @given crypto extension with worker pool which doesn't run
+ * @when batch with one invalid signature is finished
+ * @then queued chunks are verified in finish, and it fails
+ */
+TEST_F(CryptoExtensionTest, BatchVerifyInvalid) {
+  auto worker_io = std::make_shared<boost::asio::io_context>();
+  CryptoExtension crypto_ext{memory_provider_,
+                             sr25519_provider_,
+                             ecdsa_provider_,
+                             ed25519_provider_,
+                             secp256k1_provider_,
+                             hasher_,
+                             key_store_,
+                             worker_io};
+  crypto_ext.ext_crypto_start_batch_verify_version_1();
+  queueBatch(crypto_ext, CryptoExtension::kBatchChunkSize);
+  Ed25519Signature invalid_signature;
+  invalid_signature.fill(0x11);
+  EXPECT_EQ(crypto_ext.ext_crypto_ed25519_batch_verify_version_1(
+                memory_[invalid_signature],
+                memory_[input],
+                memory_[ed25519_keypair.public_key]),
+            CryptoExtension::kVerifySuccess);
+  ASSERT_EQ(crypto_ext.ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifyFail);
+}
+
+/**
+ * @given crypto extension
+ * @when invalid signature is passed to batch method outside of batch
+ * @then it is verified immediately
+ */
+TEST_F(CryptoExtensionTest, BatchMethodOutsideOfBatch) {
+  Ed25519Signature invalid_signature;
+  invalid_signature.fill(0x11);
+  ASSERT_EQ(crypto_ext_->ext_crypto_ed25519_batch_verify_version_1(
+                memory_[invalid_signature],
+                memory_[input],
+                memory_[ed25519_keypair.public_key]),
+            CryptoExtension::kVerifyFail);
+}
@@ -375,6 +375,38 @@ TEST_F(StorageExtensionTest, StorageGetV1Test) {
             value);
 }
 
+/**
+ * @given key of value with two bytes compact length prefix
+ * @when ext_storage_get_version_1 is invoked on given key
+ * @then value is stored as SCALE encoded option of exact size
+ */
+TEST_F(StorageExtensionTest, StorageGetV1LongValueTest) {
+  Buffer key(8, 'k');
+  Buffer value(100, 'v');
+
+  EXPECT_CALL(*trie_batch_, tryGetMock(key.view())).WillOnce(Return(value));
+
+  auto span = storage_extension_->ext_storage_get_version_1(memory_[key]);
+  ASSERT_EQ(PtrSize{span}.size, 1 + 2 + value.size());
+  ASSERT_EQ(memory_.decode<std::optional<Buffer>>(span), value);
+}
+
+/**
+ * @given key absent in storage
+ * @when ext_storage_get_version_1 is invoked on given key
+ * @then encoded none is returned
+ */
+TEST_F(StorageExtensionTest, StorageGetV1NoneTest) {
+  Buffer key(8, 'k');
+
+  EXPECT_CALL(*trie_batch_, tryGetMock(key.view()))
+      .WillOnce(Return(std::nullopt));
+
+  auto span = storage_extension_->ext_storage_get_version_1(memory_[key]);
+  ASSERT_EQ(PtrSize{span}.size, 1);
+  ASSERT_EQ(memory_.decode<std::optional<Buffer>>(span), std::nullopt);
+}
+
 /**
  * @given key pointer and key size
  * @when ext_storage_exists_version_1 is invoked on StorageExtension with given
@@ -0,0 +1,50 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "network/notifications/encode.hpp"
+
+using kagome::common::Buffer;
+using kagome::network::notifications::encodeFramed;
+using kagome::network::notifications::frame;
+
+/**
+ * @given message shorter than 128 bytes
+ * @when frame it
+ * @then message is prefixed with single byte length
+ */
+TEST(NotificationFrameTest, ShortMessage) {
+  Buffer message{std::vector<uint8_t>(0x7f, 1)};
+  auto framed = frame(message);
+  ASSERT_EQ(framed->size(), 1 + message.size());
+  EXPECT_EQ((*framed)[0], 0x7f);
+  EXPECT_EQ(framed->view(1, message.size()), message.view());
+}
+
+/**
+ * @given message of 300 bytes
+ * @when frame it
+ * @then message is prefixed with two bytes varint length
+ */
+TEST(NotificationFrameTest, LongMessage) {
+  Buffer message{std::vector<uint8_t>(300, 2)};
+  auto framed = frame(message);
+  ASSERT_EQ(framed->size(), 2 + message.size());
+  EXPECT_EQ((*framed)[0], 0xac);
+  EXPECT_EQ((*framed)[1], 0x02);
+  EXPECT_EQ(framed->view(2, message.size()), message.view());
+}
+
+/**
+ * @given scale encodable message
+ * @when encode and frame it
+ * @then result is framed scale encoding of message
+ */
+TEST(NotificationFrameTest, EncodeFramed) {
+  std::vector<uint32_t> message{1, 2, 3};
+  EXPECT_EQ(*encodeFramed(message), *frame(scale::encode(message).value()));
+}
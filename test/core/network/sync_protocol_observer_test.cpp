@@ -13,6 +13,7 @@
 
 #include "application/app_configuration.hpp"
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/blockchain/block_storage_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/network/beefy_mock.hpp"
 #include "mock/libp2p/host/host_mock.hpp"
@@ -45,7 +46,8 @@ class SyncProtocolObserverTest : public testing::Test {
 
   void SetUp() override {
     sync_protocol_observer_ =
-        std::make_shared<SyncProtocolObserverImpl>(tree_, headers_, beefy_);
+        std::make_shared<SyncProtocolObserverImpl>(
+            tree_, headers_, block_storage_, beefy_);
   }
 
   std::shared_ptr<HostMock> host_ = std::make_shared<HostMock>();
@@ -54,6 +56,8 @@ class SyncProtocolObserverTest : public testing::Test {
   std::shared_ptr<BlockTreeMock> tree_ = std::make_shared<BlockTreeMock>();
   std::shared_ptr<BlockHeaderRepositoryMock> headers_ =
       std::make_shared<BlockHeaderRepositoryMock>();
+  std::shared_ptr<BlockStorageMock> block_storage_ =
+      std::make_shared<BlockStorageMock>();
 
   std::shared_ptr<SyncProtocolObserver> sync_protocol_observer_;
   std::shared_ptr<BeefyMock> beefy_ = std::make_shared<BeefyMock>();
@@ -84,20 +88,20 @@ TEST_F(SyncProtocolObserverTest, ProcessRequest) {
                   block3_hash_, AppConfiguration::kAbsolutMaxBlocksInResponse))
       .WillOnce(Return(std::vector<BlockHash>{block3_hash_, block4_hash_}));
 
-  EXPECT_CALL(*headers_, getBlockHeader(block3_hash_))
-      .WillOnce(Return(block3_.header));
-  EXPECT_CALL(*headers_, getBlockHeader(block4_hash_))
-      .WillOnce(Return(block4_.header));
-
-  EXPECT_CALL(*tree_, getBlockBody(block3_hash_))
-      .WillOnce(Return(block3_.body));
-  EXPECT_CALL(*tree_, getBlockBody(block4_hash_))
-      .WillOnce(Return(block4_.body));
-
-  EXPECT_CALL(*tree_, getBlockJustification(block3_hash_))
-      .WillOnce(Return(::outcome::failure(boost::system::error_code{})));
-  EXPECT_CALL(*tree_, getBlockJustification(block4_hash_))
-      .WillOnce(Return(::outcome::failure(boost::system::error_code{})));
+  std::vector<EncodedBlockData> encoded_blocks{
+      {
+          .hash = block3_hash_,
+          .header = Buffer{scale::encode(block3_.header).value()},
+          .body = Buffer{scale::encode(block3_.body).value()},
+      },
+      {
+          .hash = block4_hash_,
+          .header = Buffer{scale::encode(block4_.header).value()},
+          .body = Buffer{scale::encode(block4_.body).value()},
+      },
+  };
+  EXPECT_CALL(*block_storage_, getEncodedBlocks(_, true, true, true))
+      .WillOnce(Return(encoded_blocks));
 
   EXPECT_CALL(*beefy_, getJustification(_)).WillRepeatedly([] {
     return ::outcome::success(std::nullopt);
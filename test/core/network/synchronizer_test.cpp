@@ -11,10 +11,12 @@
 #include <stdexcept>
 
 #include "common/main_thread_pool.hpp"
+#include "common/worker_thread_pool.hpp"
 #include "mock/core/application/app_configuration_mock.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/blockchain/block_storage_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/consensus/babe/babe_block_validator_mock.hpp"
 #include "mock/core/consensus/grandpa/environment_mock.hpp"
 #include "mock/core/consensus/timeline/block_appender_mock.hpp"
 #include "mock/core/consensus/timeline/block_executor_mock.hpp"
@@ -111,7 +113,9 @@ class SynchronizerTest
                                                     nullptr,
                                                     grandpa_environment,
                                                     *main_thread_pool,
-                                                    block_storage);
+                                                    worker_thread_pool,
+                                                    block_storage,
+                                                    babe_block_validator);
   }
 
   void TearDown() override {
@@ -152,6 +156,9 @@ class SynchronizerTest
   std::shared_ptr<Watchdog> watchdog =
       std::make_shared<Watchdog>(std::chrono::milliseconds(1));
   std::shared_ptr<MainThreadPool> main_thread_pool;
+  common::WorkerThreadPool worker_thread_pool{TestThreadPool{}};
+  std::shared_ptr<BabeBlockValidatorMock> babe_block_validator =
+      std::make_shared<testing::NiceMock<BabeBlockValidatorMock>>();
 
   std::shared_ptr<network::SynchronizerImpl> synchronizer;
 
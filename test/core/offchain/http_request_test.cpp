@@ -10,10 +10,98 @@
 
 #include "offchain/impl/http_request.hpp"
 #include "testutil/prepare_loggers.hpp"
+#include "utils/watchdog.hpp"
 
 using namespace kagome;
 using namespace offchain;
 using namespace std::chrono_literals;
+namespace http = boost::beast::http;
+using boost::asio::ip::tcp;
+
+/**
+ * Local HTTP stand-in server.
+ * Answers each request after `delay`, keeps connections alive.
+ * Closes connection instead of answering `drop`-th request.
+ */
+struct LocalServer {
+  explicit LocalServer(std::chrono::milliseconds delay, size_t drop = 0)
+      : delay{delay}, drop{drop} {
+    acceptor.open(tcp::v4());
+    acceptor.bind({boost::asio::ip::make_address("127.0.0.1"), 0});
+    acceptor.listen();
+    accept_thread = std::thread{[this] {
+      while (true) {
+        tcp::socket socket{io};
+        boost::system::error_code ec;
+        acceptor.accept(socket, ec);
+        if (ec or stopped) {
+          return;
+        }
+        ++connections;
+        auto shared = std::make_shared<tcp::socket>(std::move(socket));
+        sockets.emplace_back(shared);
+        threads.emplace_back([this, shared] { serve(*shared); });
+      }
+    }};
+  }
+
+  ~LocalServer() {
+    stopped = true;
+    // unblock accept
+    tcp::socket socket{io};
+    boost::system::error_code ec;
+    socket.connect(acceptor.local_endpoint(), ec);
+    accept_thread.join();
+    // unblock serve threads reading idle keep-alive connections
+    for (auto &socket : sockets) {
+      socket->shutdown(tcp::socket::shutdown_both, ec);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  void serve(tcp::socket &socket) {
+    boost::beast::flat_buffer buffer;
+    while (true) {
+      http::request<http::string_body> req;
+      boost::system::error_code ec;
+      http::read(socket, buffer, req, ec);
+      if (ec) {
+        return;
+      }
+      if (++requests == drop) {
+        socket.close(ec);
+        return;
+      }
+      std::this_thread::sleep_for(delay);
+      http::response<http::string_body> res{http::status::ok, req.version()};
+      res.body() = "pong";
+      res.keep_alive(req.keep_alive());
+      res.prepare_payload();
+      http::write(socket, res, ec);
+      if (ec or not req.keep_alive()) {
+        return;
+      }
+    }
+  }
+
+  std::string url() const {
+    return fmt::format("http://127.0.0.1:{}/ping",
+                       acceptor.local_endpoint().port());
+  }
+
+  std::chrono::milliseconds delay;
+  size_t drop;
+  std::atomic_size_t requests = 0;
+  boost::asio::io_context io;
+  tcp::acceptor acceptor{io};
+  std::atomic_bool stopped = false;
+  std::atomic_size_t connections = 0;
+  std::thread accept_thread;
+  std::vector<std::shared_ptr<tcp::socket>> sockets;
+  std::vector<std::thread> threads;
+};
 
 class HttpRequestTest : public testing::Test {
  public:
@@ -21,14 +109,41 @@ class HttpRequestTest : public testing::Test {
     testutil::prepareLoggers();
     log::setLevelOfGroup("offchain", log::Level::TRACE);
   }
-  void SetUp() override {}
+
+  void TearDown() override {
+    watchdog->stop();
+    thread_pool.reset();
+    connections.reset();
+  }
+
+  /// Starts GET request and finalizes it
+  std::shared_ptr<HttpRequest> get(RequestId id, const std::string &url) {
+    return start(id, HttpMethod::Get, url);
+  }
+
+  /// Starts request and finalizes it
+  std::shared_ptr<HttpRequest> start(RequestId id,
+                                     HttpMethod method,
+                                     const std::string &url) {
+    auto request = std::make_shared<HttpRequest>(id, connections);
+    EXPECT_TRUE(request->init(method, url, {})) << request->errorMessage();
+    EXPECT_TRUE(request->writeRequestBody({}, std::nullopt).isSuccess());
+    return request;
+  }
+
+  std::shared_ptr<Watchdog> watchdog =
+      std::make_shared<Watchdog>(std::chrono::milliseconds(1));
+  std::unique_ptr<OcwHttpThreadPool> thread_pool =
+      std::make_unique<OcwHttpThreadPool>(watchdog);
+  std::shared_ptr<HttpConnectionPool> connections =
+      std::make_shared<HttpConnectionPool>(*thread_pool);
 };
 
 TEST_F(HttpRequestTest, SunnyDayScenario) {
   std::shared_ptr<HttpRequest> request;
 
   RequestId id = 0;
-  ASSERT_NO_THROW(request = std::make_shared<HttpRequest>(++id));
+  ASSERT_NO_THROW(request = std::make_shared<HttpRequest>(++id, connections));
 
   common::Buffer meta;
   ASSERT_TRUE(request->init(HttpMethod::Get, "http://www.google.com/", meta))
@@ -48,7 +163,7 @@ TEST_F(HttpRequestTest, SunnyDayScenario) {
     ASSERT_TRUE(r.isSuccess()) << request->errorMessage();
   }
   {  // Get status
-    auto status = request->status();
+    auto status = request->wait(std::chrono::steady_clock::now() + 3000ms);
     ASSERT_GE(status, 100) << "HTTP status expected; "
                            << request->errorMessage();
   }
@@ -66,3 +181,84 @@ TEST_F(HttpRequestTest, SunnyDayScenario) {
     EXPECT_GT(r.value(), 0) << "Non empty body expected";
   }
 }
+
+/**
+ * @given local server keeping connections alive
+ * @when make requests to it one after another
+ * @then requests are completed, connection is reused
+ */
+TEST_F(HttpRequestTest, KeepAlive) {
+  LocalServer server{0ms};
+  for (RequestId id = 1; id <= 3; ++id) {
+    auto request = get(id, server.url());
+    EXPECT_EQ(request->wait(std::chrono::steady_clock::now() + 3s), 200)
+        << request->errorMessage();
+  }
+  EXPECT_EQ(server.connections, 1);
+}
+
+/**
+ * @given local server answering with delay
+ * @when start several requests and wait for them
+ * @then requests are completed concurrently, wait is woken by completion
+ */
+TEST_F(HttpRequestTest, ConcurrentWait) {
+  constexpr auto kDelay = 200ms;
+  constexpr RequestId kRequests = 4;
+  LocalServer server{kDelay};
+  auto begin = std::chrono::steady_clock::now();
+  std::vector<std::shared_ptr<HttpRequest>> requests;
+  for (RequestId id = 1; id <= kRequests; ++id) {
+    requests.emplace_back(get(id, server.url()));
+  }
+  for (auto &request : requests) {
+    EXPECT_EQ(request->wait(begin + 3s), 200) << request->errorMessage();
+  }
+  auto elapsed = std::chrono::steady_clock::now() - begin;
+  EXPECT_GE(elapsed, kDelay);
+  EXPECT_LT(elapsed, kDelay * kRequests);
+}
+
+/**
+ * @given local server answering with delay
+ * @when wait for request with deadline before answer
+ * @then wait returns zero status at deadline
+ */
+TEST_F(HttpRequestTest, WaitDeadline) {
+  LocalServer server{500ms};
+  auto request = get(1, server.url());
+  EXPECT_EQ(request->wait(std::chrono::steady_clock::now() + 50ms), 0);
+  EXPECT_EQ(request->wait(std::chrono::steady_clock::now() + 3s), 200);
+}
+
+/**
+ * @given local server closing reused connection after reading request
+ * @when GET request is sent over that connection
+ * @then request is retried with new connection
+ */
+TEST_F(HttpRequestTest, RetryGet) {
+  LocalServer server{0ms, 2};
+  for (RequestId id = 1; id <= 2; ++id) {
+    auto request = get(id, server.url());
+    EXPECT_EQ(request->wait(std::chrono::steady_clock::now() + 3s), 200)
+        << request->errorMessage();
+  }
+  EXPECT_EQ(server.requests, 3);
+  EXPECT_EQ(server.connections, 2);
+}
+
+/**
+ * @given local server closing reused connection after reading request
+ * @when POST request is sent over that connection
+ * @then request fails without being sent again
+ */
+TEST_F(HttpRequestTest, NoRetryPost) {
+  LocalServer server{0ms, 2};
+  auto first = start(1, HttpMethod::Post, server.url());
+  EXPECT_EQ(first->wait(std::chrono::steady_clock::now() + 3s), 200)
+      << first->errorMessage();
+  auto second = start(2, HttpMethod::Post, server.url());
+  EXPECT_EQ(second->wait(std::chrono::steady_clock::now() + 3s),
+            ErrorHasOccurred);
+  EXPECT_EQ(server.requests, 2);
+}
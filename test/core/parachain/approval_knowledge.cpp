@@ -0,0 +1,105 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "parachain/approval/knowledge.hpp"
+
+using kagome::parachain::approval::Knowledge;
+using kagome::parachain::approval::MessageKind;
+using kagome::parachain::approval::MessageSubject;
+using kagome::parachain::approval::PeerKnowledge;
+
+namespace {
+  MessageSubject subject(std::vector<bool> candidates, uint32_t validator) {
+    scale::BitVec bits;
+    bits.bits = std::move(candidates);
+    return {kagome::common::Hash256{}, std::move(bits), validator};
+  }
+}  // namespace
+
+/**
+ * @given empty knowledge
+ * @when insert assignment and then approval of same subject
+ * @then approval upgrades known assignment, repeated insert is rejected
+ */
+TEST(ApprovalKnowledgeTest, AssignmentThenApproval) {
+  Knowledge knowledge;
+  auto message = subject({true, false, true}, 7);
+  EXPECT_FALSE(knowledge.contains(message, MessageKind::Assignment));
+
+  EXPECT_TRUE(knowledge.insert(message, MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.contains(message, MessageKind::Assignment));
+  EXPECT_FALSE(knowledge.contains(message, MessageKind::Approval));
+  EXPECT_FALSE(knowledge.insert(message, MessageKind::Assignment));
+
+  EXPECT_TRUE(knowledge.insert(message, MessageKind::Approval));
+  EXPECT_TRUE(knowledge.contains(message, MessageKind::Approval));
+  EXPECT_FALSE(knowledge.insert(message, MessageKind::Assignment));
+  EXPECT_FALSE(knowledge.insert(message, MessageKind::Approval));
+  EXPECT_EQ(knowledge.size(), 1);
+}
+
+/**
+ * @given knowledge of validator assignment
+ * @when query other candidates bitfield or other validator
+ * @then they are unknown until inserted separately
+ */
+TEST(ApprovalKnowledgeTest, SubjectsAreDistinct) {
+  Knowledge knowledge;
+  EXPECT_TRUE(
+      knowledge.insert(subject({true, true}, 3), MessageKind::Assignment));
+
+  EXPECT_FALSE(
+      knowledge.contains(subject({true}, 3), MessageKind::Assignment));
+  EXPECT_FALSE(
+      knowledge.contains(subject({true, true}, 4), MessageKind::Assignment));
+  EXPECT_FALSE(
+      knowledge.contains(subject({true, true}, 1000), MessageKind::Assignment));
+
+  EXPECT_TRUE(knowledge.insert(subject({true}, 3), MessageKind::Approval));
+  EXPECT_TRUE(knowledge.contains(subject({true}, 3), MessageKind::Approval));
+  EXPECT_TRUE(
+      knowledge.contains(subject({true, true}, 3), MessageKind::Assignment));
+  EXPECT_EQ(knowledge.size(), 2);
+}
+
+/**
+ * @given empty knowledge
+ * @when insert subject of validator index over validators limit
+ * @then it is known like any other subject
+ */
+TEST(ApprovalKnowledgeTest, LargeValidatorIndex) {
+  Knowledge knowledge;
+  auto message = subject({true}, 100000);
+  EXPECT_TRUE(knowledge.insert(message, MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.contains(message, MessageKind::Assignment));
+  EXPECT_FALSE(
+      knowledge.contains(subject({true}, 100001), MessageKind::Assignment));
+  EXPECT_TRUE(knowledge.insert(message, MessageKind::Approval));
+  EXPECT_TRUE(knowledge.contains(message, MessageKind::Approval));
+  EXPECT_EQ(knowledge.size(), 1);
+}
+
+/**
+ * @given peer which sent us approval of one subject
+ * @when messages are marked as sent to peer
+ * @then only messages unknown by peer should be sent, once
+ */
+TEST(ApprovalKnowledgeTest, MarkSent) {
+  PeerKnowledge peer;
+  auto received = subject({true}, 1);
+  auto other = subject({true}, 2);
+  peer.received.insert(received, MessageKind::Approval);
+
+  EXPECT_FALSE(peer.markSent(received, MessageKind::Assignment));
+  EXPECT_FALSE(peer.markSent(received, MessageKind::Approval));
+
+  EXPECT_TRUE(peer.markSent(other, MessageKind::Assignment));
+  EXPECT_FALSE(peer.markSent(other, MessageKind::Assignment));
+  EXPECT_TRUE(peer.markSent(other, MessageKind::Approval));
+  EXPECT_FALSE(peer.markSent(other, MessageKind::Approval));
+}
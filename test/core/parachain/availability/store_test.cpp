@@ -0,0 +1,228 @@
+/**
+ * Copyright Quadrivium LLC
+ * All Rights Reserved
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "parachain/availability/store/store_impl.hpp"
+
+#include <gtest/gtest.h>
+#include <mock/libp2p/basic/scheduler_mock.hpp>
+
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/application/app_state_manager_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
+#include "parachain/availability/store/candidate_chunk_key.hpp"
+#include "storage/in_memory/in_memory_spaced_storage.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::CandidateChunkKey;
+using kagome::application::AppConfigurationMock;
+using kagome::application::AppStateManagerMock;
+using kagome::clock::SteadyClockMock;
+using kagome::common::Buffer;
+using kagome::parachain::AvailabilityStore;
+using kagome::parachain::AvailabilityStoreImpl;
+using kagome::primitives::events::ChainSubscriptionEngine;
+using kagome::storage::InMemorySpacedStorage;
+using kagome::storage::Space;
+using libp2p::basic::SchedulerMock;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::WithArg;
+
+class AvailabilityStoreTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    // 1 MiB hot tier
+    ON_CALL(app_config_, availabilityStoreMemoryLimit())
+        .WillByDefault(Return(1));
+    ON_CALL(clock_, nowUint64()).WillByDefault(Invoke([this] { return now_; }));
+    ON_CALL(*scheduler_, scheduleImpl(_, _, _))
+        .WillByDefault(WithArg<0>(Invoke([this](auto cb) {
+          scheduled_.emplace_back(std::move(cb));
+          return SchedulerMock::Handle{};
+        })));
+    store_ = makeStore();
+  }
+
+  std::shared_ptr<AvailabilityStoreImpl> makeStore() {
+    auto store = std::make_shared<AvailabilityStoreImpl>(
+        app_state_manager_,
+        app_config_,
+        clock_,
+        scheduler_,
+        storage_,
+        std::make_shared<ChainSubscriptionEngine>());
+    store->start();
+    return store;
+  }
+
+  /// Stores candidate with single chunk of `size` bytes
+  void store(const kagome::network::CandidateHash &candidate_hash,
+             size_t size) {
+    std::vector<AvailabilityStore::ErasureChunk> chunks(1);
+    chunks[0].chunk = Buffer(size, 1);
+    chunks[0].index = 0;
+    store_->storeData("relay"_hash256,
+                      candidate_hash,
+                      std::move(chunks),
+                      AvailabilityStore::ParachainBlock{},
+                      AvailabilityStore::PersistedValidationData{});
+  }
+
+  bool inDb(const kagome::network::CandidateHash &candidate_hash) {
+    return space()
+        ->contains(CandidateChunkKey::encode_data(candidate_hash))
+        .value();
+  }
+
+  std::shared_ptr<kagome::storage::BufferStorage> space() {
+    return storage_->getSpace(Space::kAvaliabilityStorage);
+  }
+
+  std::shared_ptr<testing::NiceMock<AppStateManagerMock>> app_state_manager_ =
+      std::make_shared<testing::NiceMock<AppStateManagerMock>>();
+  testing::NiceMock<AppConfigurationMock> app_config_;
+  testing::NiceMock<SteadyClockMock> clock_;
+  uint64_t now_ = 1;
+  std::shared_ptr<testing::NiceMock<SchedulerMock>> scheduler_ =
+      std::make_shared<testing::NiceMock<SchedulerMock>>();
+  std::vector<std::function<void()>> scheduled_;
+  std::shared_ptr<InMemorySpacedStorage> storage_ =
+      std::make_shared<InMemorySpacedStorage>();
+  std::shared_ptr<AvailabilityStoreImpl> store_;
+};
+
+/**
+ * @given store with 1 MiB memory budget
+ * @when three candidates of 400 KiB are stored
+ * @then oldest candidate is evicted from memory and read from database
+ */
+TEST_F(AvailabilityStoreTest, Evict) {
+  constexpr size_t kSize = 400 * 1024;
+  store("A"_hash256, kSize);
+  store("B"_hash256, kSize);
+  store("C"_hash256, kSize);
+
+  // eviction flushed pending writes
+  EXPECT_TRUE(inDb("A"_hash256));
+  EXPECT_TRUE(inDb("C"_hash256));
+  EXPECT_TRUE(store_->getChunk("A"_hash256, 0));
+
+  // evicted candidate is read only from database
+  space()->remove(CandidateChunkKey::encode("A"_hash256, 0)).value();
+  space()->remove(CandidateChunkKey::encode("C"_hash256, 0)).value();
+  EXPECT_FALSE(store_->getChunk("A"_hash256, 0));
+  EXPECT_TRUE(store_->getChunk("C"_hash256, 0));
+}
+
+/**
+ * @given store with small candidate
+ * @when store is stopped
+ * @then pending writes are flushed to database
+ */
+TEST_F(AvailabilityStoreTest, Flush) {
+  store("A"_hash256, 1);
+  EXPECT_FALSE(inDb("A"_hash256));
+  EXPECT_TRUE(store_->getChunk("A"_hash256, 0));
+
+  store_->stop();
+  EXPECT_TRUE(inDb("A"_hash256));
+}
+
+/**
+ * @given candidate persisted before restart
+ * @when keep timeout passes after restart
+ * @then persisted candidate is pruned
+ */
+TEST_F(AvailabilityStoreTest, PruneAfterRestart) {
+  store("A"_hash256, 1);
+  store_->remove("relay"_hash256);
+  store_->stop();
+  ASSERT_TRUE(inDb("A"_hash256));
+
+  store_ = makeStore();
+  now_ += 2 * 24 * 60 * 60;
+  store("B"_hash256, 1);
+  EXPECT_FALSE(inDb("A"_hash256));
+  EXPECT_FALSE(space()->contains(CandidateChunkKey::encode("A"_hash256, 0))
+                   .value());
+}
+
+/**
+ * @given candidate removed and stored again
+ * @when candidates exceed memory budget
+ * @then each candidate is evicted once, in order of last insertion
+ */
+TEST_F(AvailabilityStoreTest, EvictReinserted) {
+  constexpr size_t kSize = 400 * 1024;
+  store("A"_hash256, kSize);
+  store_->remove("relay"_hash256);
+  store("B"_hash256, kSize);
+  store("A"_hash256, kSize);
+  store("C"_hash256, kSize);
+
+  space()->remove(CandidateChunkKey::encode("A"_hash256, 0)).value();
+  space()->remove(CandidateChunkKey::encode("B"_hash256, 0)).value();
+  EXPECT_FALSE(store_->getChunk("B"_hash256, 0));
+  EXPECT_TRUE(store_->getChunk("A"_hash256, 0));
+}
+
+/**
+ * @given small candidate waiting for write-behind
+ * @when no more writes come and scheduled flush runs
+ * @then pending writes are flushed to database
+ */
+TEST_F(AvailabilityStoreTest, FlushTimer) {
+  store("A"_hash256, 1);
+  store("B"_hash256, 1);
+  ASSERT_EQ(scheduled_.size(), 1);
+  EXPECT_FALSE(inDb("A"_hash256));
+
+  scheduled_[0]();
+  EXPECT_TRUE(inDb("A"_hash256));
+  EXPECT_TRUE(inDb("B"_hash256));
+
+  store("C"_hash256, 1);
+  EXPECT_EQ(scheduled_.size(), 2);
+}
+
+/**
+ * @given small candidate waiting for write-behind
+ * @when its relay parent is removed
+ * @then candidate is flushed and still readable
+ */
+TEST_F(AvailabilityStoreTest, RemoveFlushes) {
+  store("A"_hash256, 1);
+  EXPECT_FALSE(inDb("A"_hash256));
+
+  store_->remove("relay"_hash256);
+  EXPECT_TRUE(inDb("A"_hash256));
+  EXPECT_TRUE(store_->getChunk("A"_hash256, 0));
+  EXPECT_TRUE(store_->getPov("A"_hash256));
+}
+
+/**
+ * @given candidate evicted from memory
+ * @when another chunk of it is put
+ * @then both persisted and new chunks are returned
+ */
+TEST_F(AvailabilityStoreTest, GetChunksMergesPersisted) {
+  constexpr size_t kSize = 400 * 1024;
+  store("A"_hash256, kSize);
+  store("B"_hash256, kSize);
+  store("C"_hash256, kSize);
+
+  AvailabilityStore::ErasureChunk chunk;
+  chunk.chunk = Buffer(1, 2);
+  chunk.index = 1;
+  store_->putChunk("relay"_hash256, "A"_hash256, std::move(chunk));
+  EXPECT_EQ(store_->getChunks("A"_hash256).size(), 2);
+}
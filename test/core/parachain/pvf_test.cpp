@@ -29,6 +29,8 @@
 #include "parachain/pvf/pvf_thread_pool.hpp"
 #include "parachain/pvf/pvf_worker_types.hpp"
 #include "parachain/types.hpp"
+#include "runtime/common/runtime_artifact_store.hpp"
+#include "runtime/common/uncompressed_code_cache.hpp"
 #include "runtime/executor.hpp"
 #include "runtime/instance_environment.hpp"
 #include "testutil/literals.hpp"
@@ -54,6 +56,8 @@ using kagome::runtime::ModuleFactoryMock;
 using kagome::runtime::ModuleInstanceMock;
 using kagome::runtime::ModuleMock;
 using kagome::runtime::NoopWasmInstrumenter;
+using kagome::runtime::RuntimeArtifactStore;
+using kagome::runtime::UncompressedCodeCache;
 namespace application = kagome::application;
 namespace crypto = kagome::crypto;
 namespace runtime = kagome::runtime;
@@ -106,9 +110,13 @@ class PvfTest : public testing::Test {
         },
         nullptr,
         hasher_,
-        std::make_shared<PvfPool>(*app_config_,
-                                  module_factory_,
-                                  std::make_shared<NoopWasmInstrumenter>()),
+        std::make_shared<PvfPool>(
+            *app_config_,
+            module_factory_,
+            std::make_shared<NoopWasmInstrumenter>(),
+            std::make_shared<RuntimeArtifactStore>(
+                std::filesystem::temp_directory_path(), 0),
+            std::make_shared<UncompressedCodeCache>()),
         block_tree,
         sr25519_provider,
         parachain_api,
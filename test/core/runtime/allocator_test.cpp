@@ -5,6 +5,10 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
+#include <boost/endian/conversion.hpp>
+
 #include "runtime/common/memory_allocator.hpp"
 #include "scale/tie.hpp"
 #include "testutil/runtime/memory.hpp"
@@ -13,7 +17,10 @@ using kagome::common::unhex;
 using kagome::runtime::MemoryAllocator;
 using kagome::runtime::MemoryAllocatorImpl;
 using kagome::runtime::MemoryConfig;
+using kagome::runtime::MemoryHandle;
 using kagome::runtime::TestMemory;
+using kagome::runtime::WasmPointer;
+using kagome::runtime::WasmSize;
 
 struct Replay {
   SCALE_TIE(3);
@@ -56,3 +63,162 @@ TEST(AllocatorTest, Test) {
   test("00002000303c1500711400ec010000383c1500003c000000403e1500006d000000883e15000072000000103f15000021000000983f15000020060000e03f1500006d000000e84715000050000000704815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000005000000104915000005000000204915000120491500011049150000200000003049150001304915000010000000f848150001f84815000010000000f848150001f8481500000b000000f848150000060000001049150001f848150001104915000010000000f848150001f84815000010000000f848150001f848150000080000001049150001104915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000180000003049150000080000001049150000740000005849150001104915000075000000e04915000130491500015849150001e04915000010000000f848150001f84815000010000000f848150001f848150000200000003049150001304915000010000000f848150001f84815000010000000f848150001f84815000008000000104915000110491500000c000000f8481500002c000000684a150001f8481500002000000030491500013049150001684a15000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000010000001049150001104915000010000000f848150001f84815000010000000f848150001f84815000078000000e0491500001400000030491500006d0000005849150001e0491500015849150001304915000010000000f848150001f84815000010000000f848150001f848150000010000001049150001104915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000054000000584915000050000000e049150001584915000050000000584915000010000000f848150001f84815000010000000f848150001f8481500000100000010491500011049150001e04915000008000000104915000022000000684a150001104915000044000000e049150001684a15000088000000b04a150001e04915000010000000f848150001f84815000010000000f848150001f84815000008000000104915000079000000e0491500011049150001e049150001b04a150001584915000010000000f848150001f84815000010000000f848150001f848150000010000001049150001104915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000010000001049150000080000002049150001104915000010000000f84815000120491500002000000030491500002e000000684a150001f848150001304915000040000000b84b1500006e0000005849150001684a150001b84b150001584915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000f1000000b04a15000028000000b84b1500006d000000584915000072000000e049150001b04a15000010000000f848150001f84815000010000000f848150001f84815000044000000004c15000040000000684a150001004c150001684a15000010000000f848150001f84815000010000000f848150001f84815000020000000304915000130491500015849150001e049150001b84b15000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f848150000200000003049150000080000002049150001204915000028000000b84b150001304915000054000000e049150001b84b150001f8481500000100000020491500012049150001e04915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000022000000b84b150001b84b15000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000040000000b84b150001b84b15000010000000f848150001f84815000010000000f848150001f8481500002e000000b84b150001b84b15000000020000884c15000060000000e04915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000020000000304915000010000000f848150001f84815000010000000f848150001f84815000022000000b84b150001b84b15000008000000204915000020000000904e15000025000000b84b1500012049150001904e1500004a0000005849150001b84b15000020000000904e15000094000000b04a1500015849150001904e15000020000000904e150001904e15000020000000904e150001904e150001b04a15000010000000f848150001f84815000010000000f848150001f84815000008000000204915000028000000b84b150001204915000020000000904e150001904e150001b84b15000008000000204915000020000000904e15000025000000b84b1500012049150001904e1500004a0000005849150001b84b15000020000000904e15000094000000b04a1500015849150001904e15000020000000904e150001904e1500000800000020491500007400000058491500012049150001b04a1500000f000000f84815000020000000904e1500002c000000b84b150001f848150001904e150001b84b1500015849150001884c15000010000000f848150001f84815000010000000f848150001f8481500013049150001e04915000008000000204915000020000000304915000025000000b84b150001204915000130491500004a000000e049150001b84b15000020000000304915000094000000b04a150001e049150001304915000020000000304915000130491500002000000030491500013049150001b04a15000008000000204915000020000000304915000021000000b84b1500012049150001304915000010000000f848150001f84815000010000000f848150001f84815000008000000204915000027000000684a1500012049150001684a150001b84b15000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000200000003049150001304915000010000000f848150001f84815000010000000f848150001f84815000071000000e049150001e04915000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000100000020491500012049150000080000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000001000000204915000120491500000800000020491500012049150000080000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000400000020491500000c000000f8481500012049150001f84815000010000000f848150001f84815000010000000f848150001f84815000020000000304915000010000000f848150001f84815000030000000b84b150001304915000050000000e049150001b84b1500005300000058491500015849150001e04915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f8481500002c000000b84b150001f8481500000100000020491500012049150001b84b15000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f8481500002c000000b84b150001f848150001b84b15000010000000f848150001f84815000010000000f848150001f848150000ca000000b04a150001b04a15000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000040000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000ca000000b04a150001b04a15000010000000f848150001f84815000010000000f848150001f84815000020000000304915000020000000904e15000022000000b84b15000020000000b84e150001b84b150001b84e150001904e150001304915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000080000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000008000000204915000010000000f8481500012049150001f84815000010000000f848150001f84815000010000000f848150001f8481500000800000020491500012049150001e847150001704815000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f8481500002c000000b84b150001f84815000022000000684a150001684a150001b84b15000088010000884c1500000b000000f848150001884c150000060000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000008000000204915000120491500000c000000e04e1500002c000000b84b150001e04e1500000f000000e04e150001e04e150001b84b150001f84815000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000f000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000008000000204915000010000000f8481500012049150001f84815000010000000f84815000010000000e04e150001f84815000010000000f84815000010000000f84e1500000100000020491500012049150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e1500000a000000e04e150001e04e1500000600000020491500012049150001f84815000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000070000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000008000000204915000010000000f8481500012049150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000080000002049150001204915000088010000884c1500002000000030491500013049150000200000003049150001304915000020000000304915000130491500006a0000007048150001884c150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f8481500002c000000b84b150001f8481500006e000000e847150001e847150001b84b150001704815000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000f000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000008000000204915000010000000f8481500012049150001f84815000010000000f84815000010000000e04e150001f84815000010000000f8481500000100000020491500012049150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000022000000b84b150001b84b15000020000000304915000020000000904e150001304915000040000000b84b150001904e15000020000000904e150000800000007048150001b84b150001904e15000020000000904e150001904e15000020000000904e150001904e150001704815000010000000e04e150001e04e15000010000000e04e150001e04e150000060000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000060000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000ca000000b04a150001b04a15000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000006000000204915000120491500002d000000b84b150001b84b15000010000000e04e150001e04e15000010000000e04e150001e04e150000030000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000ca000000b04a150001b04a15000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000044000000704815000040000000b84b150001704815000010000000e04e150001e04e15000010000000e04e150001e04e150000060000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000022000000684a150001684a15000010000000e04e150001e04e15000010000000e04e150001e04e1500000600000020491500012049150001b84b15000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000080000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000060000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000ca000000b04a150001b04a15000010000000e04e150001e04e15000010000000e04e150001e04e150000060000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000003000000204915000120491500001c000000904e15000010000000e04e150001e04e15000010000000e04e150001e04e15000020000000304915000020000000b84e15000022000000b84b15000020000000104f150001b84b150001104f150001b84e1500013049150001904e15000010000000e04e150001e04e15000010000000e04e150001e04e150000ca000000b04a150001b04a15000010000000e04e150001e04e15000010000000e04e150001e04e150000070000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000080000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000ca000000b04a150001b04a15000010000000e04e150001e04e15000010000000e04e150001e04e150000030000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000040000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000030000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000070000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000030000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000080000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000080000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000ca000000b04a150001b04a15000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e150000010000002049150001204915000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000010000000e04e150001e04e15000004000000204915000120491500000600000020491500012049150001f84815000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000070000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000008000000204915000010000000f8481500012049150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000800000020491500012049150001e03f150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000080000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000f000000f848150001f84815000010000000f848150001f84815000010000000f848150001f8481500000f000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000008000000204915000010000000f8481500012049150001f84815000010000000f848150001f84815000010000000f848150001f848150000710000007048150001704815000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000054000000704815000050000000e847150001704815000010000000f848150001f84815000010000000f848150001f8481500000a000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000100000020491500012049150001e84715000010000000f848150001f84815000010000000f848150001f84815000021000000b84b150001b84b15000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000030000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f8481500000f000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000020000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000040000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000010000002049150001204915000010000000f848150001f84815000010000000f848150001f848150000020000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000010000000f848150001f84815000010000000f848150001f84815000022000000b84b150001b84b15000010000000f848150001f84815000010000000f848150001f84815000018010000884c1500003c000000b84b1500006d000000e84715000072000000704815000021000000684a150001884c15000010000000f848150001f84815000010000000f848150001f848150000060000002049150001204915000018000000904e15000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f8481500002c000000384f150001f8481500000e000000f8481500000b000000e04e150001f848150001384f15000010000000f848150001f84815000010000000f848150001f84815000008000000204915000120491500000c000000f8481500002c000000384f150001f8481500006f000000e0491500006a0000005849150001e049150001384f1500001c000000304915000079000000e04915000130491500002000000030491500013049150001e049150001e04e1500015849150001904e15000020000000904e150001904e150001e8471500017048150001684a150001b84b150001883e150001103f150001983f150001403e1500");
   // clang-format on
 }
+
+/**
+ * Straightforward freeing-bump allocator, as in substrate:
+ * https://github.com/paritytech/polkadot-sdk/blob/polkadot-v1.7.0/substrate/client/allocator/src/freeing_bump.rs
+ */
+struct ReferenceAllocator {
+  static constexpr uint32_t kOrders = 23;
+  static constexpr uint32_t kMinAllocate = 8;
+  static constexpr uint32_t kMaxAllocate = kMinAllocate << (kOrders - 1);
+  static constexpr uint64_t kOccupied = uint64_t{1} << 32;
+  static constexpr uint32_t kNil = UINT32_MAX;
+  static constexpr uint64_t kMaxPages = (uint64_t{4} << 30) / (64 << 10);
+
+  uint64_t read(WasmPointer ptr) const {
+    return boost::endian::load_little_u64(memory->view(ptr, 8).value().data());
+  }
+
+  void write(WasmPointer ptr, uint64_t v) {
+    boost::endian::store_little_u64(memory->view(ptr, 8).value().data(), v);
+  }
+
+  WasmPointer allocate(WasmSize size) {
+    if (size > kMaxAllocate) {
+      throw std::runtime_error{"RequestedAllocationTooLarge"};
+    }
+    uint32_t chunk = kMinAllocate;
+    uint32_t order = 0;
+    while (chunk < size) {
+      chunk *= 2;
+      ++order;
+    }
+    uint32_t head;  // NOLINT(cppcoreguidelines-init-variables)
+    if (free_lists[order] != kNil) {
+      head = free_lists[order];
+      auto header = read(head);
+      if ((header & kOccupied) != 0) {
+        throw std::runtime_error{"free list points to a occupied header"};
+      }
+      free_lists[order] = static_cast<uint32_t>(header);
+    } else {
+      head = bumper;
+      uint64_t next = uint64_t{bumper} + 8 + chunk;
+      if (next > memory->size()) {
+        uint64_t page = 64 << 10;
+        auto pages = (next + page - 1) / page;
+        if (pages > kMaxPages) {
+          throw std::runtime_error{"max pages"};
+        }
+        pages = std::max(pages, 2 * ((memory->size() + page - 1) / page));
+        pages = std::min(pages, kMaxPages);
+        memory->resize(pages * page);
+      }
+      bumper = next;
+    }
+    write(head, kOccupied | order);
+    return head + 8;
+  }
+
+  void deallocate(WasmPointer ptr) {
+    if (ptr < 8) {
+      throw std::runtime_error{"Invalid pointer for deallocation"};
+    }
+    auto head = ptr - 8;
+    auto header = read(head);
+    auto order = static_cast<uint32_t>(header);
+    if (order >= kOrders or (header & kOccupied) == 0) {
+      throw std::runtime_error{"invalid header"};
+    }
+    write(head, free_lists[order]);
+    free_lists[order] = head;
+  }
+
+  std::shared_ptr<MemoryHandle> memory;
+  uint32_t bumper;
+  std::array<uint32_t, kOrders> free_lists = [] {
+    std::array<uint32_t, kOrders> lists;
+    lists.fill(kNil);
+    return lists;
+  }();
+};
+
+/**
+ * @given allocator and reference substrate allocator on equal memories
+ * @when random allocations, deallocations and memory growths are replayed on
+ * both of them
+ * @then they return same pointers and leave same memory contents
+ */
+TEST(AllocatorTest, DifferentialFuzz) {
+  constexpr WasmPointer kHeapBase = 1 << 16;
+  for (uint32_t seed = 0; seed < 20; ++seed) {
+    std::mt19937 random{seed};
+    TestMemory memory;
+    TestMemory reference_memory;
+    memory.handle->resize(2 * kHeapBase);
+    reference_memory.handle->resize(2 * kHeapBase);
+    MemoryAllocatorImpl allocator{memory.handle, MemoryConfig{kHeapBase}};
+    ReferenceAllocator reference{reference_memory.handle, kHeapBase};
+
+    std::vector<WasmPointer> allocated;
+    for (size_t i = 0; i < 2000; ++i) {
+      auto op = random() % 100;
+      if (op < 55 or allocated.empty()) {
+        // mostly small allocations, sometimes large ones
+        auto size = op % 16 == 0 ? random() % (1 << 18) : random() % 300;
+        auto ptr = allocator.allocate(size);
+        ASSERT_EQ(ptr, reference.allocate(size)) << "seed " << seed;
+        allocated.emplace_back(ptr);
+      } else if (op < 99) {
+        auto index = random() % allocated.size();
+        allocator.deallocate(allocated[index]);
+        reference.deallocate(allocated[index]);
+        allocated[index] = allocated.back();
+        allocated.pop_back();
+      } else {
+        // runtime grows memory by itself, memory may move
+        auto size = memory.handle->size() + (64 << 10);
+        memory.handle->resize(size);
+        reference_memory.handle->resize(size);
+      }
+    }
+    ASSERT_EQ(memory.m, reference_memory.m) << "seed " << seed;
+  }
+}
+
+/**
+ * @given allocator with statistics enabled
+ * @when chunks of different orders are allocated and deallocated
+ * @then per order counters and high-water marks are updated and merged into
+ * total statistics on destruction
+ */
+TEST(AllocatorTest, Stats) {
+  MemoryAllocatorImpl::enableStats(true);
+  auto total_before = MemoryAllocatorImpl::totalStats();
+  {
+    TestMemory memory;
+    memory.handle->resize(1 << 16);
+    MemoryAllocatorImpl allocator{memory.handle, MemoryConfig{1 << 10}};
+    ASSERT_TRUE(allocator.stats());
+    auto ptr1 = allocator.allocate(8);
+    auto ptr2 = allocator.allocate(5);
+    allocator.deallocate(ptr1);
+    allocator.allocate(100);
+    allocator.deallocate(ptr2);
+    allocator.allocate(1);
+
+    auto &stats = *allocator.stats();
+    EXPECT_EQ(stats.orders[0].allocations, 3);
+    EXPECT_EQ(stats.orders[0].in_use, 1);
+    EXPECT_EQ(stats.orders[0].max_in_use, 2);
+    EXPECT_EQ(stats.orders[4].allocations, 1);
+    EXPECT_EQ(stats.orders[4].max_in_use, 1);
+    EXPECT_EQ(stats.max_heap, 2 * (8 + 8) + (8 + 128));
+  }
+  MemoryAllocatorImpl::enableStats(false);
+  auto total = MemoryAllocatorImpl::totalStats();
+  EXPECT_EQ(total.orders[0].allocations,
+            total_before.orders[0].allocations + 3);
+  EXPECT_EQ(total.max_heap, std::max<WasmSize>(total_before.max_heap, 168));
+}
@@ -10,6 +10,8 @@
 
 #include "core/runtime/binaryen/binaryen_runtime_test.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
+#include "runtime/common/concurrent_call_executor.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
 #include "testutil/lazy.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/runtime/common/basic_code_provider.hpp"
@@ -21,6 +23,7 @@ using kagome::blockchain::BlockTreeMock;
 using kagome::primitives::BlockNumber;
 using kagome::primitives::Extrinsic;
 using kagome::primitives::TransactionSource;
+using kagome::runtime::ConcurrentCallExecutor;
 using kagome::runtime::TaggedTransactionQueue;
 using kagome::runtime::TaggedTransactionQueueImpl;
 
@@ -32,7 +35,16 @@ class TTQTest : public BinaryenRuntimeTest {
     block_tree_ = std::make_shared<BlockTreeMock>();
 
     ttq_ = std::make_unique<TaggedTransactionQueueImpl>(
-        executor_, testutil::sptr_to_lazy<BlockTree>(block_tree_));
+        executor_,
+        std::make_shared<ConcurrentCallExecutor>(
+            module_repo_,
+            ctx_factory_,
+            block_tree_,
+            std::make_shared<kagome::storage::trie::PolkadotCodec>(),
+            serializer_,
+            ConcurrentCallExecutor::Cost{std::chrono::seconds{1}}),
+        testutil::sptr_to_lazy<BlockTree>(block_tree_),
+        hasher_);
   }
 
  protected:
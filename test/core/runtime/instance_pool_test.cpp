@@ -6,6 +6,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <fstream>
 #include <random>
 #include <ranges>
 
@@ -13,20 +14,20 @@
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
 
+#include "runtime/common/runtime_artifact_store.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
 
-#include "mock/core/application/app_configuration_mock.hpp"
 #include "mock/core/runtime/instrument_wasm.hpp"
 #include "mock/core/runtime/module_factory_mock.hpp"
 #include "mock/core/runtime/module_instance_mock.hpp"
 #include "mock/core/runtime/module_mock.hpp"
 
-using kagome::application::AppConfigurationMock;
 using kagome::common::Buffer;
 using kagome::runtime::ModuleFactoryMock;
 using kagome::runtime::ModuleInstanceMock;
 using kagome::runtime::ModuleMock;
 using kagome::runtime::NoopWasmInstrumenter;
+using kagome::runtime::RuntimeArtifactStore;
 using kagome::runtime::RuntimeContext;
 using kagome::runtime::RuntimeInstancesPool;
 using kagome::runtime::RuntimeInstancesPoolImpl;
@@ -39,6 +40,19 @@ RuntimeInstancesPool::CodeHash make_code_hash(int i) {
       .value();
 }
 
+/// Empty cache directory for test
+std::filesystem::path make_cache_dir() {
+  auto dir =
+      std::filesystem::temp_directory_path() / "instance_pool_test_cache";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+  return dir;
+}
+
+void write_artifact(const std::filesystem::path &path, size_t size) {
+  std::ofstream{path, std::ios::binary} << std::string(size, 'a');
+}
+
 TEST(InstancePoolTest, HeavilyMultithreadedCompilation) {
   testutil::prepareLoggers();
 
@@ -56,12 +70,10 @@ TEST(InstancePoolTest, HeavilyMultithreadedCompilation) {
   static constexpr int THREAD_NUM = 100;
   static constexpr int POOL_SIZE = 10;
 
-  AppConfigurationMock app_config;
-  EXPECT_CALL(app_config, runtimeCacheDirPath()).WillRepeatedly(Return("/tmp"));
   auto pool = std::make_shared<RuntimeInstancesPoolImpl>(
-      app_config,
       module_factory,
       std::make_shared<NoopWasmInstrumenter>(),
+      std::make_shared<RuntimeArtifactStore>(make_cache_dir(), 0),
       POOL_SIZE);
 
   EXPECT_CALL(*module_factory, compilerType())
@@ -101,3 +113,112 @@ TEST(InstancePoolTest, HeavilyMultithreadedCompilation) {
         {}));
   }
 }
+
+/**
+ * @given artifact store with budget for two artifacts
+ * @when third artifact is added
+ * @then least recently used artifact is removed, index survives restart
+ */
+TEST(InstancePoolTest, ArtifactStoreEvictsLeastRecentlyUsed) {
+  testutil::prepareLoggers();
+  auto dir = make_cache_dir();
+  auto a = dir / "a", b = dir / "b", c = dir / "c";
+  for (auto &path : {a, b, c}) {
+    write_artifact(path, 100);
+  }
+  {
+    RuntimeArtifactStore store{dir, 250};
+    ASSERT_OUTCOME_SUCCESS_TRY(store.add(a));
+    ASSERT_OUTCOME_SUCCESS_TRY(store.add(b));
+    ASSERT_OUTCOME_SUCCESS(cached, store.contains(a));
+    EXPECT_TRUE(cached);
+    ASSERT_OUTCOME_SUCCESS_TRY(store.add(c));
+    EXPECT_EQ(store.size(), 200);
+  }
+  EXPECT_TRUE(std::filesystem::exists(a));
+  EXPECT_FALSE(std::filesystem::exists(b));
+  EXPECT_TRUE(std::filesystem::exists(c));
+
+  RuntimeArtifactStore store{dir, 250};
+  EXPECT_EQ(store.size(), 200);
+  ASSERT_OUTCOME_SUCCESS(cached, store.contains(b));
+  EXPECT_FALSE(cached);
+}
+
+/**
+ * @given artifact store with budget for two artifacts, oldest one pinned
+ * @when third artifact is added
+ * @then pinned artifact is kept and next least recently used is removed
+ */
+TEST(InstancePoolTest, ArtifactStoreKeepsPinned) {
+  testutil::prepareLoggers();
+  auto dir = make_cache_dir();
+  auto a = dir / "a", b = dir / "b", c = dir / "c";
+  for (auto &path : {a, b, c}) {
+    write_artifact(path, 100);
+  }
+  RuntimeArtifactStore store{dir, 250};
+  ASSERT_OUTCOME_SUCCESS_TRY(store.add(a));
+  ASSERT_OUTCOME_SUCCESS_TRY(store.add(b));
+  store.pin(a);
+  ASSERT_OUTCOME_SUCCESS_TRY(store.add(c));
+  store.unpin(a);
+  EXPECT_TRUE(std::filesystem::exists(a));
+  EXPECT_FALSE(std::filesystem::exists(b));
+  EXPECT_TRUE(std::filesystem::exists(c));
+}
+
+/**
+ * @given indexed artifact
+ * @when artifact is modified on disk
+ * @then it is reported as missing and removed
+ */
+TEST(InstancePoolTest, ArtifactStoreRemovesCorrupted) {
+  testutil::prepareLoggers();
+  auto dir = make_cache_dir();
+  auto a = dir / "a";
+  write_artifact(a, 100);
+  {
+    RuntimeArtifactStore store{dir, 0};
+    ASSERT_OUTCOME_SUCCESS_TRY(store.add(a));
+  }
+  write_artifact(a, 100);
+  std::ofstream{a, std::ios::binary | std::ios::app} << 'b';
+
+  RuntimeArtifactStore store{dir, 0};
+  ASSERT_OUTCOME_SUCCESS(cached, store.contains(a));
+  EXPECT_FALSE(cached);
+  EXPECT_FALSE(std::filesystem::exists(a));
+  EXPECT_EQ(store.size(), 0);
+}
+
+/**
+ * @given two pools sharing artifact store
+ * @when both instantiate same code
+ * @then module is compiled and loaded once
+ */
+TEST(InstancePoolTest, PoolsShareLoadedModules) {
+  testutil::prepareLoggers();
+  auto module_mock = std::make_shared<ModuleMock>();
+  EXPECT_CALL(*module_mock, instantiate())
+      .WillRepeatedly(Return(std::make_shared<ModuleInstanceMock>()));
+  auto module_factory = std::make_shared<ModuleFactoryMock>();
+  EXPECT_CALL(*module_factory, compilerType())
+      .WillRepeatedly(Return(std::nullopt));
+  EXPECT_CALL(*module_factory, compile(_, _, _))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*module_factory, loadCompiled(_, _))
+      .WillOnce(Return(module_mock));
+
+  auto artifacts = std::make_shared<RuntimeArtifactStore>(make_cache_dir(), 0);
+  auto instrument = std::make_shared<NoopWasmInstrumenter>();
+  auto relay_pool = std::make_shared<RuntimeInstancesPoolImpl>(
+      module_factory, instrument, artifacts);
+  auto pvf_pool = std::make_shared<RuntimeInstancesPoolImpl>(
+      module_factory, instrument, artifacts);
+  auto code = std::make_shared<Buffer>("runtime_code"_buf);
+  ASSERT_OUTCOME_SUCCESS_TRY(relay_pool->instantiateFromCode(
+      make_code_hash(0), [&] { return code; }, {}));
+  ASSERT_OUTCOME_SUCCESS_TRY(pvf_pool->instantiateFromCode(
+      make_code_hash(0), [&] { return code; }, {}));
+}
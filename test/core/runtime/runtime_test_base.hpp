@@ -25,7 +25,6 @@
 #include "crypto/sr25519/sr25519_provider_impl.hpp"
 #include "filesystem/common.hpp"
 #include "host_api/impl/host_api_factory_impl.hpp"
-#include "mock/core/application/app_configuration_mock.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
 #include "mock/core/offchain/offchain_persistent_storage_mock.hpp"
@@ -41,9 +40,11 @@
 #include "primitives/block_header.hpp"
 #include "primitives/block_id.hpp"
 #include "runtime/common/module_repository_impl.hpp"
+#include "runtime/common/runtime_artifact_store.hpp"
 #include "runtime/common/runtime_execution_error.hpp"
 #include "runtime/common/runtime_instances_pool.hpp"
 #include "runtime/common/runtime_upgrade_tracker_impl.hpp"
+#include "runtime/common/uncompressed_code_cache.hpp"
 #include "runtime/core_api_factory.hpp"
 #include "runtime/executor.hpp"
 #include "runtime/module.hpp"
@@ -54,7 +55,6 @@
 #include "testutil/outcome.hpp"
 #include "testutil/runtime/common/basic_code_provider.hpp"
 
-using kagome::application::AppConfigurationMock;
 using kagome::runtime::RuntimeInstancesPoolImpl;
 using testing::_;
 using testing::Invoke;
@@ -136,7 +136,8 @@ class RuntimeTestBaseImpl {
         hasher_,
         key_store,
         offchain_storage_,
-        offchain_worker_pool_);
+        offchain_worker_pool_,
+        nullptr);
 
     block_tree_ =
         std::make_shared<testing::NiceMock<blockchain::BlockTreeMock>>();
@@ -189,23 +190,22 @@ class RuntimeTestBaseImpl {
     auto wasm_cache_dir =
         filesystem::temp_directory_path() / "runtime_test_base_cache";
     std::filesystem::create_directories(wasm_cache_dir);
-    EXPECT_CALL(app_config_, runtimeCacheDirPath())
-        .WillOnce(Return(wasm_cache_dir));
     instance_pool_ = std::make_shared<RuntimeInstancesPoolImpl>(
-        app_config_,
         module_factory,
-        std::make_shared<runtime::WasmInstrumenter>());
-    auto module_repo =
-        std::make_shared<runtime::ModuleRepositoryImpl>(instance_pool_,
-                                                        hasher_,
-                                                        block_tree_,
-                                                        upgrade_tracker,
-                                                        trie_storage_,
-                                                        module_factory,
-                                                        wasm_provider_);
+        std::make_shared<runtime::WasmInstrumenter>(),
+        std::make_shared<runtime::RuntimeArtifactStore>(wasm_cache_dir, 0));
+    module_repo_ = std::make_shared<runtime::ModuleRepositoryImpl>(
+        instance_pool_,
+        hasher_,
+        block_tree_,
+        upgrade_tracker,
+        trie_storage_,
+        module_factory,
+        wasm_provider_,
+        std::make_shared<runtime::UncompressedCodeCache>());
 
     ctx_factory_ = std::make_shared<runtime::RuntimeContextFactoryImpl>(
-        module_repo, block_tree_);
+        module_repo_, block_tree_);
 
     executor_ = std::make_shared<runtime::Executor>(ctx_factory_, cache_);
   }
@@ -280,7 +280,6 @@ class RuntimeTestBaseImpl {
   }
 
  protected:
-  AppConfigurationMock app_config_;
   std::shared_ptr<testing::NiceMock<blockchain::BlockTreeMock>> block_tree_;
   std::shared_ptr<runtime::RuntimeCodeProvider> wasm_provider_;
   std::shared_ptr<storage::trie::TrieStorageMock> trie_storage_;
@@ -288,6 +287,7 @@ class RuntimeTestBaseImpl {
   std::shared_ptr<runtime::RuntimePropertiesCacheMock> cache_;
   std::shared_ptr<runtime::Executor> executor_;
   std::shared_ptr<runtime::RuntimeContextFactoryImpl> ctx_factory_;
+  std::shared_ptr<runtime::ModuleRepositoryImpl> module_repo_;
   std::shared_ptr<offchain::OffchainPersistentStorageMock> offchain_storage_;
   std::shared_ptr<offchain::OffchainWorkerPoolMock> offchain_worker_pool_;
   std::shared_ptr<crypto::HasherImpl> hasher_;
@@ -287,3 +287,41 @@ TEST(WasmInstrumentTest, memory_import_limit) {
       .value();
   expectWasm(*module, memory_limit_static.second);
 }
+
+/// Module with `n` functions, each calling previous one.
+std::string watCallChain(size_t n) {
+  std::string wat = "(module\n";
+  for (size_t i = 0; i < n; ++i) {
+    wat += fmt::format(
+        "  (func (param i32) (result i32)\n"
+        "    local.get 0 i32.const 1 i32.add{})\n",
+        i == 0 ? "" : fmt::format(" call {}", i - 1));
+  }
+  wat += fmt::format("  (export \"main\" (func {})))", n - 1);
+  return wat;
+}
+
+/**
+ * @given module large enough to be instrumented on several threads
+ * @when it is instrumented with different stack limits by same instrumenter
+ * @then output matches uncached instrumentation, and is cached
+ */
+TEST(WasmInstrumentTest, cached_stack_costs) {
+  testutil::prepareLoggers();
+  auto code = wabtEncode(*kagome::runtime::fromWat(watCallChain(500))).value();
+  kagome::runtime::RuntimeContext::ContextParams config1, config2;
+  config1.memory_limits.max_stack_values_num = 1024;
+  config2.memory_limits.max_stack_values_num = 2048;
+  auto fresh1 =
+      kagome::runtime::instrumentCodeForCompilation(code, config1).value();
+  auto fresh2 =
+      kagome::runtime::instrumentCodeForCompilation(code, config2).value();
+  EXPECT_NE(fresh1, fresh2);
+
+  kagome::runtime::WasmInstrumenter instrumenter;
+  EXPECT_EQ(instrumenter.instrument(code, config1).value(), fresh1);
+  // reuses stack costs of same code
+  EXPECT_EQ(instrumenter.instrument(code, config2).value(), fresh2);
+  // cached output
+  EXPECT_EQ(instrumenter.instrument(code, config1).value(), fresh1);
+}
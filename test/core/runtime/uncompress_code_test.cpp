@@ -5,7 +5,12 @@
  */
 #include "runtime/common/uncompress_code_if_needed.hpp"
 
+#include <thread>
+
 #include <gtest/gtest.h>
+#include <zstd.h>
+
+#include "runtime/common/uncompressed_code_cache.hpp"
 
 #include "testutil/prepare_loggers.hpp"
 
@@ -55,3 +60,85 @@ TEST_F(UncompressCodeIfNeeded, UncompressSucceed) {
   std::ignore = uncompressCodeIfNeeded(buf, res);
   ASSERT_EQ(res, common::Buffer({'b', 'a', 'b', 'e'}));
 }
+
+/**
+ * Compresses with zstd prefix, optionally without content size in frame
+ * header (like streamed blob).
+ */
+common::Buffer compress(common::BufferView code, bool content_size) {
+  common::Buffer res({0x52, 0xBC, 0x53, 0x76, 0x46, 0xDB, 0x8E, 0x05});
+  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx{ZSTD_createCCtx(),
+                                                           &ZSTD_freeCCtx};
+  ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_contentSizeFlag, content_size);
+  common::Buffer out(ZSTD_compressBound(code.size()), 0);
+  ZSTD_inBuffer in{code.data(), code.size(), 0};
+  ZSTD_outBuffer out_buf{out.data(), out.size(), 0};
+  EXPECT_EQ(ZSTD_compressStream2(ctx.get(), &out_buf, &in, ZSTD_e_end), 0);
+  out.resize(out_buf.pos);
+  res.put(out);
+  return res;
+}
+
+/**
+ * @given code compressed without content size in frame header
+ * @when uncompress
+ * @then output buffer grows until whole code is uncompressed
+ */
+TEST_F(UncompressCodeIfNeeded, UncompressUnknownSize) {
+  common::Buffer code;
+  for (size_t i = 0; i < (1 << 20); ++i) {
+    code.putUint8(i % 251);
+  }
+  auto buf = compress(code, false);
+  common::Buffer res;
+  ASSERT_TRUE(uncompressCodeIfNeeded(buf, res));
+  ASSERT_EQ(res, code);
+}
+
+/**
+ * @given code over bomb limit, compressed with and without content size
+ * @when uncompress
+ * @then BOMB_SIZE_REACHED, result is not changed
+ */
+TEST_F(UncompressCodeIfNeeded, UncompressBomb) {
+  common::Buffer code(50 * 1024 * 1024 + 1, 0);
+  for (auto content_size : {true, false}) {
+    auto buf = compress(code, content_size);
+    common::Buffer res({0xAA});
+    auto r = uncompressCodeIfNeeded(buf, res);
+    ASSERT_FALSE(r);
+    ASSERT_EQ(r.error(), UncompressError::BOMB_SIZE_REACHED);
+    ASSERT_EQ(res, common::Buffer({0xAA}));
+  }
+}
+
+/**
+ * @given uncompressed code cache
+ * @when same code is requested concurrently and while previous result is held
+ * @then all callers share single uncompressed buffer
+ */
+TEST_F(UncompressCodeIfNeeded, CacheSharesCode) {
+  UncompressedCodeCache cache;
+  auto buf =
+      common::Buffer::fromHex("52BC537646DB8E0528B52FFD200421000062616265")
+          .value();
+  common::Hash256 hash;
+  hash[0] = 1;
+  std::vector<UncompressedCodeCache::Code> codes(8);
+  std::vector<std::thread> threads;
+  for (auto &code : codes) {
+    threads.emplace_back([&] { code = cache.get(hash, buf).value(); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto &code : codes) {
+    ASSERT_EQ(code, codes[0]);
+  }
+  ASSERT_EQ(*codes[0], common::Buffer({'b', 'a', 'b', 'e'}));
+
+  std::weak_ptr<const common::Buffer> weak = codes[0];
+  codes.clear();
+  ASSERT_TRUE(weak.expired());
+  ASSERT_NE(cache.get(hash, buf).value(), nullptr);
+}
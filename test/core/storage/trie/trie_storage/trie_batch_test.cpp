@@ -7,10 +7,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <future>
+#include <thread>
+
 #include "mock/core/storage/spaced_storage_mock.hpp"
 #include "mock/core/storage/trie_pruner/trie_pruner_mock.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
 #include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/trie/impl/shared_trie_batch_impl.hpp"
 #include "storage/trie/impl/topper_trie_batch_impl.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
@@ -29,6 +34,7 @@ using kagome::common::BufferOrView;
 using kagome::common::BufferView;
 using kagome::common::Hash256;
 using kagome::primitives::BlockHash;
+using kagome::storage::BufferBatch;
 using kagome::storage::Space;
 using kagome::storage::SpacedStorageMock;
 using kagome::storage::trie::StateVersion;
@@ -49,8 +55,8 @@ class TrieBatchTest : public test::BaseRocksDB_Test {
   void SetUp() override {
     open();
     auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
-    auto codec = std::make_shared<PolkadotCodec>();
-    auto serializer = std::make_shared<TrieSerializerImpl>(
+    codec = std::make_shared<PolkadotCodec>();
+    serializer = std::make_shared<TrieSerializerImpl>(
         factory, codec, std::make_shared<TrieStorageBackendImpl>(rocks_));
 
     empty_hash = serializer->getEmptyRootHash();
@@ -68,7 +74,9 @@ class TrieBatchTest : public test::BaseRocksDB_Test {
 
   static const std::vector<std::pair<Buffer, Buffer>> data;
 
-  std::unique_ptr<TrieStorage> trie;
+  std::shared_ptr<Codec> codec;
+  std::shared_ptr<TrieSerializer> serializer;
+  std::shared_ptr<TrieStorage> trie;
   RootHash empty_hash;
 };
 
@@ -277,3 +285,234 @@ TEST_F(TrieBatchTest, TopperBatchRemove) {
 }
 
 // TODO(Harrm): #595 test clearPrefix
+
+/**
+ * @given persistent batch with vector value and two nested topper batches
+ * @when items are appended in both topper batches and written back
+ * @then each batch reads vector with items appended up to it and persistent
+ * batch has all items after write back
+ */
+TEST_F(TrieBatchTest, TopperBatchAppend) {
+  std::shared_ptr<TrieBatch> p_batch =
+      trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  ASSERT_OUTCOME_SUCCESS_TRY(p_batch->put("0a"_hex2buf, "0401"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS_TRY(p_batch->put("0b"_hex2buf, "ff"_hex2buf));
+
+  auto outer = std::make_shared<TopperTrieBatchImpl>(p_batch);
+  auto inner = std::make_shared<TopperTrieBatchImpl>(outer);
+
+  outer->append("0a"_hex2buf, "02"_hex2buf).value();
+  inner->append("0a"_hex2buf, "03"_hex2buf).value();
+  inner->append("0c"_hex2buf, "04"_hex2buf).value();
+  inner->append("0b"_hex2buf, "05"_hex2buf).value();
+
+  EXPECT_EQ(outer->get("0a"_hex2buf).value(), "080102"_hex2buf);
+  EXPECT_EQ(inner->get("0a"_hex2buf).value(), "0c010203"_hex2buf);
+  EXPECT_EQ(inner->get("0c"_hex2buf).value(), "0404"_hex2buf);
+  EXPECT_FALSE(outer->contains("0c"_hex2buf).value());
+  // not a vector, left unchanged
+  EXPECT_EQ(inner->get("0b"_hex2buf).value(), "ff"_hex2buf);
+
+  inner->writeBack().value();
+  EXPECT_EQ(outer->get("0a"_hex2buf).value(), "0c010203"_hex2buf);
+  EXPECT_EQ(outer->get("0c"_hex2buf).value(), "0404"_hex2buf);
+
+  outer->writeBack().value();
+  EXPECT_EQ(p_batch->get("0a"_hex2buf).value(), "0c010203"_hex2buf);
+  EXPECT_EQ(p_batch->get("0c"_hex2buf).value(), "0404"_hex2buf);
+  EXPECT_EQ(p_batch->get("0b"_hex2buf).value(), "ff"_hex2buf);
+}
+
+/**
+ * @given topper batch
+ * @when 64 items are appended to new value
+ * @then compact length prefix grows from one to two bytes
+ */
+TEST_F(TrieBatchTest, TopperBatchAppendPrefixGrows) {
+  std::shared_ptr<TrieBatch> p_batch =
+      trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  auto t_batch = std::make_shared<TopperTrieBatchImpl>(p_batch);
+
+  Buffer expected{"0101"_hex2buf};
+  for (uint8_t i = 0; i < 64; ++i) {
+    std::array<uint8_t, 1> item{i};
+    t_batch->append("0a"_hex2buf, item).value();
+    expected.putUint8(i);
+  }
+  EXPECT_EQ(t_batch->get("0a"_hex2buf).value(), expected);
+}
+
+/**
+ * @given shared state of small trie
+ * @when two topper batches over shared batches read and write
+ * @then both read trie and don't see changes of each other
+ */
+TEST_F(TrieBatchTest, SharedBatchIsolated) {
+  auto batch = trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  FillSmallTrieWithBatch(*batch);
+  auto root = batch->commit(StateVersion::V0).value();
+  auto state = SharedTrieState::create(codec, serializer, root).value();
+
+  auto t_batch1 = std::make_shared<TopperTrieBatchImpl>(
+      std::make_shared<SharedTrieBatchImpl>(state));
+  auto t_batch2 = std::make_shared<TopperTrieBatchImpl>(
+      std::make_shared<SharedTrieBatchImpl>(state));
+  for (auto &[key, value] : data) {
+    EXPECT_EQ(t_batch1->get(key).value(), value);
+    EXPECT_EQ(t_batch2->get(key).value(), value);
+  }
+
+  t_batch1->put("abc"_buf, "1"_buf).value();
+  t_batch2->remove(data[0].first).value();
+  EXPECT_FALSE(t_batch2->contains("abc"_buf).value());
+  EXPECT_TRUE(t_batch1->contains(data[0].first).value());
+
+  auto cursor = std::make_shared<SharedTrieBatchImpl>(state)->trieCursor();
+  size_t count = 0;
+  for (cursor->seekFirst().value(); cursor->isValid(); cursor->next().value()) {
+    ++count;
+  }
+  EXPECT_EQ(count, data.size());
+}
+
+/**
+ * @given shared state of small trie
+ * @when shared batch is changed and committed
+ * @then new root is returned and shared state is not changed
+ */
+TEST_F(TrieBatchTest, SharedBatchCommit) {
+  auto batch = trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  FillSmallTrieWithBatch(*batch);
+  auto root = batch->commit(StateVersion::V0).value();
+  auto state = SharedTrieState::create(codec, serializer, root).value();
+
+  auto s_batch = std::make_shared<SharedTrieBatchImpl>(state);
+  s_batch->put("abc"_buf, "1"_buf).value();
+  EXPECT_TRUE(s_batch->contains("abc"_buf).value());
+  auto new_root = s_batch->commit(StateVersion::V0).value();
+  EXPECT_NE(new_root, root);
+
+  EXPECT_EQ(state->root(), root);
+  auto s_batch2 = std::make_shared<SharedTrieBatchImpl>(state);
+  EXPECT_FALSE(s_batch2->contains("abc"_buf).value());
+  EXPECT_EQ(s_batch2->commit(StateVersion::V0).value(), root);
+}
+
+/**
+ * @given shared state of small trie
+ * @when many threads read it through own shared batches
+ * @then all reads succeed
+ */
+TEST_F(TrieBatchTest, SharedBatchConcurrentReads) {
+  auto batch = trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  FillSmallTrieWithBatch(*batch);
+  auto root = batch->commit(StateVersion::V0).value();
+  auto state = SharedTrieState::create(codec, serializer, root).value();
+
+  std::atomic_size_t errors = 0;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 8; ++i) {
+    threads.emplace_back([&] {
+      for (size_t j = 0; j < 100; ++j) {
+        TopperTrieBatchImpl t_batch{
+            std::make_shared<SharedTrieBatchImpl>(state)};
+        for (auto &[key, value] : data) {
+          auto r = t_batch.get(key);
+          if (not r or r.value() != value) {
+            ++errors;
+          }
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(errors, 0);
+}
+
+/**
+ * Serializer, which blocks node loads of threads with `block_loads` set
+ * until `release` is ready.
+ */
+class BlockingSerializer : public TrieSerializer {
+ public:
+  explicit BlockingSerializer(std::shared_ptr<TrieSerializer> inner)
+      : inner_{std::move(inner)}, released_{release.get_future()} {}
+
+  RootHash getEmptyRootHash() const override {
+    return inner_->getEmptyRootHash();
+  }
+
+  outcome::result<std::pair<RootHash, std::unique_ptr<BufferBatch>>>
+  storeTrie(PolkadotTrie &trie, StateVersion version) override {
+    return inner_->storeTrie(trie, version);
+  }
+
+  outcome::result<std::shared_ptr<PolkadotTrie>> retrieveTrie(
+      RootHash db_key, OnNodeLoaded on_node_loaded) const override {
+    return inner_->retrieveTrie(db_key, std::move(on_node_loaded));
+  }
+
+  outcome::result<PolkadotTrie::NodePtr> retrieveNode(
+      MerkleValue db_key, const OnNodeLoaded &on_node_loaded) const override {
+    if (block_loads) {
+      blocked.set_value();
+      released_.wait();
+      block_loads = false;
+    }
+    return inner_->retrieveNode(db_key, on_node_loaded);
+  }
+
+  outcome::result<PolkadotTrie::NodePtr> retrieveNode(
+      const DummyNode &node,
+      const OnNodeLoaded &on_node_loaded) const override {
+    return retrieveNode(node.db_key, on_node_loaded);
+  }
+
+  outcome::result<std::optional<Buffer>> retrieveValue(
+      const Hash256 &hash, const OnNodeLoaded &on_node_loaded) const override {
+    return inner_->retrieveValue(hash, on_node_loaded);
+  }
+
+  static thread_local bool block_loads;
+  mutable std::promise<void> blocked;
+  std::promise<void> release;
+
+ private:
+  std::shared_ptr<TrieSerializer> inner_;
+  std::shared_future<void> released_;
+};
+
+thread_local bool BlockingSerializer::block_loads = false;
+
+/**
+ * @given shared state of small trie
+ * @when one call is blocked loading trie node
+ * @then other call reads same state meanwhile
+ */
+TEST_F(TrieBatchTest, SharedBatchParallelLoad) {
+  auto batch = trie->getPersistentBatchAt(empty_hash, std::nullopt).value();
+  FillSmallTrieWithBatch(*batch);
+  auto root = batch->commit(StateVersion::V0).value();
+  auto blocking = std::make_shared<BlockingSerializer>(serializer);
+  auto state = SharedTrieState::create(codec, blocking, root).value();
+
+  std::thread blocked_call{[&] {
+    BlockingSerializer::block_loads = true;
+    SharedTrieBatchImpl s_batch{state};
+    EXPECT_EQ(s_batch.get(data[0].first).value(), data[0].second);
+  }};
+  blocking->blocked.get_future().wait();
+
+  auto reads = std::async(std::launch::async, [&] {
+    SharedTrieBatchImpl s_batch{state};
+    for (auto &[key, value] : data) {
+      EXPECT_EQ(s_batch.get(key).value(), value);
+    }
+  });
+  auto status = reads.wait_for(std::chrono::seconds{10});
+  blocking->release.set_value();
+  blocked_call.join();
+  EXPECT_EQ(status, std::future_status::ready);
+}
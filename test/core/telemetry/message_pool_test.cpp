@@ -8,6 +8,7 @@
 
 #include <cstring>
 #include <string>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -253,3 +254,41 @@ TEST(MessagePoolFreeTest, ZeroSizeEntries) {
   auto handle = pool.push("test", 1);
   ASSERT_FALSE(handle);
 }
+
+/**
+ * @given a small pool shared by several threads
+ * @when every thread pushes, reads and releases its own messages concurrently
+ * @then every thread reads back exactly its message and all slots get free
+ */
+TEST(MessagePoolFreeTest, Concurrent) {
+  constexpr size_t kThreads = 4;
+  constexpr size_t kIterations = 10000;
+  MessagePool pool(kMaxRecordSizeBytes, kMaxPoolCapacity);
+  std::atomic_size_t corrupted = 0;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      std::string message(kMaxRecordSizeBytes, static_cast<char>('a' + t));
+      for (size_t i = 0; i < kIterations; ++i) {
+        auto handle = pool.push(message, 2);
+        if (not handle) {
+          continue;
+        }
+        auto buffer = pool[*handle];
+        if (buffer.size() != message.size()
+            or memcmp(message.data(), buffer.data(), message.size()) != 0) {
+          ++corrupted;
+        }
+        pool.release(*handle);
+        pool.release(*handle);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(corrupted, 0);
+  for (int i = 0; i < kMaxPoolCapacity; ++i) {
+    EXPECT_TRUE(pool.push("test", 1));
+  }
+}
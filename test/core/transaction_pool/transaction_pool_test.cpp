@@ -8,7 +8,9 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include "common/worker_thread_pool.hpp"
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/blockchain/block_storage_mock.hpp"
 #include "mock/core/crypto/hasher_mock.hpp"
 #include "mock/core/network/transactions_transmitter_mock.hpp"
 #include "mock/core/runtime/tagged_transaction_queue_mock.hpp"
@@ -18,20 +20,37 @@
 #include "testutil/prepare_loggers.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 
+using kagome::TestThreadPool;
 using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::blockchain::BlockStorageMock;
 using kagome::common::Buffer;
 using kagome::common::Hash256;
+using kagome::common::WorkerThreadPool;
 using kagome::crypto::HasherMock;
 using kagome::network::TransactionsTransmitterMock;
+using kagome::primitives::BlockBody;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::primitives::Extrinsic;
+using kagome::primitives::InvalidTransaction;
 using kagome::primitives::Transaction;
+using kagome::primitives::TransactionSource;
+using kagome::primitives::TransactionValidityError;
+using kagome::primitives::ValidTransaction;
+using kagome::primitives::events::ChainEventType;
+using kagome::primitives::events::ChainSubscriptionEngine;
 using kagome::primitives::events::ExtrinsicSubscriptionEngine;
 using kagome::runtime::TaggedTransactionQueueMock;
+using TransactionValidityAt =
+    kagome::runtime::TaggedTransactionQueue::TransactionValidityAt;
 using kagome::subscription::ExtrinsicEventKeyRepository;
 using kagome::transaction_pool::PoolModerator;
 using kagome::transaction_pool::PoolModeratorMock;
 using kagome::transaction_pool::TransactionPoolError;
 using kagome::transaction_pool::TransactionPoolImpl;
 
+using testing::_;
+using testing::Invoke;
 using testing::NiceMock;
 using testing::Return;
 
@@ -44,8 +63,6 @@ class TransactionPoolTest : public testing::Test {
   }
 
   void SetUp() override {
-    auto ttq = std::make_shared<TaggedTransactionQueueMock>();
-    auto hasher = std::make_shared<HasherMock>();
     auto tx_transmitter = std::make_shared<TransactionsTransmitterMock>();
     auto moderator = std::make_unique<NiceMock<PoolModeratorMock>>();
     auto header_repo = std::make_unique<BlockHeaderRepositoryMock>();
@@ -54,17 +71,50 @@ class TransactionPoolTest : public testing::Test {
         std::make_unique<ExtrinsicEventKeyRepository>();
 
     pool_ = std::make_shared<TransactionPoolImpl>(
-        std::move(ttq),
-        std::move(hasher),
+        ttq_,
+        hasher_,
         std::move(tx_transmitter),
         std::move(moderator),
         std::move(header_repo),
+        block_storage_,
         std::move(engine),
         std::move(extrinsic_event_key_repo),
+        worker_thread_pool_,
+        chain_sub_engine_,
         TransactionPoolImpl::Limits{3, 4});
+
+    ON_CALL(*block_storage_, getBlockBody(_))
+        .WillByDefault(Return(std::optional<BlockBody>{}));
+
+    // extrinsic hash is its first byte
+    ON_CALL(*hasher_, blake2b_256(_))
+        .WillByDefault(Invoke([](auto data) {
+          Hash256 hash;
+          hash[0] = data[0];
+          return hash;
+        }));
+  }
+
+  /// Validity of extrinsic providing tag equal to its first byte
+  static outcome::result<TransactionValidityAt> valid(TransactionSource,
+                                                     const Extrinsic &ext) {
+    ValidTransaction valid;
+    valid.provided_tags = {{ext.data[0]}};
+    valid.longevity = 100;
+    valid.propagate = false;
+    return TransactionValidityAt{BlockInfo{}, valid};
   }
 
  protected:
+  std::shared_ptr<TaggedTransactionQueueMock> ttq_ =
+      std::make_shared<TaggedTransactionQueueMock>();
+  std::shared_ptr<NiceMock<HasherMock>> hasher_ =
+      std::make_shared<NiceMock<HasherMock>>();
+  std::shared_ptr<NiceMock<BlockStorageMock>> block_storage_ =
+      std::make_shared<NiceMock<BlockStorageMock>>();
+  WorkerThreadPool worker_thread_pool_{TestThreadPool{}};
+  std::shared_ptr<ChainSubscriptionEngine> chain_sub_engine_ =
+      std::make_shared<ChainSubscriptionEngine>();
   std::shared_ptr<TransactionPoolImpl> pool_;
 };
 
@@ -162,3 +212,163 @@ TEST_F(TransactionPoolTest, CorrectRemoveTx) {
     EXPECT_EQ(outcome.error(), TransactionPoolError::TX_NOT_FOUND);
   }
 }
+
+/// @return hashes of transactions yielded by ready iterator
+std::vector<Transaction::Hash> readyOrder(
+    const TransactionPoolImpl &pool,
+    std::optional<Transaction::Hash> invalid = std::nullopt) {
+  std::vector<Transaction::Hash> order;
+  auto ready = pool.readyTransactions();
+  while (auto tx = ready->next()) {
+    order.emplace_back(tx->hash);
+    if (tx->hash == invalid) {
+      ready->reportInvalid();
+    }
+  }
+  return order;
+}
+
+/**
+ * @given ready transactions with different priorities, high priority one
+ * depends on low priority one
+ * @when iterate ready transactions
+ * @then they are yielded by priority, older first among equal priorities,
+ * dependent transaction after its dependency
+ */
+TEST_F(TransactionPoolTest, ReadyOrder) {
+  auto low = makeTx("01"_hash256, {{1}}, {});
+  low.priority = 1;
+  auto dependent = makeTx("02"_hash256, {{2}}, {{1}});
+  dependent.priority = 10;
+  auto older = makeTx("03"_hash256, {{3}}, {});
+  older.priority = 5;
+  auto newer = makeTx("04"_hash256, {{4}}, {});
+  newer.priority = 5;
+  EXPECT_OUTCOME_TRUE_1(submit(*pool_, {low, dependent, older, newer}));
+
+  EXPECT_EQ(readyOrder(*pool_),
+            (std::vector{
+                "03"_hash256, "04"_hash256, "01"_hash256, "02"_hash256}));
+}
+
+/**
+ * @given ready transaction with dependent
+ * @when transaction is reported invalid during iteration
+ * @then dependent transaction is not yielded
+ */
+TEST_F(TransactionPoolTest, ReadyInvalidSkipsDependents) {
+  auto first = makeTx("01"_hash256, {{1}}, {});
+  auto dependent = makeTx("02"_hash256, {{2}}, {{1}});
+  auto other = makeTx("03"_hash256, {{3}}, {});
+  EXPECT_OUTCOME_TRUE_1(submit(*pool_, {first, dependent, other}));
+
+  EXPECT_EQ(readyOrder(*pool_, "01"_hash256),
+            (std::vector{"01"_hash256, "03"_hash256}));
+}
+
+/**
+ * @given ready transaction with dependent
+ * @when the transaction is removed
+ * @then remaining transactions are still iterated
+ */
+TEST_F(TransactionPoolTest, ReadyOrderAfterRemove) {
+  auto first = makeTx("01"_hash256, {{1}}, {});
+  auto dependent = makeTx("02"_hash256, {{2}}, {{1}});
+  auto other = makeTx("03"_hash256, {{3}}, {});
+  EXPECT_OUTCOME_TRUE_1(submit(*pool_, {first, other, dependent}));
+  EXPECT_OUTCOME_TRUE_1(pool_->removeOne("03"_hash256));
+
+  EXPECT_EQ(readyOrder(*pool_), (std::vector{"01"_hash256, "02"_hash256}));
+}
+
+/**
+ * @given batch of extrinsics with one extrinsic repeated
+ * @when submit the batch
+ * @then unique extrinsics are validated, repeated one is already imported
+ */
+TEST_F(TransactionPoolTest, SubmitExtrinsics) {
+  // repeated extrinsic is validated once
+  EXPECT_CALL(*ttq_, validate_transaction(TransactionSource::External, _))
+      .Times(2)
+      .WillRepeatedly(Invoke(valid));
+  auto results =
+      pool_->submitExtrinsics(TransactionSource::External,
+                              {Extrinsic{Buffer{1}},
+                               Extrinsic{Buffer{2}},
+                               Extrinsic{Buffer{1}}});
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0].value()[0], 1);
+  EXPECT_EQ(results[1].value()[0], 2);
+  EXPECT_EQ(results[2].error(), TransactionPoolError::TX_ALREADY_IMPORTED);
+  EXPECT_EQ(pool_->getStatus().ready_num, 2);
+}
+
+/**
+ * @given ready transactions
+ * @when new head arrives and one of them became invalid
+ * @then invalid transaction is removed from pool
+ */
+TEST_F(TransactionPoolTest, RevalidateOnNewHead) {
+  EXPECT_CALL(*ttq_, validate_transaction(_, _)).WillRepeatedly(Invoke(valid));
+  for (uint8_t i = 1; i <= 2; ++i) {
+    EXPECT_OUTCOME_TRUE_1(pool_->submitExtrinsic(TransactionSource::External,
+                                                 Extrinsic{Buffer{i}}));
+  }
+
+  EXPECT_CALL(*ttq_, validate_transaction(_, Extrinsic{Buffer{1}}))
+      .WillOnce(Return(TransactionValidityAt{
+          BlockInfo{},
+          TransactionValidityError{
+              InvalidTransaction{InvalidTransaction::Kind::Stale}}}));
+  BlockHeader head;
+  head.hash_opt = "head"_hash256;
+  chain_sub_engine_->notify(ChainEventType::kNewHeads, std::cref(head));
+  worker_thread_pool_.io_context()->run();
+
+  EXPECT_EQ(pool_->getStatus().ready_num, 1);
+  EXPECT_EQ(pool_->getStatus().waiting_num, 0);
+}
+
+/**
+ * @given ready transactions, one of them included into new head
+ * @when new head arrives, before block executor removes included transaction
+ * @then included transaction is neither revalidated nor removed as invalid
+ */
+TEST_F(TransactionPoolTest, RevalidateSkipsIncluded) {
+  EXPECT_CALL(*ttq_, validate_transaction(_, _)).WillRepeatedly(Invoke(valid));
+  for (uint8_t i = 1; i <= 2; ++i) {
+    EXPECT_OUTCOME_TRUE_1(pool_->submitExtrinsic(TransactionSource::External,
+                                                 Extrinsic{Buffer{i}}));
+  }
+
+  BlockHeader head;
+  head.hash_opt = "head"_hash256;
+  EXPECT_CALL(*block_storage_, getBlockBody("head"_hash256))
+      .WillOnce(Return(std::make_optional(BlockBody{Extrinsic{Buffer{1}}})));
+  EXPECT_CALL(*ttq_, validate_transaction(_, Extrinsic{Buffer{1}})).Times(0);
+  chain_sub_engine_->notify(ChainEventType::kNewHeads, std::cref(head));
+  worker_thread_pool_.io_context()->run();
+
+  EXPECT_EQ(pool_->getStatus().ready_num, 2);
+}
+
+/**
+ * @given ready transaction submitted by local source
+ * @when new head arrives
+ * @then transaction is revalidated with its original source
+ */
+TEST_F(TransactionPoolTest, RevalidateWithOriginalSource) {
+  EXPECT_CALL(*ttq_, validate_transaction(TransactionSource::Local, _))
+      .Times(2)
+      .WillRepeatedly(Invoke(valid));
+  EXPECT_OUTCOME_TRUE_1(pool_->submitExtrinsic(TransactionSource::Local,
+                                               Extrinsic{Buffer{1}}));
+
+  BlockHeader head;
+  head.hash_opt = "head"_hash256;
+  chain_sub_engine_->notify(ChainEventType::kNewHeads, std::cref(head));
+  worker_thread_pool_.io_context()->run();
+
+  EXPECT_EQ(pool_->getStatus().ready_num, 1);
+}
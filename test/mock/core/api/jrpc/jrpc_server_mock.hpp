@@ -21,11 +21,21 @@ namespace kagome::api {
                 (const std::string &name, Method method, bool),
                 (override));
 
+    MOCK_METHOD(void, markOrdered, (const std::string &name), (override));
+
+    MOCK_METHOD(void,
+                registerStreamHandler,
+                (const std::string &name, StreamMethod method, bool),
+                (override));
+
     MOCK_METHOD(std::vector<std::string>, getHandlerNames, (), (override));
 
     MOCK_METHOD(void,
                 processData,
-                (std::string_view, bool, const ResponseHandler &),
+                (std::string_view,
+                 bool,
+                 const ResponseHandler &,
+                 const JrpcBatchExecutor::Scope &),
                 (override));
 
     MOCK_METHOD(void,
@@ -79,8 +79,12 @@ namespace kagome::application {
                 (),
                 (const, override));
 
+    MOCK_METHOD(bool, runtimeAllocatorStats, (), (const, override));
+
     MOCK_METHOD(uint32_t, maxWsConnections, (), (const, override));
 
+    MOCK_METHOD(uint32_t, rpcCallBudget, (), (const, override));
+
     MOCK_METHOD(std::chrono::seconds,
                 getRandomWalkInterval,
                 (),
@@ -120,6 +124,8 @@ namespace kagome::application {
 
     MOCK_METHOD(bool, purgeWavmCache, (), (const, override));
 
+    MOCK_METHOD(uint32_t, runtimeCacheLimit, (), (const, override));
+
     MOCK_METHOD(uint32_t,
                 parachainRuntimeInstanceCacheSize,
                 (),
@@ -141,6 +147,8 @@ namespace kagome::application {
 
     MOCK_METHOD(size_t, pvfMaxWorkers, (), (const, override));
 
+    MOCK_METHOD(uint32_t, availabilityStoreMemoryLimit, (), (const, override));
+
     MOCK_METHOD(bool, disableSecureMode, (), (const, override));
 
     MOCK_METHOD(bool, enableDbMigration, (), (const, override));
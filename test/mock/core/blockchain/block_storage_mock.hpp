@@ -67,6 +67,11 @@ namespace kagome::blockchain {
                 (const primitives::BlockHash &),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<std::optional<primitives::BlockHash>>,
+                getAncestorHash,
+                (const primitives::BlockInfo &, primitives::BlockNumber),
+                (const, override));
+
     MOCK_METHOD(outcome::result<void>,
                 putBlockBody,
                 (const primitives::BlockHash &, const primitives::BlockBody &),
@@ -108,6 +113,11 @@ namespace kagome::blockchain {
                 (const primitives::BlockHash &),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<std::vector<EncodedBlockData>>,
+                getEncodedBlocks,
+                (std::span<const primitives::BlockHash>, bool, bool, bool),
+                (const, override));
+
     MOCK_METHOD(outcome::result<void>,
                 removeBlock,
                 (const primitives::BlockHash &),
@@ -18,6 +18,12 @@ namespace kagome::consensus::babe {
                 validateHeader,
                 (const primitives::BlockHeader &block_header),
                 (const, override));
+
+    MOCK_METHOD(std::optional<Precheck>,
+                precheckHeader,
+                (const primitives::BlockHeader &header,
+                 const primitives::BlockHeader &ancestor),
+                (const, override));
   };
 
 }  // namespace kagome::consensus::babe
@@ -28,6 +28,11 @@ namespace kagome::crypto {
                  const Sr25519PublicKey &),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<std::vector<bool>>,
+                verifyBatch,
+                (std::span<const Sr25519VerifyItem>),
+                (const, override));
+
     MOCK_METHOD(outcome::result<bool>,
                 verify_deprecated,
                 (const Sr25519Signature &,
@@ -24,6 +24,12 @@ namespace kagome::transaction_pool {
                 (primitives::TransactionSource, primitives::Extrinsic),
                 (override));
 
+    MOCK_METHOD(std::vector<outcome::result<Transaction::Hash>>,
+                submitExtrinsics,
+                (primitives::TransactionSource,
+                 std::vector<primitives::Extrinsic>),
+                (override));
+
     MOCK_METHOD(outcome::result<void>, submitOne, (Transaction), ());
     outcome::result<void> submitOne(Transaction &&tx) override {
       return submitOne(tx);
@@ -49,6 +55,11 @@ namespace kagome::transaction_pool {
                 (),
                 (const));
 
+    MOCK_METHOD(std::unique_ptr<ReadyTransactionsIterator>,
+                readyTransactions,
+                (),
+                (const, override));
+
     MOCK_METHOD(outcome::result<std::vector<Transaction>>,
                 removeStale,
                 (const primitives::BlockId &),